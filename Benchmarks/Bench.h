@@ -0,0 +1,60 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Bench.h                                   *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Minimal timing helpers shared by benchmarks.                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace Bench
+{
+
+/**
+ * @brief Run a function several times and get the best time.
+ *
+ * The best time is less noisy than the average for short workloads.
+ *
+ * @param repeat How many times to run.
+ * @param func The workload.
+ * @return Best time in microseconds.
+ */
+template <typename Func> double Measure(int repeat, Func&& func)
+{
+    double best = 1e30;
+    for (int i = 0; i < repeat; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+
+/**
+ * @brief Print one line of result.
+ */
+inline void Report(const char* name, size_t count, double baseline, double candidate)
+{
+    std::printf("%-24s %8zu  baseline %10.1f us  candidate %10.1f us  speedup %5.2fx\n", name, count, baseline,
+                candidate, baseline / candidate);
+}
+
+} // namespace Bench
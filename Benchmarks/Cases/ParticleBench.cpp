@@ -0,0 +1,48 @@
+/**
+ * Compare the particle update with SIMD over structure-of-arrays data
+ * against the scalar path, both on the same data, at the particle counts
+ * an emitter is expected to sustain every frame.
+ */
+
+#include "Bench.h"
+
+#include "Renderer/ParticleSystemImpl.h"
+
+#include <random>
+
+using namespace DgeX;
+
+static void Run(size_t count)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+
+    ParticleStream stream(count);
+    stream.Count = count;
+    for (size_t i = 0; i < count; i++)
+    {
+        stream.X[i] = value(random);
+        stream.Y[i] = value(random);
+        stream.VelocityX[i] = value(random);
+        stream.VelocityY[i] = value(random);
+        stream.InverseLife[i] = 0.0f; // never dies, so the count stays
+        stream.Spin[i] = value(random);
+    }
+
+    const ParticleMotion motion{ 0.0f, 98.0f, 1.0f, 0.5f, { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.5f, 0.0f, 0.0f } };
+    double scalar = Bench::Measure(20, [&] { UpdateParticlesScalar(stream, motion, 0.016f, 0, count); });
+    double simd = Bench::Measure(20, [&] { UpdateParticles(stream, motion, 0.016f); });
+    Bench::Report("ParticleUpdate", count, scalar, simd);
+}
+
+int main()
+{
+    std::printf("SIMD path: %s\n", GetParticlePath());
+
+    for (size_t count : { 1000, 10000, 100000 })
+    {
+        Run(count);
+    }
+
+    return 0;
+}
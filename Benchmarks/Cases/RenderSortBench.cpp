@@ -0,0 +1,85 @@
+/**
+ * Compare the radix sort of 64-bit keys used by OrderedRenderer with the
+ * previous approach, i.e. std::sort of shared pointers by a virtual getter.
+ */
+
+#include "Bench.h"
+
+#include "Utils/RadixSort.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+// Mimic the previous polymorphic render command.
+class LegacyCommand
+{
+public:
+    explicit LegacyCommand(int order) : _order(order)
+    {
+    }
+
+    virtual ~LegacyCommand() = default;
+
+    int GetOrder() const
+    {
+        return _order;
+    }
+
+private:
+    int _order;
+};
+
+static void Run(size_t count)
+{
+    std::mt19937 random(42);
+    std::vector<int> orders(count);
+    std::vector<uint32_t> materials(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        orders[i] = static_cast<int>(random() % 16);
+        materials[i] = static_cast<uint32_t>(random() % 8);
+    }
+
+    std::vector<std::shared_ptr<LegacyCommand>> source;
+    for (int order : orders)
+    {
+        source.push_back(std::make_shared<LegacyCommand>(order));
+    }
+
+    // Refreshing the unsorted input is not part of the sort, so take it out.
+    std::vector<std::shared_ptr<LegacyCommand>> legacy;
+    double copy = Bench::Measure(20, [&] { legacy = source; });
+    double baseline = Bench::Measure(20, [&] {
+        legacy = source;
+        std::sort(legacy.begin(), legacy.end(),
+                  [](const std::shared_ptr<LegacyCommand>& lhs, const std::shared_ptr<LegacyCommand>& rhs) {
+                      return lhs->GetOrder() < rhs->GetOrder();
+                  });
+    });
+
+    std::vector<SortKeyEntry> keys(count);
+    std::vector<SortKeyEntry> scratch(count);
+    double candidate = Bench::Measure(20, [&] {
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t key = static_cast<uint64_t>(static_cast<uint32_t>(orders[i]) ^ 0x80000000u) << 32;
+            keys[i] = { key | materials[i], static_cast<uint32_t>(i) };
+        }
+        RadixSort(keys.data(), scratch.data(), count);
+    });
+
+    Bench::Report("RenderSort", count, baseline - copy, candidate);
+}
+
+int main()
+{
+    for (size_t count : { 1000, 10000, 100000 })
+    {
+        Run(count);
+    }
+
+    return 0;
+}
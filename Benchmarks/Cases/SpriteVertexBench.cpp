@@ -0,0 +1,87 @@
+/**
+ * Compare quad generation of sprites with SIMD over structure-of-arrays
+ * data against the scalar path, both on the same data, and against the
+ * previous per-command path of sprite batches.
+ */
+
+#include "Bench.h"
+
+#include "Renderer/SpriteVertex.h"
+
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+static void Run(size_t count)
+{
+    const float width = 32.0f;
+    const float height = 32.0f;
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(0.0f, 1920.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    std::uniform_real_distribution<float> degree(0.0f, 360.0f);
+
+    std::vector<TextureRenderCommand> commands;
+    for (size_t i = 0; i < count; i++)
+    {
+        commands.push_back({ { RenderCommandType::Texture, 0 },
+                             {},
+                             { 0.0f, 0.0f },
+                             position(random),
+                             position(random),
+                             scale(random),
+                             degree(random),
+                             255,
+                             (i % 2) == 0,
+                             false,
+                             true });
+    }
+
+    SpriteStream stream;
+    for (const TextureRenderCommand& command : commands)
+    {
+        stream.Push(command, width, height);
+    }
+
+    Transform camera = Transform::Camera(960.0f, 540.0f, 1.5f, 10.0f, 1920.0f, 1080.0f);
+    std::vector<SDL_Vertex> vertices(count * 4);
+
+    double scalar = Bench::Measure(20, [&] {
+        GenerateSpriteVerticesScalar(stream, &camera, vertices.data(), 0, count);
+    });
+    double simd = Bench::Measure(20, [&] { GenerateSpriteVertices(stream, &camera, vertices.data()); });
+    Bench::Report("SpriteVertex", count, scalar, simd);
+
+    // Previous path, one quad per command, including gathering the stream.
+    double legacy = Bench::Measure(20, [&] {
+        for (size_t i = 0; i < count; i++)
+        {
+            TextureRenderCommand command = commands[i];
+            command.Transform = &camera;
+            GetTextureQuad(command, width, height, vertices.data() + i * 4);
+        }
+    });
+    double batched = Bench::Measure(20, [&] {
+        stream.Clear();
+        for (const TextureRenderCommand& command : commands)
+        {
+            stream.Push(command, width, height);
+        }
+        GenerateSpriteVertices(stream, &camera, vertices.data());
+    });
+    Bench::Report("SpriteVertexBatch", count, legacy, batched);
+}
+
+int main()
+{
+    std::printf("SIMD path: %s\n", GetSpriteVertexPath());
+
+    for (size_t count : { 10000, 100000 })
+    {
+        Run(count);
+    }
+
+    return 0;
+}
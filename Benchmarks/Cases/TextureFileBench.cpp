@@ -0,0 +1,93 @@
+/**
+ * Compare loading images with SDL_image against engine texture files,
+ * raw and QOI compressed, from file to surface ready for upload. Cold is
+ * the first load of each file in the process, while the system may still
+ * have them cached since they were just written. Warm is the best of
+ * repeated loads.
+ */
+
+#include "Bench.h"
+
+#include "Renderer/TextureFileImpl.h"
+
+#include <SDL3_image/SDL_image.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+using namespace DgeX;
+
+static SDL_Surface* CreateImage(int size)
+{
+    // Smooth gradients with a noisy band, roughly like sprite sheets.
+    SDL_Surface* surface = SDL_CreateSurface(size, size, SDL_PIXELFORMAT_ARGB8888);
+    std::mt19937 random(42);
+    for (int y = 0; y < size; y++)
+    {
+        auto* row = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) + y * surface->pitch);
+        for (int x = 0; x < size; x++)
+        {
+            uint32_t alpha = ((x / 64 + y / 64) % 3 == 0) ? 0 : 255;
+            uint32_t color = (y % 256) << 16 | (x % 256) << 8 | ((x + y) % 256);
+            if ((y > size / 2) && (y < size / 2 + size / 8))
+            {
+                color = random() & 0xFFFFFF;
+            }
+            row[x] = alpha << 24 | color;
+        }
+    }
+    return surface;
+}
+
+static void Run(int size)
+{
+    const std::string name = "TextureFileBench" + std::to_string(size);
+    const std::string png = name + ".png";
+    const std::string raw = name + "Raw" + TEXTURE_FILE_EXTENSION;
+    const std::string qoi = name + "Qoi" + TEXTURE_FILE_EXTENSION;
+
+    SDL_Surface* image = CreateImage(size);
+    IMG_SavePNG(image, png.c_str());
+    SDL_DestroySurface(image);
+
+    TextureConvertOptions options;
+    options.Format = SDL_PIXELFORMAT_ARGB8888;
+    ConvertTexture(png, raw, options);
+    options.Compression = TextureCompression::Qoi;
+    ConvertTexture(png, qoi, options);
+
+    auto loadImage = [&png] { SDL_DestroySurface(IMG_Load(png.c_str())); };
+    auto loadFile = [](const std::string& path) {
+        return [path] {
+            bool premultiplied;
+            SDL_DestroySurface(LoadImageSurface(path, premultiplied));
+        };
+    };
+
+    // Each file is loaded once before anything is repeated.
+    double imageCold = Bench::Measure(1, loadImage);
+    double rawCold = Bench::Measure(1, loadFile(raw));
+    double qoiCold = Bench::Measure(1, loadFile(qoi));
+    double imageWarm = Bench::Measure(10, loadImage);
+
+    auto pixels = static_cast<size_t>(size) * size;
+    Bench::Report("TextureFileRawCold", pixels, imageCold, rawCold);
+    Bench::Report("TextureFileQoiCold", pixels, imageCold, qoiCold);
+    Bench::Report("TextureFileRawWarm", pixels, imageWarm, Bench::Measure(10, loadFile(raw)));
+    Bench::Report("TextureFileQoiWarm", pixels, imageWarm, Bench::Measure(10, loadFile(qoi)));
+
+    std::remove(png.c_str());
+    std::remove(raw.c_str());
+    std::remove(qoi.c_str());
+}
+
+int main()
+{
+    for (int size : { 512, 2048 })
+    {
+        Run(size);
+    }
+
+    return 0;
+}
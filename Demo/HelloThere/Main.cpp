@@ -13,10 +13,9 @@ using namespace DgeX;
 
 struct State
 {
-    Ref<Renderer> DirectRenderer;
     Ref<Renderer> OrderedRenderer;
     Ref<Texture> Image;
-    Ref<Texture> Canvas;
+    Ref<CachedLayer> Canvas;
     int Count = 0;
 };
 
@@ -35,10 +34,9 @@ int OnStart(void* context)
 {
     State* state = static_cast<State*>(context);
 
-    state->DirectRenderer = CreateRenderer({ false });
     state->OrderedRenderer = CreateRenderer({ true });
     state->Image = LoadTexture("gs_tiger.svg");
-    state->Canvas = CreateTexture(300, 300);
+    state->Canvas = CreateCachedLayer(300, 300);
 
     SetFont(LoadFont("Arial"));
     SetFontSize(36.0f);
@@ -58,8 +56,8 @@ int OnUpdate(void* context)
     DrawTexture(state->Image, 20, 20);
 
     {
-        USE_RENDERER(state->DirectRenderer);
-        USE_RENDER_TARGET(state->Canvas);
+        // Only rendered to the texture when the content changes.
+        RECORD_CACHED_LAYER(state->Canvas);
 
         Color oldClearColor = GetClearColor();
         SetClearColor(Color::White);
@@ -70,10 +68,9 @@ int OnUpdate(void* context)
         DrawFilledRect(0, 0, 200, 100);
         SetFillColor(Color::Red);
         DrawFilledRect(40, 40, 200, 100); // on top of yellow
-        state->DirectRenderer->Render();
     }
-    DrawTextureBegin(state->Canvas, 10, 10).Alpha(220).Scale(0.9f).Submit();
-    DrawTextureBegin(state->Canvas, 10, 10).Alpha(220).Rotate(30).Scale(0.9f).Anchor(0, 0).Submit();
+    DrawTextureBegin(state->Canvas->GetTexture(), 10, 10).Alpha(220).Scale(0.9f).Submit();
+    DrawTextureBegin(state->Canvas->GetTexture(), 10, 10).Alpha(220).Rotate(30).Scale(0.9f).Anchor(0, 0).Submit();
 
     {
         USE_RENDERER(state->OrderedRenderer);
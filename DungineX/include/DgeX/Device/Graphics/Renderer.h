@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 3, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -25,13 +25,56 @@
 
 #include <SDL3/SDL.h>
 
+#include <cstdint>
+
 DGEX_BEGIN
 
-class RenderCommand;
+struct RenderCommand;
 
 struct RendererProperties
 {
-    bool Ordered;
+    // Execute commands by z index instead of issue order.
+    bool Ordered = false;
+
+    // For ordered renderer, group commands of the same texture within the
+    // same z index for better batching. Commands of different textures
+    // may then be reordered within a z index.
+    bool GroupByTexture = false;
+
+    // Redraw only areas changed since the last Render into a back buffer
+    // kept across frames, and copy it to the target. For mostly static
+    // screens, e.g. menus, where redrawing everything is costly. Commands
+    // are only accepted from the render thread.
+    bool PartialRedraw = false;
+};
+
+/**
+ * @brief Statistics of the last rendered frame of a renderer.
+ */
+struct RendererStatistics
+{
+    uint32_t CommandCount;  // commands submitted
+    uint32_t DrawCallCount; // native draw calls issued
+    uint32_t BatchCount;    // geometry batches issued for sprites
+    uint32_t SpriteCount;   // sprites drawn in batches
+
+    uint32_t PrimitiveBatchCount; // draw calls issued for primitives
+    uint32_t PrimitiveCount;      // points, lines and rectangles drawn
+
+    uint32_t DamagedRectCount;  // areas redrawn by partial redraw
+    uint64_t DamagedPixelCount; // pixels redrawn by partial redraw
+};
+
+/**
+ * @brief Statistics of state changes on the native renderer.
+ *
+ * Draw color, blend mode, texture modulation, render target, viewport and
+ * clip rect are only forwarded to SDL when they actually change.
+ */
+struct RenderStateStatistics
+{
+    uint64_t IssuedCount; // state changes forwarded to SDL
+    uint64_t ElidedCount; // redundant state changes skipped
 };
 
 /**
@@ -40,6 +83,9 @@ struct RendererProperties
  * There is an important matter to pay attention to, which
  * is the rendering order. So we will end up have one to
  * be aware of the order, and the other do not.
+ *
+ * Only ordered renderers accept commands from other threads than the
+ * render thread. Render and Flush are always on the render thread.
  */
 class Renderer
 {
@@ -55,14 +101,53 @@ public:
     /**
      * @brief Submit a queued render command.
      *
+     * The command is only borrowed during the call, so renderers that
+     * defer execution must keep their own copy.
+     *
      * @param command Render command.
      */
-    virtual void Submit(const Ref<RenderCommand>& command) = 0;
+    virtual void Submit(const RenderCommand& command) = 0;
 
     /**
      * @brief Render all commands on the target.
      */
     DGEX_API virtual void Render() = 0;
+
+    /**
+     * @brief Execute commands held back for batching right away.
+     *
+     * Renderers that execute commands as they come may still hold a few
+     * for batching. This is called automatically on render target change,
+     * renderer change and device flush, so you rarely need to call it.
+     */
+    DGEX_API virtual void Flush() = 0;
+
+    /**
+     * @brief Redraw the whole target on the next Render.
+     *
+     * Only matters for partial redraw, which notices changed commands and
+     * textures reloaded under the same handle, but not pixels changed in
+     * a texture drawn by the same command, e.g. a render target.
+     */
+    DGEX_API virtual void Invalidate();
+
+    /**
+     * @brief Get statistics of the last Render.
+     *
+     * @return Renderer statistics.
+     */
+    DGEX_API const RendererStatistics& GetStatistics() const;
+
+    /**
+     * @brief Get properties the renderer is created with.
+     *
+     * @return Renderer properties.
+     */
+    DGEX_API const RendererProperties& GetProperties() const;
+
+protected:
+    RendererStatistics _statistics{};
+    RendererProperties _properties{};
 };
 
 // ============================================================================
@@ -76,6 +161,17 @@ public:
  */
 dgex_error_t InitRenderer();
 
+/**
+ * @brief Initialize renderer context with a native renderer made elsewhere.
+ *
+ * For rendering without a window, e.g. into a software renderer. The
+ * native renderer is owned from now on, and destroyed by DestroyRenderer.
+ *
+ * @param renderer The native renderer.
+ * @return 0 on success, failure otherwise.
+ */
+dgex_error_t InitRenderer(SDL_Renderer* renderer);
+
 /**
  * @brief Destroy renderer context.
  *
@@ -83,6 +179,16 @@ dgex_error_t InitRenderer();
  */
 void DestroyRenderer();
 
+/**
+ * @brief Check whether the calling thread is the render thread.
+ *
+ * The render thread is the one that initialized the renderer, and is the
+ * only one allowed to call SDL render functions.
+ *
+ * @return Whether on the render thread.
+ */
+bool IsRenderThread();
+
 /**
  * @brief Get the native renderer.
  *
@@ -102,4 +208,30 @@ SDL_Renderer* GetNativeRenderer();
  */
 DGEX_API Ref<Renderer> CreateRenderer(const RendererProperties& properties);
 
+/**
+ * @brief Get state change statistics of the native renderer.
+ *
+ * Counters accumulate until reset, shared by all renderers.
+ *
+ * @return Render state statistics.
+ */
+DGEX_API RenderStateStatistics GetRenderStateStatistics();
+
+/**
+ * @brief Reset state change statistics of the native renderer.
+ */
+DGEX_API void ResetRenderStateStatistics();
+
+/**
+ * @brief Outline areas redrawn by partial redraw, for debugging.
+ *
+ * Outlines are drawn on the target only, so they do not stay in the
+ * back buffer.
+ *
+ * @param enabled Whether to outline.
+ */
+DGEX_API void SetDamageOutline(bool enabled);
+
+DGEX_API bool IsDamageOutlineEnabled();
+
 DGEX_END
@@ -56,16 +56,29 @@
 #pragma once
 
 #include "DgeX/Defines.h"
+#include "DgeX/MainLoop.h"
 #include "DgeX/Version.h"
 
 #include "DgeX/Device/Graphics/Graphics.h"
 #include "DgeX/Device/Graphics/Renderer.h"
 #include "DgeX/Device/Graphics/Window.h"
 
+#include "DgeX/Renderer/CachedLayer.h"
 #include "DgeX/Renderer/Color.h"
+#include "DgeX/Renderer/CommandList.h"
 #include "DgeX/Renderer/Font.h"
+#include "DgeX/Renderer/ParticleSystem.h"
 #include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/StaticSpriteWorld.h"
 #include "DgeX/Renderer/Texture.h"
+#include "DgeX/Renderer/TextureAtlas.h"
+#include "DgeX/Renderer/TextureCache.h"
+#include "DgeX/Renderer/TextureFile.h"
+#include "DgeX/Renderer/TextureLoader.h"
+#include "DgeX/Renderer/TextureResidency.h"
+#include "DgeX/Renderer/TextureVariant.h"
+#include "DgeX/Renderer/Tilemap.h"
+#include "DgeX/Renderer/Transform.h"
 
 #include "DgeX/Utils/Assert.h"
 #include "DgeX/Utils/Log.h"
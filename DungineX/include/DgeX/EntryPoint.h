@@ -44,6 +44,7 @@ typedef int (*DgeXMainEntry)(const CommandLineArgs&);
 typedef int (*DgeXOnInitEntry)(const CommandLineArgs&, void**);
 typedef int (*DgeXOnStartEntry)(void*);
 typedef int (*DgeXOnUpdateEntry)(void*);
+typedef int (*DgeXOnFixedUpdateEntry)(void*);
 typedef int (*DgeXOnEventEntry)(void*);
 typedef int (*DgeXOnExitEntry)(void*);
 
@@ -55,6 +56,8 @@ typedef int (*DgeXOnExitEntry)(void*);
  * - OnUpdate
  * - OnEvent
  * - OnExit
+ *
+ * OnFixedUpdate is optional, define DGEX_USE_FIXED_UPDATE to use it.
  */
 #ifdef DGEX_USE_CALLBACKS
 
@@ -93,6 +96,22 @@ extern int DgeXOnStart(void* context);
  */
 extern int DgeXOnUpdate(void* context);
 
+#ifdef DGEX_USE_FIXED_UPDATE
+
+/**
+ * @brief This is called every fixed timestep of the game.
+ *
+ * It is called before DgeXOnUpdate as many times as fixed steps have
+ * passed, on the same thread, see MainLoopProperties::FixedTimestep.
+ *
+ * @param context Custom application context set in DgeXInit.
+ * @return Whether the game should continue or not.
+ *         0 for continue, others to exit.
+ */
+extern int DgeXOnFixedUpdate(void* context);
+
+#endif // DGEX_USE_FIXED_UPDATE
+
 /**
  * @brief This is called when the game receives an event.
  *
@@ -125,6 +144,9 @@ extern int DgeXMain(const CommandLineArgs& args);
 DGEX_API int DgeXMainImpl(CommandLineArgs args, DgeXMainEntry entry);
 DGEX_API int DgeXMainImplWithCallbacks(CommandLineArgs args, DgeXOnInitEntry onInit, DgeXOnStartEntry onStart,
                                        DgeXOnUpdateEntry onUpdate, DgeXOnEventEntry onEvent, DgeXOnExitEntry onExit);
+DGEX_API int DgeXMainImplWithFixedUpdate(CommandLineArgs args, DgeXOnInitEntry onInit, DgeXOnStartEntry onStart,
+                                         DgeXOnUpdateEntry onUpdate, DgeXOnEventEntry onEvent, DgeXOnExitEntry onExit,
+                                         DgeXOnFixedUpdateEntry onFixedUpdate);
 
 // ============================================================================
 // Main Entry
@@ -134,7 +156,10 @@ DGEX_API int DgeXMainImplWithCallbacks(CommandLineArgs args, DgeXOnInitEntry onI
 
 int main(int argc, char* argv[])
 {
-#ifdef DGEX_USE_CALLBACKS
+#if defined(DGEX_USE_CALLBACKS) && defined(DGEX_USE_FIXED_UPDATE)
+    return DgeXMainImplWithFixedUpdate({ argc, argv }, DgeXOnInit, DgeXOnStart, DgeXOnUpdate, DgeXOnEvent, DgeXOnExit,
+                                       DgeXOnFixedUpdate);
+#elif defined(DGEX_USE_CALLBACKS)
     return DgeXMainImplWithCallbacks({ argc, argv }, DgeXOnInit, DgeXOnStart, DgeXOnUpdate, DgeXOnEvent, DgeXOnExit);
 #else
     return DgeXMainImpl({ argc, argv }, DgeXMain);
@@ -150,6 +175,10 @@ int main(int argc, char* argv[])
 #define OnQuit   DgeXOnQuit
 #define OnExit   DgeXOnExit
 
+#ifdef DGEX_USE_FIXED_UPDATE
+#define OnFixedUpdate DgeXOnFixedUpdate
+#endif
+
 #else
 
 #define main DgeXMain
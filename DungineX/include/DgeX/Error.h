@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -34,5 +34,9 @@ typedef int dgex_error_t;
 #define DGEX_ERROR_RENDERER_INIT     (DGEX_ERROR_GRAPHICS(4))
 #define DGEX_ERROR_RENDERER_API_INIT (DGEX_ERROR_GRAPHICS(5))
 
+#define DGEX_ERROR_RESOURCE_LOAD   (DGEX_ERROR_RESOURCE(1))
+#define DGEX_ERROR_RESOURCE_FORMAT (DGEX_ERROR_RESOURCE(2))
+#define DGEX_ERROR_RESOURCE_SAVE   (DGEX_ERROR_RESOURCE(3))
+
 #define DGEX_ERROR_CUSTOM_INIT  (DGEX_ERROR_CUSTOM(1))
 #define DGEX_ERROR_CUSTOM_START (DGEX_ERROR_CUSTOM(2))
@@ -0,0 +1,112 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : MainLoop.h                                *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * How the main loop runs frames.                                             *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+DGEX_BEGIN
+
+/**
+ * Main loop properties.
+ */
+struct MainLoopProperties
+{
+    // Run OnUpdate of the next frame on a simulation thread, while the
+    // main thread renders and presents the current one.
+    //
+    // OnUpdate then draws into an ordered renderer set for it, so draws
+    // are kept by z index. It replaces the current renderer set in OnStart,
+    // keeping its GroupByTexture, but not PartialRedraw, which only takes
+    // draws on the render thread.
+    //
+    // OnUpdate must not call FlushDevice or anything else of the render
+    // thread only, the main loop presents. Neither LoadTexture nor
+    // CreateTexture, use LoadTextureAsync. Render API settings are per
+    // thread, so set them in OnUpdate, not in OnStart.
+    //
+    // Frames are handed off once OnUpdate returns and the main thread
+    // presented the frame before. Only then OnEvent is called for the
+    // events polled meanwhile, so OnEvent and OnUpdate never overlap.
+    bool Pipelined = false;
+
+    // Frames per second to limit to. 0 follows vsync, or the display's
+    // refresh rate if vsync is not supported, and negative means no limit.
+    // The refresh rate is queried again when the window moves to another
+    // display, or the display mode changes.
+    // Waiting sleeps first, then spins the last 2 ms for precision.
+    int TargetFrameRate = 0;
+
+    // Seconds per fixed update, 0 for none.
+    //
+    // OnFixedUpdate is called before OnUpdate as many times as fixed steps
+    // have passed, on the same thread, so OnUpdate can interpolate between
+    // the last two fixed states by GetInterpolationAlpha. It is defined
+    // like the other callbacks, see DGEX_USE_FIXED_UPDATE.
+    double FixedTimestep = 0.0;
+
+    // Most fixed updates per frame. Beyond it, the game slows down
+    // instead of falling further behind.
+    int MaxFixedUpdates = 5;
+};
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Set main loop properties hint.
+ *
+ * It works as a hint when the main loop starts, so set it in OnInit or
+ * OnStart.
+ *
+ * @param properties Properties of the main loop.
+ */
+DGEX_API void SetMainLoopPropertiesHint(const MainLoopProperties& properties);
+
+/**
+ * @brief Check whether the calling thread runs OnUpdate in pipelined mode.
+ */
+DGEX_API bool IsSimulationThread();
+
+/**
+ * @brief Get seconds per frame, averaged over the last 16 frames.
+ *
+ * Use it to scale variable updates, it does not jitter like one frame.
+ */
+DGEX_API double GetFrameTime();
+
+/**
+ * @brief Get seconds of the last frame alone, at most 0.25.
+ */
+DGEX_API double GetLastFrameTime();
+
+/**
+ * @brief Get frames per second, by the averaged frame time.
+ */
+DGEX_API double GetFrameRate();
+
+/**
+ * @brief Get how far the frame is between the last fixed update and the next.
+ *
+ * @return 0 ~ 1, or 1 if there is no fixed update.
+ */
+DGEX_API double GetInterpolationAlpha();
+
+DGEX_END
@@ -0,0 +1,127 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CachedLayer.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Render target texture that is only redrawn when its content changes.       *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Utils/Types.h"
+
+#include <cstdint>
+
+DGEX_BEGIN
+
+class Texture;
+
+/**
+ * @brief A texture whose content is drawn with the draw API, and cached.
+ *
+ * Draw the content between Begin and End. Commands are only recorded and
+ * hashed, and End renders them to the texture only if the layer is
+ * dirty, or the hash differs from the last rendered one. Then draw the
+ * texture as usual, which costs a single quad. Content is drawn in the
+ * space of the layer, so the current transform is put aside until End.
+ *
+ * Textures are hashed by address, so if a texture drawn in the layer
+ * changes its pixels, e.g. another layer, mark the layer dirty. If the
+ * content is expensive even to record, check IsDirty and skip Begin and
+ * End altogether, the texture keeps the last content.
+ *
+ * Begin and End must be on the render thread.
+ */
+class CachedLayer
+{
+public:
+    CachedLayer() = default;
+    CachedLayer(const CachedLayer& other) = delete;
+    CachedLayer(CachedLayer&& other) noexcept = delete;
+    CachedLayer& operator=(const CachedLayer& other) = delete;
+    CachedLayer& operator=(CachedLayer&& other) noexcept = delete;
+
+    virtual ~CachedLayer() = default;
+
+    /**
+     * @brief Start recording the content.
+     */
+    DGEX_API virtual void Begin() = 0;
+
+    /**
+     * @brief Stop recording, and render the content if changed.
+     *
+     * @return Whether the texture is rendered again.
+     */
+    DGEX_API virtual bool End() = 0;
+
+    /**
+     * @brief Force the content to be rendered on the next End.
+     */
+    DGEX_API virtual void MarkDirty() = 0;
+
+    /**
+     * @brief Check whether the layer is marked dirty.
+     *
+     * A new layer is dirty, since it has nothing rendered.
+     */
+    DGEX_API virtual bool IsDirty() const = 0;
+
+    /**
+     * @brief Get the cached texture, to draw it.
+     */
+    DGEX_API virtual const Ref<Texture>& GetTexture() const = 0;
+
+    /**
+     * @brief Get the hash of the last rendered content.
+     */
+    DGEX_API virtual uint64_t GetContentHash() const = 0;
+};
+
+/**
+ * @brief Create a cached layer with a transparent texture.
+ *
+ * @param width Width of the layer.
+ * @param height Height of the layer.
+ * @return Created layer, nullptr on failure.
+ */
+DGEX_API Ref<CachedLayer> CreateCachedLayer(int width, int height);
+
+class CachedLayerGuard
+{
+public:
+    DGEX_API explicit CachedLayerGuard(const Ref<CachedLayer>& layer);
+    DGEX_API CachedLayerGuard(const CachedLayerGuard& other) = delete;
+    DGEX_API CachedLayerGuard(CachedLayerGuard&& other) noexcept = delete;
+    DGEX_API CachedLayerGuard& operator=(const CachedLayerGuard& other) = delete;
+    DGEX_API CachedLayerGuard& operator=(CachedLayerGuard&& other) noexcept = delete;
+
+    DGEX_API ~CachedLayerGuard();
+
+private:
+    Ref<CachedLayer> _layer;
+};
+
+/**
+ * @brief Record the content of a cached layer in the current scope.
+ *
+ * Will automatically end the recording when leave the scope, and render
+ * the layer if its content changed.
+ *
+ * @param layer The layer to record.
+ */
+#define RECORD_CACHED_LAYER(layer) CachedLayerGuard __dgex_cached_layer_guard((layer))
+
+DGEX_END
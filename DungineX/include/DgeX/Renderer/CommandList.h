@@ -0,0 +1,132 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandList.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Retained commands recorded once and replayed every frame.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Utils/Types.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief Commands recorded once, and replayed as many times as you like.
+ *
+ * Record with the usual draw API between Begin and End. On End, sprites
+ * are turned into vertices and batched, so that Submit only hands a few
+ * prepared commands to the current renderer. Use it for content that
+ * rarely changes, e.g. HUD or static background.
+ *
+ * Content is recorded without the current transform, and the transform
+ * at Submit applies to it instead, so a baked background can still move
+ * with the camera.
+ *
+ * The list does not own any texture or font it draws, they must outlive
+ * the list, or the list must be invalidated before they go. And a list
+ * submitted to an ordered renderer must stay unchanged until Render.
+ */
+class CommandList
+{
+public:
+    CommandList() = default;
+    CommandList(const CommandList& other) = delete;
+    CommandList(CommandList&& other) noexcept = delete;
+    CommandList& operator=(const CommandList& other) = delete;
+    CommandList& operator=(CommandList&& other) noexcept = delete;
+
+    virtual ~CommandList() = default;
+
+    /**
+     * @brief Start recording, and drop previous content.
+     *
+     * Draw calls on this thread go to the list until End.
+     */
+    DGEX_API virtual void Begin() = 0;
+
+    /**
+     * @brief Stop recording, and bake the recorded commands.
+     */
+    DGEX_API virtual void End() = 0;
+
+    /**
+     * @brief Drop recorded content, so that it needs recording again.
+     */
+    DGEX_API virtual void Invalidate() = 0;
+
+    /**
+     * @brief Check whether the list has recorded content to submit.
+     *
+     * @return False if never recorded or invalidated.
+     */
+    DGEX_API virtual bool IsValid() const = 0;
+
+    /**
+     * @brief Replay baked commands to the current renderer.
+     */
+    DGEX_API virtual void Submit() const = 0;
+
+    /**
+     * @brief Get the number of commands recorded.
+     */
+    DGEX_API virtual size_t GetRecordedCount() const = 0;
+
+    /**
+     * @brief Get the number of commands after baking, i.e. replayed.
+     */
+    DGEX_API virtual size_t GetBakedCount() const = 0;
+};
+
+/**
+ * @brief Create an empty command list.
+ *
+ * If ordered, commands are baked by their z index, otherwise in their
+ * record order. Sprites are batched only if they share texture and z
+ * index, so that the list can still be interleaved with other commands
+ * in an ordered renderer.
+ *
+ * @param properties Same as renderer properties.
+ * @return Created command list.
+ */
+DGEX_API Ref<CommandList> CreateCommandList(const RendererProperties& properties);
+
+class CommandListGuard
+{
+public:
+    DGEX_API explicit CommandListGuard(const Ref<CommandList>& commandList);
+    DGEX_API CommandListGuard(const CommandListGuard& other) = delete;
+    DGEX_API CommandListGuard(CommandListGuard&& other) noexcept = delete;
+    DGEX_API CommandListGuard& operator=(const CommandListGuard& other) = delete;
+    DGEX_API CommandListGuard& operator=(CommandListGuard&& other) noexcept = delete;
+
+    DGEX_API ~CommandListGuard();
+
+private:
+    Ref<CommandList> _commandList;
+};
+
+/**
+ * @brief Record a command list in the current scope.
+ *
+ * Will automatically end the recording when leave the scope.
+ *
+ * @param commandList The command list to record.
+ */
+#define RECORD_COMMAND_LIST(commandList) CommandListGuard __dgex_command_list_guard((commandList))
+
+DGEX_END
@@ -0,0 +1,168 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : ParticleSystem.h                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Particles updated in bulk and drawn one emitter at a time.                 *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Renderer/Color.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Types.h"
+
+#include <cstddef>
+
+DGEX_BEGIN
+
+/**
+ * @brief How an emitter spawns particles, and how they change.
+ *
+ * Ranges are picked at random for each particle when it spawns. Scale
+ * and color go from start to end over the life of a particle.
+ */
+struct ParticleEmitterDesc
+{
+    SubTexture Texture;     // image of a particle, best a region of an atlas
+    size_t Capacity = 1024; // most particles alive at once
+    int Z = 0;              // z index for sorting
+
+    float Rate = 0.0f; // particles spawned per second, 0 for bursts only
+
+    float MinLife = 1.0f; // in seconds
+    float MaxLife = 1.0f;
+    float MinSpeed = 0.0f; // in pixels per second
+    float MaxSpeed = 0.0f;
+    float MinDirection = 0.0f; // in degree, 0 to the right, clockwise
+    float MaxDirection = 360.0f;
+    float MinRotation = 0.0f; // in degree
+    float MaxRotation = 0.0f;
+    float MinSpin = 0.0f; // in degree per second
+    float MaxSpin = 0.0f;
+
+    float GravityX = 0.0f; // in pixels per second squared
+    float GravityY = 0.0f;
+
+    float StartScale = 1.0f;
+    float EndScale = 1.0f;
+    Color StartColor = Color(255, 255, 255);
+    Color EndColor = Color(255, 255, 255);
+};
+
+/**
+ * @brief A source of particles of the same image.
+ *
+ * Storage for all particles is allocated on creation, so that spawning
+ * never allocates. Particles spawned when full are dropped.
+ */
+class ParticleEmitter
+{
+public:
+    ParticleEmitter() = default;
+    ParticleEmitter(const ParticleEmitter& other) = delete;
+    ParticleEmitter(ParticleEmitter&& other) noexcept = delete;
+    ParticleEmitter& operator=(const ParticleEmitter& other) = delete;
+    ParticleEmitter& operator=(ParticleEmitter&& other) noexcept = delete;
+
+    virtual ~ParticleEmitter() = default;
+
+    /**
+     * @brief Move where new particles spawn, live ones stay where they are.
+     */
+    DGEX_API virtual void SetPosition(float x, float y) = 0;
+
+    /**
+     * @brief Set how many particles spawn per second, 0 to stop.
+     */
+    DGEX_API virtual void SetRate(float rate) = 0;
+
+    /**
+     * @brief Spawn particles at once.
+     *
+     * @param count Number of particles to spawn.
+     * @return Number of particles spawned, less if full.
+     */
+    DGEX_API virtual size_t Burst(size_t count) = 0;
+
+    /**
+     * @brief Remove all live particles.
+     */
+    DGEX_API virtual void Clear() = 0;
+
+    DGEX_API virtual size_t GetParticleCount() const = 0;
+    DGEX_API virtual size_t GetCapacity() const = 0;
+};
+
+/**
+ * @brief Particles of many emitters.
+ *
+ * Particles are kept in structure-of-arrays layout, so that they are
+ * updated several at a time with SIMD. Each emitter is drawn as one
+ * prepared geometry, so with an ordered renderer, emitters still mix
+ * with other draws by z index.
+ */
+class ParticleSystem
+{
+public:
+    ParticleSystem() = default;
+    ParticleSystem(const ParticleSystem& other) = delete;
+    ParticleSystem(ParticleSystem&& other) noexcept = delete;
+    ParticleSystem& operator=(const ParticleSystem& other) = delete;
+    ParticleSystem& operator=(ParticleSystem&& other) noexcept = delete;
+
+    virtual ~ParticleSystem() = default;
+
+    /**
+     * @brief Add an emitter.
+     *
+     * @param desc How the emitter spawns particles.
+     * @return The emitter, owned by the system until removed.
+     */
+    DGEX_API virtual Ref<ParticleEmitter> AddEmitter(const ParticleEmitterDesc& desc) = 0;
+
+    /**
+     * @brief Remove an emitter with its particles.
+     */
+    DGEX_API virtual void RemoveEmitter(const Ref<ParticleEmitter>& emitter) = 0;
+
+    /**
+     * @brief Spawn, move and age particles, and remove dead ones.
+     *
+     * @param seconds Time since the last update.
+     */
+    DGEX_API virtual void Update(float seconds) = 0;
+
+    /**
+     * @brief Submit all emitters to the current renderer.
+     *
+     * Vertices are held by the emitters until the next Submit, so submit
+     * at most once for each Render of the renderer. A pipelined main loop
+     * copies them on submission instead.
+     */
+    DGEX_API virtual void Submit() = 0;
+
+    /**
+     * @brief Get the number of live particles of all emitters.
+     */
+    DGEX_API virtual size_t GetParticleCount() const = 0;
+};
+
+/**
+ * @brief Create an empty particle system.
+ */
+DGEX_API Ref<ParticleSystem> CreateParticleSystem();
+
+DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 19, 2025                             *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -22,6 +22,8 @@
 #include "DgeX/Defines.h"
 #include "DgeX/Error.h"
 #include "DgeX/Renderer/Color.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Renderer/Transform.h"
 #include "DgeX/Utils/Macros.h"
 #include "DgeX/Utils/Types.h"
 
@@ -31,8 +33,6 @@ DGEX_BEGIN
 
 class Font;
 class Renderer;
-class Texture;
-class TextureRenderCommandBuilder;
 
 // ============================================================================
 // Render & Target Settings
@@ -49,6 +49,9 @@ dgex_error_t InitRenderApi();
 
 /**
  * @brief Destroy render API.
+ *
+ * Render properties of all threads are reset, so no thread may record
+ * meanwhile.
  */
 void DestroyRenderApi();
 
@@ -57,6 +60,11 @@ void DestroyRenderApi();
  *
  * Use nullptr for default renderer.
  *
+ * The current renderer, like all render properties below, is per thread,
+ * and every thread starts with the defaults. Threads other than the
+ * render thread must record into an ordered renderer, which is rendered
+ * later on the render thread.
+ *
  * @param renderer The renderer to set.
  */
 DGEX_API void SetCurrentRenderer(const Ref<Renderer>& renderer = nullptr);
@@ -95,7 +103,7 @@ private:
 /**
  * @brief Set the current render target for the current renderer.
  *
- * Use nullptr for screen.
+ * Use nullptr for screen. Only on the render thread.
  *
  * @param texture The render target texture.
  */
@@ -136,6 +144,133 @@ private:
 
 #pragma endregion
 
+// ============================================================================
+// View Culling
+// ----------------------------------------------------------------------------
+
+#pragma region View Culling
+
+/**
+ * @brief Statistics of view culling in the last frame.
+ */
+struct CullingStatistics
+{
+    uint32_t KeptCount;   // commands submitted
+    uint32_t CulledCount; // commands dropped for being out of view
+};
+
+/**
+ * @brief Set the view rect to cull draws against.
+ *
+ * Draws completely outside the view are dropped on submit. By default,
+ * the view is the current render target. Text is never culled.
+ *
+ * @param rect The view rect.
+ */
+DGEX_API void SetViewRect(const Rect& rect);
+
+/**
+ * @brief Use the current render target as the view rect again.
+ */
+DGEX_API void ResetViewRect();
+
+/**
+ * @brief Enable or disable view culling, enabled by default.
+ *
+ * @param enabled Whether to cull draws out of view.
+ */
+DGEX_API void SetViewCulling(bool enabled);
+
+DGEX_API bool IsViewCullingEnabled();
+
+/**
+ * @brief Get culling statistics of the last frame, from all threads.
+ *
+ * A frame ends on FlushDevice. Only draws submitted with view culling
+ * enabled are counted.
+ *
+ * @return Culling statistics.
+ */
+DGEX_API CullingStatistics GetCullingStatistics();
+
+#pragma endregion
+
+// ============================================================================
+// Transform
+// ----------------------------------------------------------------------------
+
+#pragma region Transform
+
+/**
+ * @brief Set the current transform.
+ *
+ * All draws are put through the current transform, e.g. a camera. It is
+ * kept in the draw commands and applied to their vertices when they are
+ * batched, so moving the camera costs nothing per draw. Text is only
+ * moved and scaled, not rotated. View culling works on the transformed
+ * draws, i.e. in screen space.
+ *
+ * @param transform The new transform.
+ */
+DGEX_API void SetTransform(const Transform& transform);
+
+DGEX_API Transform GetTransform();
+
+/**
+ * @brief Save the current transform, and combine it with another one.
+ *
+ * The new transform is applied to draws first, then the saved one.
+ *
+ * @param transform The transform to combine.
+ */
+DGEX_API void PushTransform(const Transform& transform);
+
+/**
+ * @brief Restore the transform saved by the last PushTransform.
+ */
+DGEX_API void PopTransform();
+
+/**
+ * @brief Combine translation, rotation or scale with the current transform.
+ *
+ * Same as PushTransform, but without saving.
+ */
+DGEX_API void Translate(float x, float y);
+DGEX_API void Rotate(float degree);
+DGEX_API void Scale(float x, float y);
+
+/**
+ * @brief Combine a transform in the current scope.
+ *
+ * Do not use this directly, use USE_TRANSFORM instead.
+ */
+class TransformGuard
+{
+public:
+    DGEX_API explicit TransformGuard(const Transform& transform);
+    DGEX_API TransformGuard(const TransformGuard& other) = delete;
+    DGEX_API TransformGuard(TransformGuard&& other) noexcept = delete;
+    DGEX_API TransformGuard& operator=(const TransformGuard& other) = delete;
+    DGEX_API TransformGuard& operator=(TransformGuard&& other) noexcept = delete;
+
+    DGEX_API ~TransformGuard();
+};
+
+/**
+ * @brief Combine a transform in the current scope.
+ *
+ * @code
+ * {
+ *     USE_TRANSFORM(Transform::Camera(x, y, zoom, 0.0f, width, height));
+ *     // Draw the world...
+ * }
+ * // Draw the UI...
+ * @endcode
+ */
+#define USE_TRANSFORM(transform) TransformGuard __dgex_transform_guard((transform))
+
+#pragma endregion
+
 // ============================================================================
 // Render Property Settings
 // ----------------------------------------------------------------------------
@@ -350,10 +485,21 @@ DGEX_API void DrawFilledRect(const Rect& rect, int z = 0);
  */
 DGEX_API void DrawTexture(const Ref<Texture>& texture, int x, int y, int z = 0);
 
+/**
+ * @brief Draw a region of a texture, e.g. an image in an atlas.
+ *
+ * @param texture The region to draw.
+ * @param x The x coordinate of the top-left corner of the region.
+ * @param y The y coordinate of the top-left corner of the region.
+ * @param z The z index for sorting.
+ */
+DGEX_API void DrawTexture(const SubTexture& texture, int x, int y, int z = 0);
+
 class DrawTextureClause
 {
 public:
     DrawTextureClause(const Ref<Texture>& texture, int x, int y, int z);
+    DrawTextureClause(const SubTexture& texture, int x, int y, int z);
 
     /**
      * @brief Set extra opacity of the texture.
@@ -361,7 +507,7 @@ public:
      * @param alpha The alpha of the texture.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause Alpha(uint8_t alpha);
+    DGEX_API DrawTextureClause& Alpha(uint8_t alpha);
 
     /**
      * @brief Set the anchor of the texture.
@@ -372,19 +518,19 @@ public:
      * @param y The y coordinate of the center of rotation.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause Anchor(int x, int y);
+    DGEX_API DrawTextureClause& Anchor(int x, int y);
 
     /**
      * Flip the texture horizontally.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause FlipX();
+    DGEX_API DrawTextureClause& FlipX();
 
     /**
      * Flip the texture vertically.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause FlipY();
+    DGEX_API DrawTextureClause& FlipY();
 
     /**
      * @brief Set the rotation of the texture.
@@ -394,7 +540,7 @@ public:
      * @param degree Rotation in degree.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause Rotate(float degree);
+    DGEX_API DrawTextureClause& Rotate(float degree);
 
     /**
      * @brief Set the scale of the texture.
@@ -402,7 +548,18 @@ public:
      * @param scale Scale of the texture.
      * @return Itself.
      */
-    DGEX_API DrawTextureClause Scale(float scale);
+    DGEX_API DrawTextureClause& Scale(float scale);
+
+    /**
+     * @brief Draw only a region of the texture.
+     *
+     * The region is then drawn as if it were the whole texture, so anchor
+     * is relative to it.
+     *
+     * @param region Region in pixels of the texture.
+     * @return Itself.
+     */
+    DGEX_API DrawTextureClause& Source(const Rect& region);
 
     /**
      * @brief Submit draw texture command.
@@ -410,7 +567,22 @@ public:
     DGEX_API void Submit();
 
 private:
-    Ref<TextureRenderCommandBuilder> _builder;
+    TextureHandle _texture;
+    SDL_FPoint _anchor;
+    SDL_FRect _source; // empty for the whole texture
+
+    float _x; // x on the screen
+    float _y; // y on the screen
+    int _z;
+
+    float _scale;  // scale, 1.0 for no scale
+    float _degree; // rotation in degree
+
+    uint8_t _alpha; // alpha value, 0 ~ 255
+
+    bool _flipX : 1;         // flip horizontally
+    bool _flipY : 1;         // flip vertically
+    bool _defaultAnchor : 1; // whether to use default anchor
 };
 
 /**
@@ -424,6 +596,76 @@ private:
  */
 DGEX_API DrawTextureClause DrawTextureBegin(const Ref<Texture>& texture, int x, int y, int z = 0);
 
+/**
+ * @brief Draw a region of a texture with additional properties.
+ *
+ * @param texture The region to draw.
+ * @param x The x coordinate of the top-left corner of the region.
+ * @param y The y coordinate of the top-left corner of the region.
+ * @param z The z index for sorting.
+ * @return Fluent-API style actions.
+ */
+DGEX_API DrawTextureClause DrawTextureBegin(const SubTexture& texture, int x, int y, int z = 0);
+
+/**
+ * @brief Borders of a nine-slice image, in pixels of the texture.
+ */
+struct NineSliceBorder
+{
+    int Left;
+    int Top;
+    int Right;
+    int Bottom;
+};
+
+/**
+ * @brief Stretch a texture to a rectangle, keeping its borders.
+ *
+ * The texture is cut into 3x3 parts by the borders. Corners keep their
+ * size, edges stretch along their side and the center fills the rest, so
+ * that one image frames panels of any size. Borders shrink to fit if the
+ * rectangle is too small for them. All parts are drawn in one call.
+ *
+ * @param texture The texture to draw.
+ * @param rect Where to draw the texture.
+ * @param border Borders of the texture.
+ * @param z The z index for sorting.
+ */
+DGEX_API void DrawNineSlice(const Ref<Texture>& texture, const Rect& rect, const NineSliceBorder& border, int z = 0);
+
+/**
+ * @brief Stretch a region of a texture to a rectangle, keeping its borders.
+ *
+ * @param texture The region to draw, borders are inside it.
+ * @param rect Where to draw the region.
+ * @param border Borders of the region.
+ * @param z The z index for sorting.
+ */
+DGEX_API void DrawNineSlice(const SubTexture& texture, const Rect& rect, const NineSliceBorder& border, int z = 0);
+
+/**
+ * @brief Fill a rectangle with copies of a texture.
+ *
+ * Copies start at the top-left corner, and the last row and column are
+ * cut at the edges of the rectangle. All copies are drawn in one call.
+ * With view culling, only copies in view are drawn. Either way, nothing
+ * is drawn if that is more than 65536 copies.
+ *
+ * @param texture The texture to repeat.
+ * @param rect The rectangle to fill.
+ * @param z The z index for sorting.
+ */
+DGEX_API void DrawTiled(const Ref<Texture>& texture, const Rect& rect, int z = 0);
+
+/**
+ * @brief Fill a rectangle with copies of a region of a texture.
+ *
+ * @param texture The region to repeat.
+ * @param rect The rectangle to fill.
+ * @param z The z index for sorting.
+ */
+DGEX_API void DrawTiled(const SubTexture& texture, const Rect& rect, int z = 0);
+
 #pragma endregion
 
 // ============================================================================
@@ -448,8 +690,6 @@ enum : unsigned char
 /**
  * @brief Render text according to a point.
  *
- * @warning The text should be valid until the next rendering.
- *
  * @param text Text to render.
  * @param x The x coordinate to render the text.
  * @param y The y coordinate to render the text.
@@ -460,8 +700,6 @@ DGEX_API void DrawText(const char* text, int x, int y, TextFlags flags);
 /**
  * @brief Render text in a rectangle area.
  *
- * @warning The text should be valid until the next rendering.
- *
  * @param text Text to render.
  * @param x The x coordinate of the top-left corner of the area.
  * @param y The y coordinate of the top-left corner of the area.
@@ -474,8 +712,6 @@ DGEX_API void DrawTextArea(const char* text, int x, int y, int width, int height
 /**
  * @brief Render text in a rectangle area.
  *
- * @warning The text should be valid until the next rendering.
- *
  * @param text Text to render.
  * @param rect The text area.
  * @param flags Controls how to render the text.
@@ -0,0 +1,134 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : StaticSpriteWorld.h                       *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Spatial index of static sprites, drawing only the visible ones.            *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Renderer/Color.h"
+#include "DgeX/Utils/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+DGEX_BEGIN
+
+class Texture;
+
+/**
+ * @brief How to draw a static sprite, same as DrawTextureBegin.
+ */
+struct StaticSpriteDesc
+{
+    Ref<DgeX::Texture> Texture; // qualified, since the member hides the type
+    Rect Source = Rect();       // region of the texture, whole texture if empty
+    int X = 0; // x of the top-left corner
+    int Y = 0; // y of the top-left corner
+    int Z = 0; // z index for sorting
+
+    float Scale = 1.0f;  // scale around the center
+    float Degree = 0.0f; // rotation around the center
+    uint8_t Alpha = DGEX_COLOR_OPAQUE;
+};
+
+/**
+ * @brief A world of sprites that do not move.
+ *
+ * Sprites are kept in a uniform grid by their bounds, so that finding
+ * the visible ones costs in proportion to the view, not the world. Their
+ * vertices are prepared when added, so drawing them is mostly copying.
+ */
+class StaticSpriteWorld
+{
+public:
+    StaticSpriteWorld() = default;
+    StaticSpriteWorld(const StaticSpriteWorld& other) = delete;
+    StaticSpriteWorld(StaticSpriteWorld&& other) noexcept = delete;
+    StaticSpriteWorld& operator=(const StaticSpriteWorld& other) = delete;
+    StaticSpriteWorld& operator=(StaticSpriteWorld&& other) noexcept = delete;
+
+    virtual ~StaticSpriteWorld() = default;
+
+    /**
+     * @brief Add a sprite to the world.
+     *
+     * @param desc How to draw the sprite.
+     * @return Id of the sprite, for removal.
+     */
+    DGEX_API virtual uint32_t Add(const StaticSpriteDesc& desc) = 0;
+
+    /**
+     * @brief Remove a sprite, its id may be reused later.
+     *
+     * @param id Id of the sprite.
+     */
+    DGEX_API virtual void Remove(uint32_t id) = 0;
+
+    /**
+     * @brief Remove all sprites.
+     */
+    DGEX_API virtual void Clear() = 0;
+
+    /**
+     * @brief Find sprites whose bounds intersect the view.
+     *
+     * @param view The view rect.
+     * @param ids Ids of visible sprites, in no particular order.
+     */
+    DGEX_API virtual void Query(const Rect& view, std::vector<uint32_t>& ids) = 0;
+
+    /**
+     * @brief Submit visible sprites to the current renderer.
+     *
+     * Visible sprites are sorted by z index, and drawn as one prepared
+     * geometry per run of the same texture and z index. So with an
+     * ordered renderer, they still mix with other draws by z index.
+     *
+     * Vertices are held by the world until the next Submit, so submit at
+     * most once for each Render of the renderer. A pipelined main loop
+     * copies them on submission instead.
+     *
+     * @param view The view rect.
+     */
+    DGEX_API virtual void Submit(const Rect& view) = 0;
+
+    /**
+     * @brief Get the number of sprites in the world.
+     */
+    DGEX_API virtual size_t GetSpriteCount() const = 0;
+
+    /**
+     * @brief Get the number of sprites drawn by the last Submit.
+     */
+    DGEX_API virtual size_t GetVisibleCount() const = 0;
+};
+
+/**
+ * @brief Create an empty static sprite world.
+ *
+ * Cell size is best a few times the typical sprite size. Sprites of the
+ * same z index but different textures are reordered to group textures
+ * only if groupByTexture is set, otherwise they keep their add order.
+ *
+ * @param cellSize Size of grid cells, in pixels.
+ * @param groupByTexture Whether to reorder for fewer draw calls.
+ * @return Created world.
+ */
+DGEX_API Ref<StaticSpriteWorld> CreateStaticSpriteWorld(int cellSize, bool groupByTexture);
+
+DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 19, 2025                             *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -28,31 +28,113 @@
 
 DGEX_BEGIN
 
+/**
+ * @brief Compact reference to a registered texture.
+ *
+ * Render commands hold handles instead of SDL textures. Once the texture
+ * is destroyed, its slot gets a new generation, so that stale handles
+ * resolve to nothing instead of a dangling pointer.
+ */
+struct TextureHandle
+{
+    uint32_t Index;
+    uint32_t Generation; // 0 for invalid handle
+
+    bool IsValid() const
+    {
+        return Generation != 0;
+    }
+
+    bool operator==(const TextureHandle& other) const
+    {
+        return (Index == other.Index) && (Generation == other.Generation);
+    }
+
+    bool operator!=(const TextureHandle& other) const
+    {
+        return !(*this == other);
+    }
+};
+
 /**
  * @brief A wrapper for SDL_Texture.
  *
  * We do not allow copying textures, which will lead to uncontrolled
  * texture duplication, making it hard to recycle textures.
+ *
+ * Size and format are cached on creation. Destruction is deferred until
+ * the last frame that used the texture has been rendered.
+ *
+ * Textures loaded from a file may be evicted to stay within the memory
+ * budget, see SetTextureMemoryBudget, and are loaded again when drawn.
  */
 class Texture
 {
 public:
-    explicit Texture(SDL_Texture* texture);
+    /**
+     * @param texture Native texture to own.
+     * @param source File it is loaded from, so that it can be evicted and
+     *               loaded again, empty to keep it in memory.
+     */
+    explicit Texture(SDL_Texture* texture, const std::string& source = std::string());
     Texture(const Texture& other) = delete;
     Texture(Texture&& other) noexcept = delete;
     Texture& operator=(const Texture& other) = delete;
     Texture& operator=(Texture&& other) noexcept = delete;
 
-    ~Texture() = default;
+    ~Texture();
 
     DGEX_API int GetWidth() const;
     DGEX_API int GetHeight() const;
+    DGEX_API SDL_PixelFormat GetFormat() const;
+
+    /**
+     * @brief Check whether the texture is in memory, or evicted.
+     */
+    DGEX_API bool IsResident() const;
 
+    /**
+     * @brief Get the estimated memory it takes when resident, in bytes.
+     */
+    DGEX_API size_t GetMemorySize() const;
+
+    /**
+     * @brief Get the number of smaller variants, see TextureVariantOptions.
+     */
+    DGEX_API int GetVariantCount() const;
+
+    TextureHandle GetHandle() const;
+
+    /**
+     * @brief Get the native texture, a transparent fallback while evicted.
+     */
     SDL_Texture* GetNativeTexture() const;
+
+    /**
+     * @brief Release the texture.
+     *
+     * Commands already queued still draw it, and the native texture is
+     * destroyed once they are rendered.
+     */
     void Destroy();
 
 private:
-    SDL_Texture* _texture;
+    TextureHandle _handle;
+    int _width;
+    int _height;
+    SDL_PixelFormat _format;
+};
+
+/**
+ * @brief A region of a texture, drawn as if it were a texture itself.
+ *
+ * Usually a packed image in an atlas page, see TextureAtlas. Sprites
+ * from the same page can be batched together.
+ */
+struct SubTexture
+{
+    Ref<DgeX::Texture> Texture; // qualified, since the member hides the type
+    Rect Region = Rect();       // in pixels of the texture
 };
 
 // ============================================================================
@@ -62,10 +144,16 @@ private:
 /**
  * @brief Load texture from file.
  *
- * Currently, support only JPEG, PNG and SVG.
+ * Currently, support only JPEG, PNG, SVG and engine texture files, see
+ * ConvertTexture. The file is read and decoded right away, on the render
+ * thread only, see LoadTextureAsync to do it in the background.
+ *
+ * Textures are cached by path, so loading the same file again returns
+ * the same texture without decoding, until PurgeTextureCache.
  *
  * @param path Path to the image to load.
- * @return Loaded texture, nullptr on failure.
+ * @return Loaded texture, shared with other loads of the file, nullptr on
+ *         failure.
  */
 DGEX_API Ref<Texture> LoadTexture(const std::string& path);
 
@@ -73,6 +161,7 @@ DGEX_API Ref<Texture> LoadTexture(const std::string& path);
  * @brief Create a plain texture by width and height.
  *
  * Currently, it will create full ARGB texture that can be used as target.
+ * Only on the render thread.
  *
  * @return Texture.
  */
@@ -0,0 +1,110 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureAtlas.h                            *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Runtime texture atlas that packs images into large pages.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Types.h"
+
+#include <string>
+
+DGEX_BEGIN
+
+/**
+ * @brief How full a page of an atlas is.
+ */
+struct TextureAtlasPageStatistics
+{
+    int Width;
+    int Height;
+    int ImageCount;
+    int64_t UsedArea; // in pixels, padding excluded
+    float Occupancy;  // UsedArea over page area, 0 ~ 1
+};
+
+/**
+ * @brief Pack many small images into a few large textures.
+ *
+ * Each image is copied into a page, and drawn with the SubTexture
+ * returned, so that sprites on the same page batch into one draw call.
+ * Images can be added at any time. They go to the first page with room,
+ * or to a new page, and never move once packed, so regions handed out
+ * stay valid for the lifetime of the atlas.
+ *
+ * Pages are render targets, so Add must be on the render thread.
+ */
+class TextureAtlas
+{
+public:
+    TextureAtlas() = default;
+    TextureAtlas(const TextureAtlas& other) = delete;
+    TextureAtlas(TextureAtlas&& other) noexcept = delete;
+    TextureAtlas& operator=(const TextureAtlas& other) = delete;
+    TextureAtlas& operator=(TextureAtlas&& other) noexcept = delete;
+
+    virtual ~TextureAtlas() = default;
+
+    /**
+     * @brief Copy a texture into the atlas.
+     *
+     * The texture can be destroyed afterward.
+     *
+     * @param texture The texture to pack.
+     * @return Region of the image, with null texture on failure.
+     */
+    DGEX_API virtual SubTexture Add(const Ref<Texture>& texture) = 0;
+
+    /**
+     * @brief Load an image and pack it, see LoadTexture.
+     *
+     * @param path Path to the image to load.
+     * @return Region of the image, with null texture on failure.
+     */
+    DGEX_API virtual SubTexture Add(const std::string& path) = 0;
+
+    DGEX_API virtual int GetPageCount() const = 0;
+
+    /**
+     * @brief Get the texture of a page.
+     */
+    DGEX_API virtual const Ref<Texture>& GetPage(int index) const = 0;
+
+    DGEX_API virtual TextureAtlasPageStatistics GetPageStatistics(int index) const = 0;
+
+    /**
+     * @brief Get the occupancy of all pages together, 0 ~ 1.
+     */
+    DGEX_API virtual float GetOccupancy() const = 0;
+};
+
+/**
+ * @brief Create an empty texture atlas.
+ *
+ * Images larger than a page cannot be packed. Padding is left between
+ * images, so that filtering does not bleed neighbors into each other.
+ *
+ * @param pageWidth Width of each page.
+ * @param pageHeight Height of each page.
+ * @param padding Transparent pixels between images.
+ * @return Created atlas.
+ */
+DGEX_API Ref<TextureAtlas> CreateTextureAtlas(int pageWidth = 2048, int pageHeight = 2048, int padding = 1);
+
+DGEX_END
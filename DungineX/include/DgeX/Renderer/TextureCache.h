@@ -0,0 +1,78 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureCache.h                            *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Share textures loaded from the same file.                                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief How well textures are shared, see LoadTexture.
+ */
+struct TextureCacheStatistics
+{
+    size_t EntryCount;        // paths cached
+    size_t UnreferencedCount; // entries only held by the cache
+    uint64_t Hits;
+    uint64_t Misses;
+    uint64_t ContentHits; // misses sharing a texture of identical content
+    uint64_t Purged;      // entries purged since start
+
+    /**
+     * @brief Get the fraction of loads that skipped decoding, 0 ~ 1.
+     */
+    float GetHitRate() const
+    {
+        uint64_t total = Hits + Misses;
+        return total > 0 ? static_cast<float>(Hits + ContentHits) / static_cast<float>(total) : 0.0f;
+    }
+};
+
+// ============================================================================
+// Texture Cache API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Remove textures no one else holds from the cache.
+ *
+ * Cached textures stay in the cache until purged, so that loading them
+ * again is free, e.g. between levels sharing sprite sheets. Purge after
+ * unloading a level to free them.
+ *
+ * @return Number of entries removed.
+ */
+DGEX_API size_t PurgeTextureCache();
+
+/**
+ * @brief Also share textures of different files with identical content.
+ *
+ * Files are read and hashed before decoding, which costs little next to
+ * decoding. Off by default. Applies to LoadTexture only.
+ */
+DGEX_API void SetTextureContentHashing(bool enabled);
+
+DGEX_API bool IsTextureContentHashing();
+
+DGEX_API TextureCacheStatistics GetTextureCacheStatistics();
+
+DGEX_END
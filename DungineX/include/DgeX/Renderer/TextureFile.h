@@ -0,0 +1,77 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureFile.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Engine texture files that load without decoding.                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Error.h"
+
+#include <SDL3/SDL.h>
+
+#include <string>
+
+DGEX_BEGIN
+
+/**
+ * @brief Extension of engine texture files.
+ */
+constexpr const char* TEXTURE_FILE_EXTENSION = ".dtex";
+
+/**
+ * @brief How pixels are stored in a texture file.
+ */
+enum class TextureCompression : uint8_t
+{
+    None, // raw pixels, memory mapped and uploaded as they are
+    Qoi,  // about PNG size, decoded several times faster than PNG
+};
+
+struct TextureConvertOptions
+{
+    // Pixel format to store, 32-bit only. Unknown for the one preferred
+    // by the renderer, or ARGB8888 if there is no renderer yet.
+    SDL_PixelFormat Format = SDL_PIXELFORMAT_UNKNOWN;
+
+    // Store premultiplied alpha, drawn with the premultiplied blend mode.
+    bool Premultiply = false;
+
+    TextureCompression Compression = TextureCompression::None;
+};
+
+// ============================================================================
+// Texture File API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Convert an image to an engine texture file.
+ *
+ * The image is decoded and converted once here, e.g. at build time, so
+ * that LoadTexture only has to copy pixels to the GPU. LoadTexture tells
+ * texture files by their header, whatever the extension, but only maps
+ * files with TEXTURE_FILE_EXTENSION into memory.
+ *
+ * @param source Path to a JPEG, PNG or SVG image.
+ * @param destination Path to the texture file to write.
+ * @param options How to store the pixels.
+ * @return 0 on success, failure otherwise.
+ */
+DGEX_API dgex_error_t ConvertTexture(const std::string& source, const std::string& destination,
+                                     const TextureConvertOptions& options = TextureConvertOptions());
+
+DGEX_END
@@ -0,0 +1,155 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureLoader.h                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Load textures in the background.                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Types.h"
+
+#include <string>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief A texture being loaded in the background.
+ *
+ * Files are read and decoded on worker threads, then uploaded on the
+ * render thread at the end of frames, a few at a time, see
+ * SetTextureUploadBudget. Until then, GetTexture returns a transparent
+ * placeholder, so it can be drawn right away. Get the texture again each
+ * frame instead of keeping it.
+ */
+class AsyncTexture
+{
+public:
+    AsyncTexture() = default;
+    AsyncTexture(const AsyncTexture& other) = delete;
+    AsyncTexture(AsyncTexture&& other) noexcept = delete;
+    AsyncTexture& operator=(const AsyncTexture& other) = delete;
+    AsyncTexture& operator=(AsyncTexture&& other) noexcept = delete;
+
+    virtual ~AsyncTexture() = default;
+
+    /**
+     * @brief Check whether loading is over, either loaded or failed.
+     */
+    DGEX_API virtual bool IsDone() const = 0;
+
+    /**
+     * @brief Check whether the texture is loaded.
+     */
+    DGEX_API virtual bool IsLoaded() const = 0;
+
+    /**
+     * @brief Get the texture, or the placeholder if not loaded.
+     */
+    DGEX_API virtual Ref<Texture> GetTexture() const = 0;
+
+    DGEX_API virtual const std::string& GetPath() const = 0;
+};
+
+/**
+ * @brief Progress of textures loaded together, e.g. for a loading screen.
+ */
+struct TextureLoadProgress
+{
+    int Total;
+    int Loaded;
+    int Failed;
+
+    /**
+     * @brief Get the fraction of textures done, 0 ~ 1.
+     */
+    float GetFraction() const
+    {
+        return Total > 0 ? static_cast<float>(Loaded + Failed) / static_cast<float>(Total) : 1.0f;
+    }
+
+    bool IsDone() const
+    {
+        return Loaded + Failed == Total;
+    }
+};
+
+/**
+ * @brief Textures loaded together.
+ */
+class AsyncTextureBatch
+{
+public:
+    AsyncTextureBatch() = default;
+    AsyncTextureBatch(const AsyncTextureBatch& other) = delete;
+    AsyncTextureBatch(AsyncTextureBatch&& other) noexcept = delete;
+    AsyncTextureBatch& operator=(const AsyncTextureBatch& other) = delete;
+    AsyncTextureBatch& operator=(AsyncTextureBatch&& other) noexcept = delete;
+
+    virtual ~AsyncTextureBatch() = default;
+
+    DGEX_API virtual size_t GetCount() const = 0;
+
+    /**
+     * @brief Get a texture, in the order of the paths given.
+     */
+    DGEX_API virtual const Ref<AsyncTexture>& Get(size_t index) const = 0;
+
+    DGEX_API virtual TextureLoadProgress GetProgress() const = 0;
+};
+
+// ============================================================================
+// Async Texture API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Load a texture in the background.
+ *
+ * Must be called on the render thread, as LoadTexture.
+ *
+ * @param path Path to the image to load.
+ * @return The texture being loaded.
+ */
+DGEX_API Ref<AsyncTexture> LoadTextureAsync(const std::string& path);
+
+/**
+ * @brief Load textures in the background, and track them together.
+ *
+ * @param paths Paths to the images to load.
+ * @return The textures being loaded.
+ */
+DGEX_API Ref<AsyncTextureBatch> LoadTexturesAsync(const std::vector<std::string>& paths);
+
+/**
+ * @brief Set how long uploads may take at the end of each frame.
+ *
+ * At least one texture is uploaded per frame, so that loading always
+ * moves on. By default, it is 4 milliseconds.
+ *
+ * @param milliseconds Upload time per frame.
+ */
+DGEX_API void SetTextureUploadBudget(float milliseconds);
+
+DGEX_API float GetTextureUploadBudget();
+
+/**
+ * @brief Get the number of textures not yet done.
+ */
+DGEX_API int GetPendingTextureCount();
+
+DGEX_END
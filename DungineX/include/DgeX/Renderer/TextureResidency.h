@@ -0,0 +1,64 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureResidency.h                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Keep textures in memory within a budget.                                   *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief Memory taken by textures, and how often they are evicted.
+ */
+struct TextureResidencyStatistics
+{
+    size_t ResidentBytes; // estimated, of textures in memory
+    size_t BudgetBytes;   // 0 if unlimited
+    size_t EvictedCount;  // textures evicted right now
+    uint64_t Evictions;   // since start
+    uint64_t Reloads;     // since start
+};
+
+// ============================================================================
+// Texture Residency API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Set how much memory textures may take.
+ *
+ * When over budget at the end of a frame, textures loaded from files are
+ * evicted, least recently drawn first. An evicted texture is drawn as
+ * transparent, and loaded again in the background once it is drawn, see
+ * SetTextureUploadBudget. Render targets and textures drawn in the last
+ * frame are never evicted, so the budget may be exceeded.
+ *
+ * Memory is estimated from size and format. By default, it is unlimited.
+ *
+ * @param bytes Memory budget in bytes, 0 for unlimited.
+ */
+DGEX_API void SetTextureMemoryBudget(size_t bytes);
+
+DGEX_API size_t GetTextureMemoryBudget();
+
+DGEX_API TextureResidencyStatistics GetTextureResidencyStatistics();
+
+DGEX_END
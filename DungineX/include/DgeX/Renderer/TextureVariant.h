@@ -0,0 +1,61 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureVariant.h                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Pre-scaled variants of textures for drawing them small.                    *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+
+DGEX_BEGIN
+
+/**
+ * @brief How textures loaded from files get smaller variants.
+ *
+ * Each variant is half the size of the previous one, averaged from it on
+ * the CPU when the texture is loaded. A texture drawn at half its size or
+ * less then uses the smallest variant still sharp enough, which looks
+ * smoother and reads less memory than sampling the full texture.
+ */
+struct TextureVariantOptions
+{
+    bool Enabled = false;
+    int MinSize = 16;    // no variant narrower or shorter than this
+    size_t MaxBytes = 0; // per texture, for all its variants, 0 if unlimited
+};
+
+// ============================================================================
+// Texture Variant API
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Set how variants are generated.
+ *
+ * Only affects textures loaded afterward, with LoadTexture or
+ * LoadTextureAsync. Variants that do not fit in MaxBytes are skipped,
+ * largest first, so that the smallest ones are kept. Render targets and
+ * atlas pages never have variants.
+ *
+ * @param options Variant options.
+ */
+DGEX_API void SetTextureVariantOptions(const TextureVariantOptions& options);
+
+DGEX_API TextureVariantOptions GetTextureVariantOptions();
+
+DGEX_END
@@ -0,0 +1,141 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Tilemap.h                                 *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Grid of tiles in chunks, drawing only the visible chunks.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Types.h"
+
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief Tile of no image, so that nothing is drawn.
+ *
+ * Other tiles count from 1, tile n being the n-th tile of the tileset,
+ * left to right, then top to bottom.
+ */
+#define DGEX_EMPTY_TILE 0
+
+/**
+ * @brief How a tilemap is laid out.
+ */
+struct TilemapDesc
+{
+    SubTexture Tileset;  // tiles in rows, best a region of an atlas
+    int TileWidth = 16;  // in pixels, same in the tileset and the world
+    int TileHeight = 16; // in pixels, same in the tileset and the world
+    int Width = 0;       // in tiles
+    int Height = 0;      // in tiles
+    int ChunkSize = 16;  // in tiles along each side
+    int X = 0;           // x of the top-left corner in the world
+    int Y = 0;           // y of the top-left corner in the world
+};
+
+/**
+ * @brief Layers of tiles on the same grid.
+ *
+ * Tiles are kept in square chunks, and each chunk keeps the vertices of
+ * its tiles, so that drawing a chunk is a single prepared geometry. Only
+ * chunks whose tiles changed are prepared again, and only when they are
+ * visible.
+ */
+class Tilemap
+{
+public:
+    Tilemap() = default;
+    Tilemap(const Tilemap& other) = delete;
+    Tilemap(Tilemap&& other) noexcept = delete;
+    Tilemap& operator=(const Tilemap& other) = delete;
+    Tilemap& operator=(Tilemap&& other) noexcept = delete;
+
+    virtual ~Tilemap() = default;
+
+    /**
+     * @brief Add an empty layer above the existing ones.
+     *
+     * @param z Z index of all tiles of the layer.
+     * @return Index of the layer.
+     */
+    DGEX_API virtual int AddLayer(int z) = 0;
+
+    /**
+     * @brief Set a tile, DGEX_EMPTY_TILE to remove it.
+     *
+     * @param layer Index of the layer.
+     * @param x Column of the tile.
+     * @param y Row of the tile.
+     * @param tile Tile in the tileset.
+     */
+    DGEX_API virtual void SetTile(int layer, int x, int y, uint16_t tile) = 0;
+
+    /**
+     * @brief Get a tile, DGEX_EMPTY_TILE if outside the map.
+     */
+    DGEX_API virtual uint16_t GetTile(int layer, int x, int y) const = 0;
+
+    /**
+     * @brief Set all tiles in an area, the part outside the map is ignored.
+     *
+     * @param layer Index of the layer.
+     * @param area Area in tiles.
+     * @param tile Tile in the tileset.
+     */
+    DGEX_API virtual void Fill(int layer, const Rect& area, uint16_t tile) = 0;
+
+    /**
+     * @brief Submit visible chunks of all layers to the current renderer.
+     *
+     * Each chunk is one geometry of the z index of its layer, so with an
+     * ordered renderer, layers still mix with other draws by z index.
+     *
+     * Vertices are held by the chunks until their tiles change, so do not
+     * change tiles between Submit and Render of the renderer. A pipelined
+     * main loop copies them on submission, so tiles may change any time.
+     *
+     * @param view The view rect.
+     */
+    DGEX_API virtual void Submit(const Rect& view) = 0;
+
+    DGEX_API virtual int GetWidth() const = 0;
+    DGEX_API virtual int GetHeight() const = 0;
+    DGEX_API virtual int GetLayerCount() const = 0;
+
+    /**
+     * @brief Get the number of chunks drawn by the last Submit.
+     */
+    DGEX_API virtual size_t GetVisibleChunkCount() const = 0;
+
+    /**
+     * @brief Get the number of chunks prepared again by the last Submit.
+     */
+    DGEX_API virtual size_t GetRebuiltChunkCount() const = 0;
+};
+
+/**
+ * @brief Create a tilemap without layers.
+ *
+ * @param desc How the tilemap is laid out.
+ * @return Created tilemap.
+ */
+DGEX_API Ref<Tilemap> CreateTilemap(const TilemapDesc& desc);
+
+DGEX_END
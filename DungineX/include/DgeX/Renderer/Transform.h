@@ -0,0 +1,98 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Transform.h                               *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * 2D affine transform.                                                       *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief 2D affine transform.
+ *
+ * A point (x, y) is mapped to (A * x + C * y + X, B * x + D * y + Y).
+ * Since y points down on the screen, positive rotation is clockwise, the
+ * same as DrawTextureClause::Rotate.
+ */
+struct Transform
+{
+    float A, B, C, D;
+    float X, Y;
+
+    /**
+     * @brief Identity transform.
+     */
+    DGEX_API Transform();
+    DGEX_API Transform(float a, float b, float c, float d, float x, float y);
+
+    DGEX_API static Transform Translation(float x, float y);
+    DGEX_API static Transform Rotation(float degree);
+    DGEX_API static Transform Scaling(float x, float y);
+
+    /**
+     * @brief Make a camera transform.
+     *
+     * The camera looks at (x, y) in the world, which is placed at the
+     * center of the view, then zoomed and rotated around it.
+     *
+     * @param x X of the world point to look at.
+     * @param y Y of the world point to look at.
+     * @param zoom Zoom, greater than 1 to zoom in.
+     * @param degree Rotation of the world in degree.
+     * @param viewWidth Width of the view, usually the render target.
+     * @param viewHeight Height of the view.
+     * @return World to screen transform.
+     */
+    DGEX_API static Transform Camera(float x, float y, float zoom, float degree, float viewWidth, float viewHeight);
+
+    DGEX_API bool IsIdentity() const;
+
+    /**
+     * @brief Check whether rectangles stay axis-aligned, i.e. no rotation.
+     */
+    DGEX_API bool IsAxisAligned() const;
+
+    /**
+     * @brief Get the inverse transform, e.g. screen to world for a camera.
+     *
+     * @return The inverse, or identity if not invertible.
+     */
+    DGEX_API Transform Inverse() const;
+
+    /**
+     * @brief Transform a point in place.
+     */
+    void Apply(float& x, float& y) const
+    {
+        float tx = A * x + C * y + X;
+        float ty = B * x + D * y + Y;
+        x = tx;
+        y = ty;
+    }
+
+    /**
+     * @brief Combine two transforms.
+     *
+     * @return Transform that applies rhs first, then lhs.
+     */
+    DGEX_API friend Transform operator*(const Transform& lhs, const Transform& rhs);
+    DGEX_API Transform& operator*=(const Transform& rhs);
+};
+
+DGEX_END
@@ -0,0 +1,228 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : DamageTracker.cpp                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Areas of the screen that changed since the last frame.                     *
+ ******************************************************************************/
+
+#include "Device/Graphics/DamageTracker.h"
+
+#include <algorithm>
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief Check whether two rects overlap or share an edge.
+ */
+static bool IsTouching(const SDL_Rect& a, const SDL_Rect& b)
+{
+    return (a.x <= b.x + b.w) && (b.x <= a.x + a.w) && (a.y <= b.y + b.h) && (b.y <= a.y + a.h);
+}
+
+static bool IsOverlapping(const SDL_Rect& a, const SDL_Rect& b)
+{
+    return (a.x < b.x + b.w) && (b.x < a.x + a.w) && (a.y < b.y + b.h) && (b.y < a.y + a.h);
+}
+
+static SDL_Rect GetUnion(const SDL_Rect& a, const SDL_Rect& b)
+{
+    int left = std::min(a.x, b.x);
+    int top = std::min(a.y, b.y);
+    int right = std::max(a.x + a.w, b.x + b.w);
+    int bottom = std::max(a.y + a.h, b.y + b.h);
+    return { left, top, right - left, bottom - top };
+}
+
+static SDL_Rect GetBoundingRect(const std::vector<SDL_Rect>& rects)
+{
+    SDL_Rect bounds = rects.front();
+    for (const SDL_Rect& rect : rects)
+    {
+        bounds = GetUnion(bounds, rect);
+    }
+    return bounds;
+}
+
+DamageTracker::DamageTracker(size_t maxRects) : _maxRects(std::max<size_t>(maxRects, 1)), _invalid(true)
+{
+}
+
+void DamageTracker::Add(uint64_t hash, const SDL_Rect& bounds)
+{
+    _current.push_back({ hash, bounds, static_cast<uint32_t>(_current.size()) });
+}
+
+void DamageTracker::Invalidate()
+{
+    _invalid = true;
+}
+
+void DamageTracker::Resolve(const SDL_Rect& target)
+{
+    _rects.clear();
+
+    if (_invalid)
+    {
+        AddDamage(target, target);
+        _invalid = false;
+    }
+    else
+    {
+        // Same hashes cancel out one for one, like a merge of sorted lists.
+        auto byHash = [](const Entry& a, const Entry& b) {
+            return (a.Hash < b.Hash) || ((a.Hash == b.Hash) && (a.Order < b.Order));
+        };
+        std::sort(_current.begin(), _current.end(), byHash);
+        _matches.clear();
+        size_t i = 0;
+        size_t j = 0;
+        while ((i < _current.size()) || (j < _last.size()))
+        {
+            if (j == _last.size() || ((i < _current.size()) && (_current[i].Hash < _last[j].Hash)))
+            {
+                AddDamage(_current[i++].Bounds, target); // drawn only now
+            }
+            else if (i == _current.size() || (_last[j].Hash < _current[i].Hash))
+            {
+                AddDamage(_last[j++].Bounds, target); // drawn only before
+            }
+            else
+            {
+                _matches.push_back({ _current[i].Order, _last[j].Order, _current[i].Bounds, false });
+                i++;
+                j++;
+            }
+        }
+        AddReorderDamage(target);
+    }
+
+    MergeRects();
+
+    std::swap(_current, _last);
+    _current.clear();
+}
+
+const std::vector<SDL_Rect>& DamageTracker::GetRects() const
+{
+    return _rects;
+}
+
+void DamageTracker::AddDamage(const SDL_Rect& bounds, const SDL_Rect& target)
+{
+    int left = std::max(bounds.x, target.x);
+    int top = std::max(bounds.y, target.y);
+    int right = std::min(bounds.x + bounds.w, target.x + target.w);
+    int bottom = std::min(bounds.y + bounds.h, target.y + target.h);
+    if ((left < right) && (top < bottom))
+    {
+        _rects.push_back({ left, top, right - left, bottom - top });
+    }
+}
+
+void DamageTracker::AddReorderDamage(const SDL_Rect& target)
+{
+    auto byOrder = [](const Match& a, const Match& b) { return a.Order < b.Order; };
+    std::sort(_matches.begin(), _matches.end(), byOrder);
+
+    // Longest run of commands still drawn in their last order. Of any two
+    // commands that swapped, at least one is not in it.
+    _tails.clear();
+    _previous.resize(_matches.size());
+    for (size_t k = 0; k < _matches.size(); k++)
+    {
+        auto byLastOrder = [this](size_t index, uint32_t order) { return _matches[index].LastOrder < order; };
+        auto tail = std::lower_bound(_tails.begin(), _tails.end(), _matches[k].LastOrder, byLastOrder);
+        _previous[k] = (tail == _tails.begin()) ? SIZE_MAX : *(tail - 1);
+        if (tail == _tails.end())
+        {
+            _tails.push_back(k);
+        }
+        else
+        {
+            *tail = k;
+        }
+    }
+    for (size_t k = _tails.empty() ? SIZE_MAX : _tails.back(); k != SIZE_MAX; k = _previous[k])
+    {
+        _matches[k].InOrder = true;
+    }
+
+    // Others are damaged where they swapped with a command they overlap,
+    // or all of them if too many to check one by one.
+    size_t moved = _matches.size() - _tails.size();
+    for (const Match& match : _matches)
+    {
+        if (match.InOrder)
+        {
+            continue;
+        }
+        if (moved > _maxRects * 4)
+        {
+            AddDamage(match.Bounds, target);
+            continue;
+        }
+        for (const Match& other : _matches)
+        {
+            bool swapped = (other.Order < match.Order) != (other.LastOrder < match.LastOrder);
+            if (swapped && IsOverlapping(match.Bounds, other.Bounds))
+            {
+                AddDamage(match.Bounds, target);
+                break;
+            }
+        }
+    }
+}
+
+void DamageTracker::MergeRects()
+{
+    // Too many to merge one by one, and likely spread all over.
+    if (_rects.size() > _maxRects * 4)
+    {
+        _rects.assign(1, GetBoundingRect(_rects));
+        return;
+    }
+
+    // A union may touch rects it did not before, so repeat until stable.
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; i < _rects.size(); i++)
+        {
+            for (size_t j = i + 1; j < _rects.size();)
+            {
+                if (IsTouching(_rects[i], _rects[j]))
+                {
+                    _rects[i] = GetUnion(_rects[i], _rects[j]);
+                    _rects[j] = _rects.back();
+                    _rects.pop_back();
+                    merged = true;
+                }
+                else
+                {
+                    j++;
+                }
+            }
+        }
+    }
+
+    if (_rects.size() > _maxRects)
+    {
+        _rects.assign(1, GetBoundingRect(_rects));
+    }
+}
+
+DGEX_END
@@ -0,0 +1,107 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : DamageTracker.h                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Areas of the screen that changed since the last frame.                     *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Find what changed between two frames by the commands drawn.
+ *
+ * Each command of a frame is added by its hash and bounds. A command of
+ * the same hash in the last frame drew the same pixels, so only bounds
+ * of commands found in one frame but not the other are damaged. So are
+ * bounds of commands drawn in another order relative to one they overlap.
+ */
+class DamageTracker
+{
+public:
+    /**
+     * @param maxRects Most rects after merging, more are merged into one.
+     */
+    explicit DamageTracker(size_t maxRects);
+
+    /**
+     * @brief Add a command of the current frame.
+     *
+     * @param hash Hash of the command content.
+     * @param bounds Pixels the command may touch.
+     */
+    void Add(uint64_t hash, const SDL_Rect& bounds);
+
+    /**
+     * @brief Damage the whole target on the next Resolve.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Compare the current frame with the last one, and start anew.
+     *
+     * Damaged rects are clipped to the target, and merged so that they
+     * do not overlap or touch.
+     *
+     * @param target Rect of the whole target.
+     */
+    void Resolve(const SDL_Rect& target);
+
+    /**
+     * @brief Get the damaged rects of the last Resolve.
+     */
+    const std::vector<SDL_Rect>& GetRects() const;
+
+private:
+    struct Entry
+    {
+        uint64_t Hash;
+        SDL_Rect Bounds;
+        uint32_t Order; // index in the frame it is drawn
+    };
+
+    // Command drawn in both frames.
+    struct Match
+    {
+        uint32_t Order;
+        uint32_t LastOrder;
+        SDL_Rect Bounds;
+        bool InOrder; // in the longest run still in the last order
+    };
+
+    void AddDamage(const SDL_Rect& bounds, const SDL_Rect& target);
+    void AddReorderDamage(const SDL_Rect& target);
+    void MergeRects();
+
+private:
+    std::vector<Entry> _current;
+    std::vector<Entry> _last;
+    std::vector<Match> _matches;
+    std::vector<size_t> _tails;    // last match of the longest runs by length
+    std::vector<size_t> _previous; // match before each one in its run
+    std::vector<SDL_Rect> _rects;
+    size_t _maxRects;
+    bool _invalid; // whole target damaged, e.g. on first frame
+};
+
+DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -20,31 +20,111 @@
 #pragma once
 
 #include "DgeX/Defines.h"
+#include "DgeX/Renderer/Transform.h"
 
 #include <SDL3/SDL.h>
 
+#include <cstddef>
+#include <cstdint>
+
 DGEX_BEGIN
 
+class LinearArena;
+
+/**
+ * @brief Type tag of a render command.
+ */
+enum class RenderCommandType : unsigned char
+{
+    Clear,
+    Point,
+    Line,
+    Rect,
+    FilledRect,
+    Texture,
+    Text,
+    TextArea,
+    Geometry
+};
+
 /**
  * @brief Render command.
+ *
+ * Render commands are plain structs tagged by their type, so that they
+ * can be copied into a linear arena and replayed without any virtual
+ * dispatch or heap allocation. Concrete commands derive from this and
+ * must stay trivially copyable.
+ *
+ * Positions are in the space of Transform, which is applied to vertices
+ * when the command is batched or executed, never when it is built.
  */
-class RenderCommand
+struct RenderCommand
 {
-public:
-    RenderCommand(int order);
-    RenderCommand(const RenderCommand& other) = delete;
-    RenderCommand(RenderCommand&& other) noexcept = delete;
-    RenderCommand& operator=(const RenderCommand& other) = delete;
-    RenderCommand& operator=(RenderCommand&& other) noexcept = delete;
+    RenderCommandType Type;
+    int Order;
+    const DgeX::Transform* Transform = nullptr; // nullptr for identity
+};
 
-    virtual ~RenderCommand() = default;
+/**
+ * @brief Execute a render command.
+ *
+ * @param renderer The native renderer.
+ * @param command The command to execute.
+ */
+void ApplyRenderCommand(SDL_Renderer* renderer, const RenderCommand& command);
 
-    int GetOrder() const;
+/**
+ * @brief Get the sort key of a render command.
+ *
+ * The key has the order (z index) in the high 32 bits, and the material
+ * id in the low 32 bits, so that sorting by key groups commands of the
+ * same texture within a layer. Submission order is kept by sorting the
+ * keys stably.
+ *
+ * @param command The command.
+ * @param groupByMaterial Whether to include the material id.
+ * @return The sort key.
+ */
+uint64_t GetRenderSortKey(const RenderCommand& command, bool groupByMaterial);
 
-    virtual void Apply(SDL_Renderer* renderer) = 0;
+/**
+ * @brief Get the screen area a render command may touch.
+ *
+ * The bounds are conservative, i.e. may be larger than the actual area,
+ * e.g. axis-aligned box of a rotated sprite.
+ *
+ * @param command The command.
+ * @param bounds Bounds of the command, only set on success.
+ * @return False if the command is not bounded, e.g. clear and text.
+ */
+bool GetRenderCommandBounds(const RenderCommand& command, SDL_FRect& bounds);
 
-private:
-    int _order;
-};
+// Initial hash for HashRenderCommand.
+constexpr uint64_t RENDER_COMMAND_HASH_SEED = 0xCBF29CE484222325ull;
+
+/**
+ * @brief Hash the content of a render command.
+ *
+ * Fields are hashed one by one, so padding does not matter. Text and
+ * geometry are hashed by content, while textures and fonts are hashed by
+ * address, so changes inside a texture are not noticed.
+ *
+ * @param command The command.
+ * @param seed Hash to continue from, e.g. of previous commands.
+ * @return The combined hash.
+ */
+uint64_t HashRenderCommand(const RenderCommand& command, uint64_t seed);
+
+/**
+ * @brief Copy a render command into the arena.
+ *
+ * Payloads referenced by the command, e.g. text and transform, are copied
+ * as well.
+ *
+ * @param arena The arena to hold the copy.
+ * @param command The command to copy.
+ * @return The copied command, valid until the arena is reset.
+ */
+RenderCommand* CopyRenderCommand(LinearArena& arena, const RenderCommand& command);
 
 DGEX_END
@@ -0,0 +1,176 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RenderStateCache.cpp                      *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Shadow state of the native renderer to skip redundant state changes.       *
+ ******************************************************************************/
+
+#include "Device/Graphics/RenderStateCache.h"
+
+DGEX_BEGIN
+
+static bool IsSameRect(const SDL_Rect& lhs, const SDL_Rect& rhs)
+{
+    return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.w == rhs.w) && (lhs.h == rhs.h);
+}
+
+RenderStateCache::RenderStateCache(SDL_Renderer* renderer)
+    : _renderer(renderer), _drawColor(), _blendMode(SDL_BLENDMODE_NONE), _target(nullptr), _viewport(), _clipRect(),
+      _drawColorValid(false), _blendModeValid(false), _targetValid(false), _viewportValid(false),
+      _clipRectValid(false), _viewportSet(false), _clipRectEnabled(false), _statistics()
+{
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderDrawColor
+void RenderStateCache::SetDrawColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    bool changed = !_drawColorValid || (_drawColor.r != r) || (_drawColor.g != g) || (_drawColor.b != b) ||
+                   (_drawColor.a != a);
+    if (Count(changed))
+    {
+        SDL_SetRenderDrawColor(_renderer, r, g, b, a);
+        _drawColor = { r, g, b, a };
+        _drawColorValid = true;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderDrawBlendMode
+void RenderStateCache::SetDrawBlendMode(SDL_BlendMode blendMode)
+{
+    if (Count(!_blendModeValid || (_blendMode != blendMode)))
+    {
+        SDL_SetRenderDrawBlendMode(_renderer, blendMode);
+        _blendMode = blendMode;
+        _blendModeValid = true;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetTextureAlphaMod
+void RenderStateCache::SetTextureAlphaMod(SDL_Texture* texture, uint8_t alpha)
+{
+    TextureState& state = _textures[texture];
+    if (Count(!state.AlphaValid || (state.Alpha != alpha)))
+    {
+        SDL_SetTextureAlphaMod(texture, alpha);
+        state.Alpha = alpha;
+        state.AlphaValid = true;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetTextureColorMod
+void RenderStateCache::SetTextureColorMod(SDL_Texture* texture, uint8_t r, uint8_t g, uint8_t b)
+{
+    TextureState& state = _textures[texture];
+    if (Count(!state.ColorValid || (state.R != r) || (state.G != g) || (state.B != b)))
+    {
+        SDL_SetTextureColorMod(texture, r, g, b);
+        state.R = r;
+        state.G = g;
+        state.B = b;
+        state.ColorValid = true;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderTarget
+void RenderStateCache::SetRenderTarget(SDL_Texture* texture)
+{
+    if (Count(!_targetValid || (_target != texture)))
+    {
+        SDL_SetRenderTarget(_renderer, texture);
+        _target = texture;
+        _targetValid = true;
+        _viewportValid = false;
+        _clipRectValid = false;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderViewport
+void RenderStateCache::SetViewport(const SDL_Rect* rect)
+{
+    // An empty rect is a valid viewport, not the same as the entire target.
+    bool set = rect != nullptr;
+    bool changed = !_viewportValid || (_viewportSet != set) || (set && !IsSameRect(_viewport, *rect));
+    if (Count(changed))
+    {
+        SDL_SetRenderViewport(_renderer, rect);
+        _viewport = set ? *rect : SDL_Rect{ 0, 0, 0, 0 };
+        _viewportSet = set;
+        _viewportValid = true;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderClipRect
+void RenderStateCache::SetClipRect(const SDL_Rect* rect)
+{
+    // An empty clip rect clips everything, unlike no clip rect at all.
+    bool enabled = rect != nullptr;
+    bool changed = !_clipRectValid || (_clipRectEnabled != enabled) || (enabled && !IsSameRect(_clipRect, *rect));
+    if (Count(changed))
+    {
+        SDL_SetRenderClipRect(_renderer, rect);
+        _clipRect = enabled ? *rect : SDL_Rect{ 0, 0, 0, 0 };
+        _clipRectEnabled = enabled;
+        _clipRectValid = true;
+    }
+}
+
+void RenderStateCache::Invalidate()
+{
+    InvalidateDrawState();
+    _targetValid = false;
+    _viewportValid = false;
+    _clipRectValid = false;
+    _textures.clear();
+}
+
+void RenderStateCache::InvalidateDrawState()
+{
+    _drawColorValid = false;
+    _blendModeValid = false;
+}
+
+void RenderStateCache::ForgetTexture(SDL_Texture* texture)
+{
+    _textures.erase(texture);
+    if (_target == texture)
+    {
+        _targetValid = false;
+    }
+}
+
+const RenderStateStatistics& RenderStateCache::GetStatistics() const
+{
+    return _statistics;
+}
+
+void RenderStateCache::ResetStatistics()
+{
+    _statistics = {};
+}
+
+bool RenderStateCache::Count(bool changed)
+{
+    if (changed)
+    {
+        _statistics.IssuedCount++;
+    }
+    else
+    {
+        _statistics.ElidedCount++;
+    }
+    return changed;
+}
+
+DGEX_END
@@ -0,0 +1,163 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RenderStateCache.h                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Shadow state of the native renderer to skip redundant state changes.       *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Device/Graphics/Renderer.h"
+
+#include <SDL3/SDL.h>
+
+#include <unordered_map>
+
+DGEX_BEGIN
+
+/**
+ * @brief Remember render states set on the native renderer.
+ *
+ * Every setter compares against the last value it forwarded, and only
+ * calls SDL when the value actually changes. All engine code should set
+ * these states through here, otherwise the shadow state will go stale.
+ * If someone else touches the renderer, call Invalidate.
+ */
+class RenderStateCache
+{
+public:
+    explicit RenderStateCache(SDL_Renderer* renderer);
+    RenderStateCache(const RenderStateCache& other) = delete;
+    RenderStateCache(RenderStateCache&& other) noexcept = delete;
+    RenderStateCache& operator=(const RenderStateCache& other) = delete;
+    RenderStateCache& operator=(RenderStateCache&& other) noexcept = delete;
+
+    ~RenderStateCache() = default;
+
+    void SetDrawColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+    void SetDrawBlendMode(SDL_BlendMode blendMode);
+
+    void SetTextureAlphaMod(SDL_Texture* texture, uint8_t alpha);
+    void SetTextureColorMod(SDL_Texture* texture, uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * @brief Set render target.
+     *
+     * In SDL3, viewport and clip rect belong to the render target, so they
+     * are forgotten on target change.
+     *
+     * @param texture The target, nullptr for the window.
+     */
+    void SetRenderTarget(SDL_Texture* texture);
+
+    /**
+     * @brief Set viewport of the current target.
+     *
+     * @param rect The viewport, nullptr for the entire target.
+     */
+    void SetViewport(const SDL_Rect* rect);
+
+    /**
+     * @brief Set clip rect of the current target.
+     *
+     * @param rect The clip rect, nullptr to disable clipping.
+     */
+    void SetClipRect(const SDL_Rect* rect);
+
+    /**
+     * @brief Forget everything about the renderer.
+     *
+     * Call this when the renderer may be changed without this cache.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Forget draw color and blend mode.
+     *
+     * Cheaper than Invalidate if only the draw state may be changed.
+     */
+    void InvalidateDrawState();
+
+    /**
+     * @brief Forget states of a texture.
+     *
+     * Must be called before a texture is destroyed, since its address may
+     * be reused by a new texture.
+     *
+     * @param texture The texture.
+     */
+    void ForgetTexture(SDL_Texture* texture);
+
+    const RenderStateStatistics& GetStatistics() const;
+    void ResetStatistics();
+
+private:
+    /**
+     * @brief Count a state change request.
+     *
+     * @param changed Whether the state really changed.
+     * @return The same as changed.
+     */
+    bool Count(bool changed);
+
+private:
+    struct TextureState
+    {
+        uint8_t Alpha;
+        uint8_t R, G, B;
+        bool AlphaValid : 1;
+        bool ColorValid : 1;
+    };
+
+    SDL_Renderer* _renderer;
+
+    SDL_Color _drawColor;
+    SDL_BlendMode _blendMode;
+    SDL_Texture* _target;
+    SDL_Rect _viewport; // only meaningful if _viewportSet
+    SDL_Rect _clipRect; // only meaningful if _clipRectEnabled
+
+    bool _drawColorValid : 1;
+    bool _blendModeValid : 1;
+    bool _targetValid : 1;
+    bool _viewportValid : 1;
+    bool _clipRectValid : 1;
+    bool _viewportSet : 1;     // false for the entire target
+    bool _clipRectEnabled : 1; // false for no clipping
+
+    // Only remember what we have set, as we never know what is done to a
+    // texture before we see it.
+    std::unordered_map<SDL_Texture*, TextureState> _textures;
+
+    RenderStateStatistics _statistics;
+};
+
+/**
+ * @brief Get the state cache of the native renderer.
+ *
+ * @return The state cache, valid between InitRenderer and DestroyRenderer.
+ */
+RenderStateCache& GetRenderStateCache();
+
+/**
+ * @brief Forget states of a texture about to be destroyed.
+ *
+ * Unlike GetRenderStateCache, this is safe after the renderer is gone.
+ *
+ * @param texture The texture.
+ */
+void ForgetTextureState(SDL_Texture* texture);
+
+DGEX_END
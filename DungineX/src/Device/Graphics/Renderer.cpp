@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 3, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -20,49 +20,400 @@
 #include "DgeX/Device/Graphics/Renderer.h"
 
 #include "Device/Graphics/RenderCommand.h"
+#include "Device/Graphics/RenderStateCache.h"
 #include "Device/Graphics/RendererImpl.h"
+#include "Renderer/RenderCommandImpl.h"
+#include "Renderer/TextureCacheImpl.h"
+#include "Renderer/TextureLoaderImpl.h"
+#include "Renderer/TextureRegistry.h"
 
 #include "DgeX/Device/Graphics/Window.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
 #include "DgeX/Utils/Assert.h"
 
 #include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
 
 DGEX_BEGIN
 
 static SDL_Renderer* sNativeRenderer = nullptr;
+static Scope<RenderStateCache> sStateCache;
+static std::thread::id sRenderThread;
+static std::atomic<bool> sDamageOutline{ false };
 
 // ============================================================================
 // Concrete Renderers
 // ----------------------------------------------------------------------------
 
-void DirectRenderer::Submit(const Ref<RenderCommand>& command)
+const RendererStatistics& Renderer::GetStatistics() const
 {
-    command->Apply(GetNativeRenderer());
+    return _statistics;
+}
+
+const RendererProperties& Renderer::GetProperties() const
+{
+    return _properties;
+}
+
+void Renderer::Invalidate()
+{
+    // Only partial redraw keeps anything across frames.
+}
+
+DirectRenderer::DirectRenderer() : _pending()
+{
+    _properties = { false, false, false };
+}
+
+void DirectRenderer::Submit(const RenderCommand& command)
+{
+    DGEX_ASSERT(IsRenderThread(), "Direct renderer can only be used on the render thread");
+
+    _batcher.Submit(GetNativeRenderer(), command, _pending);
+    _pending.CommandCount++;
 }
 
 void DirectRenderer::Render()
 {
-    // Nothing.
+    Flush();
+
+    // Commands are already executed, only publish the statistics.
+    _statistics = _pending;
+    _pending = {};
 }
 
-void OrderedRenderer::Submit(const Ref<RenderCommand>& command)
+void DirectRenderer::Flush()
 {
-    _commands.emplace_back(command);
+    if (!_batcher.IsEmpty())
+    {
+        _batcher.Flush(GetNativeRenderer(), _pending);
+    }
+}
+
+static std::atomic<uint64_t> sNextOrderedRendererId{ 1 };
+
+OrderedRenderer::OrderedRenderer(bool groupByTexture)
+    : _id(sNextOrderedRendererId.fetch_add(1, std::memory_order_relaxed)), _groupByTexture(groupByTexture),
+      _pending()
+{
+    _properties = { true, groupByTexture, false };
+}
+
+void OrderedRenderer::Submit(const RenderCommand& command)
+{
+    CommandBuffer& buffer = GetCommandBuffer();
+    buffer.Keys.push_back(GetRenderSortKey(command, _groupByTexture));
+    buffer.Commands.push_back(CopyRenderCommand(buffer.Arena, command));
 }
 
 void OrderedRenderer::Render()
 {
-    std::sort(_commands.begin(), _commands.end(), [](const Ref<RenderCommand>& lhs, const Ref<RenderCommand>& rhs) {
-        return lhs->GetOrder() < rhs->GetOrder();
-    });
+    DGEX_ASSERT(IsRenderThread(), "Ordered renderer can only render on the render thread");
+
+    // Merge all buffers, indices are global across buffers.
+    {
+        std::lock_guard<std::mutex> lock(_bufferMutex);
+        for (const Scope<CommandBuffer>& buffer : _buffers)
+        {
+            auto base = static_cast<uint32_t>(_commands.size());
+            for (size_t i = 0; i < buffer->Keys.size(); i++)
+            {
+                _keys.push_back({ buffer->Keys[i], base + static_cast<uint32_t>(i) });
+            }
+            _commands.insert(_commands.end(), buffer->Commands.begin(), buffer->Commands.end());
+        }
+    }
+
+    _scratch.resize(_keys.size());
+    RadixSort(_keys.data(), _scratch.data(), _keys.size());
+
+    _pending = {};
+    _pending.CommandCount = static_cast<uint32_t>(_commands.size());
 
     auto renderer = GetNativeRenderer();
-    for (const auto& command : _commands)
+    for (const SortKeyEntry& entry : _keys)
     {
-        command->Apply(renderer);
+        _batcher.Submit(renderer, *_commands[entry.Index], _pending);
     }
+    _batcher.Flush(renderer, _pending);
 
+    _statistics = _pending;
+
+    // Capacity of all is kept for the next frame.
     _commands.clear();
+    _keys.clear();
+    {
+        std::lock_guard<std::mutex> lock(_bufferMutex);
+        for (const Scope<CommandBuffer>& buffer : _buffers)
+        {
+            buffer->Commands.clear();
+            buffer->Keys.clear();
+            buffer->Arena.Reset();
+        }
+    }
+}
+
+void OrderedRenderer::Flush()
+{
+    // Nothing is executed before Render.
+}
+
+CommandBuffer& OrderedRenderer::GetCommandBuffer()
+{
+    // Most submissions go to the same renderer as the last one.
+    static thread_local uint64_t sCachedId = 0;
+    static thread_local CommandBuffer* sCachedBuffer = nullptr;
+
+    if (sCachedId == _id)
+    {
+        return *sCachedBuffer;
+    }
+
+    std::thread::id self = std::this_thread::get_id();
+    CommandBuffer* found = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_bufferMutex);
+        for (const Scope<CommandBuffer>& buffer : _buffers)
+        {
+            if (buffer->Owner == self)
+            {
+                found = buffer.get();
+                break;
+            }
+        }
+        if (!found)
+        {
+            _buffers.push_back(CreateScope<CommandBuffer>());
+            found = _buffers.back().get();
+            found->Owner = self;
+        }
+    }
+
+    sCachedId = _id;
+    sCachedBuffer = found;
+
+    return *found;
+}
+
+// ============================================================================
+// Partial Renderer
+// ----------------------------------------------------------------------------
+
+// Damaged rects after merging, more are merged into one.
+static constexpr size_t MAX_DAMAGED_RECTS = 16;
+
+/**
+ * @brief Get pixels a command may touch, the whole target if unknown.
+ *
+ * Rounded outwards with a pixel to spare, for smoothing and rounding.
+ */
+static SDL_Rect GetDamageBounds(const RenderCommand& command, const SDL_Rect& target)
+{
+    SDL_FRect bounds;
+    if (command.Type == RenderCommandType::Geometry)
+    {
+        // Not bounded for culling, as the vertices are many, but they are
+        // hashed anyway, so one more pass is affordable.
+        const auto& geometry = static_cast<const GeometryRenderCommand&>(command);
+        if (geometry.VertexCount == 0)
+        {
+            return { 0, 0, 0, 0 };
+        }
+        SDL_FPoint first = TransformPoint(command, geometry.Vertices[0].position.x, geometry.Vertices[0].position.y);
+        float minX = first.x;
+        float minY = first.y;
+        float maxX = first.x;
+        float maxY = first.y;
+        for (int i = 1; i < geometry.VertexCount; i++)
+        {
+            const SDL_FPoint& position = geometry.Vertices[i].position;
+            SDL_FPoint point = TransformPoint(command, position.x, position.y);
+            minX = std::min(minX, point.x);
+            minY = std::min(minY, point.y);
+            maxX = std::max(maxX, point.x);
+            maxY = std::max(maxY, point.y);
+        }
+        bounds = { minX, minY, maxX - minX, maxY - minY };
+    }
+    else if (!GetRenderCommandBounds(command, bounds))
+    {
+        return target;
+    }
+
+    int left = static_cast<int>(std::floor(bounds.x)) - 1;
+    int top = static_cast<int>(std::floor(bounds.y)) - 1;
+    int right = static_cast<int>(std::ceil(bounds.x + bounds.w)) + 1;
+    int bottom = static_cast<int>(std::ceil(bounds.y + bounds.h)) + 1;
+    return { left, top, right - left, bottom - top };
+}
+
+PartialRenderer::PartialRenderer(bool ordered, bool groupByTexture)
+    : _ordered(ordered), _groupByTexture(groupByTexture), _tracker(MAX_DAMAGED_RECTS), _contentEpoch(0), _pending()
+{
+    _properties = { ordered, groupByTexture, true };
+}
+
+void PartialRenderer::Submit(const RenderCommand& command)
+{
+    DGEX_ASSERT(IsRenderThread(), "Partial renderer can only be used on the render thread");
+
+    // Size of the target is only known for sure on Render, so unknown
+    // bounds are clipped then.
+    const SDL_Rect unbounded{ INT_MIN / 2, INT_MIN / 2, INT_MAX, INT_MAX };
+    SDL_Rect bounds = GetDamageBounds(command, unbounded);
+
+    auto index = static_cast<uint32_t>(_commands.size());
+    _keys.push_back({ _ordered ? GetRenderSortKey(command, _groupByTexture) : 0, index });
+    _commands.push_back(CopyRenderCommand(_arena, command));
+    _bounds.push_back(bounds);
+    _tracker.Add(HashRenderCommand(command, RENDER_COMMAND_HASH_SEED), bounds);
+}
+
+void PartialRenderer::Render()
+{
+    DGEX_ASSERT(IsRenderThread(), "Partial renderer can only render on the render thread");
+
+    if (_ordered)
+    {
+        _scratch.resize(_keys.size());
+        RadixSort(_keys.data(), _scratch.data(), _keys.size());
+    }
+
+    _pending = {};
+    _pending.CommandCount = static_cast<uint32_t>(_commands.size());
+
+    // Same commands draw differently once a texture is swapped under its
+    // handle, e.g. reloaded after eviction.
+    uint64_t epoch = GetTextureRegistry().GetContentEpoch();
+    if (epoch != _contentEpoch)
+    {
+        _contentEpoch = epoch;
+        _tracker.Invalidate();
+    }
+
+    auto renderer = GetNativeRenderer();
+    if (PrepareBackBuffer())
+    {
+        _tracker.Resolve({ 0, 0, _backBuffer->GetWidth(), _backBuffer->GetHeight() });
+        {
+            USE_RENDER_TARGET(_backBuffer);
+            for (const SDL_Rect& rect : _tracker.GetRects())
+            {
+                Redraw(renderer, rect);
+                _pending.DamagedRectCount++;
+                _pending.DamagedPixelCount += static_cast<uint64_t>(rect.w) * static_cast<uint64_t>(rect.h);
+            }
+            GetRenderStateCache().SetClipRect(nullptr);
+        }
+
+        // Reference: https://wiki.libsdl.org/SDL3/SDL_RenderTexture
+        SDL_Texture* native = _backBuffer->GetNativeTexture();
+        GetRenderStateCache().SetTextureAlphaMod(native, DGEX_COLOR_OPAQUE);
+        GetRenderStateCache().SetTextureColorMod(native, 255, 255, 255);
+        SDL_RenderTexture(renderer, native, nullptr, nullptr);
+        _pending.DrawCallCount++;
+
+        if (IsDamageOutlineEnabled())
+        {
+            GetRenderStateCache().SetDrawColor(255, 0, 255, 255);
+            GetRenderStateCache().SetDrawBlendMode(SDL_BLENDMODE_NONE);
+            for (const SDL_Rect& rect : _tracker.GetRects())
+            {
+                SDL_FRect outline{ static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w),
+                                   static_cast<float>(rect.h) };
+                SDL_RenderRect(renderer, &outline);
+            }
+        }
+    }
+    else
+    {
+        // Nothing drawn, so the frame cannot be compared with later ones.
+        _tracker.Resolve({ 0, 0, 0, 0 });
+        _tracker.Invalidate();
+    }
+
+    _statistics = _pending;
+
+    _commands.clear();
+    _bounds.clear();
+    _keys.clear();
+    _arena.Reset();
+}
+
+void PartialRenderer::Flush()
+{
+    // Nothing is executed before Render.
+}
+
+void PartialRenderer::Invalidate()
+{
+    _tracker.Invalidate();
+}
+
+bool PartialRenderer::PrepareBackBuffer()
+{
+    int width = 0;
+    int height = 0;
+    SDL_GetCurrentRenderOutputSize(GetNativeRenderer(), &width, &height);
+    if (_backBuffer && (_backBuffer->GetWidth() == width) && (_backBuffer->GetHeight() == height))
+    {
+        return true;
+    }
+
+    _backBuffer = nullptr;
+    if ((width <= 0) || (height <= 0))
+    {
+        return false;
+    }
+
+    Ref<Texture> texture = CreateTexture(width, height);
+    if (!texture || !texture->GetNativeTexture())
+    {
+        DGEX_CORE_ERROR("Failed to create back buffer of {0}x{1}: {2}", width, height, SDL_GetError());
+        return false;
+    }
+
+    // Copied to the target as is, the back buffer holds the final pixels.
+    SDL_SetTextureBlendMode(texture->GetNativeTexture(), SDL_BLENDMODE_NONE);
+    _backBuffer = texture;
+    _tracker.Invalidate();
+
+    return true;
+}
+
+void PartialRenderer::Redraw(SDL_Renderer* renderer, const SDL_Rect& rect)
+{
+    RenderStateCache& cache = GetRenderStateCache();
+    cache.SetClipRect(&rect);
+
+    for (const SortKeyEntry& entry : _keys)
+    {
+        const RenderCommand& command = *_commands[entry.Index];
+        if (command.Type == RenderCommandType::Clear)
+        {
+            // Clear ignores the clip, so fill the rect instead.
+            _batcher.Flush(renderer, _pending);
+            const Color& color = static_cast<const ClearRenderCommand&>(command).ClearColor;
+            SDL_FRect area{ static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w),
+                            static_cast<float>(rect.h) };
+            cache.SetDrawColor(color.R, color.G, color.B, color.A);
+            cache.SetDrawBlendMode(SDL_BLENDMODE_NONE);
+            SDL_RenderFillRect(renderer, &area);
+            _pending.DrawCallCount++;
+            continue;
+        }
+
+        const SDL_Rect& bounds = _bounds[entry.Index];
+        if ((bounds.x < rect.x + rect.w) && (bounds.x + bounds.w > rect.x) && (bounds.y < rect.y + rect.h) &&
+            (bounds.y + bounds.h > rect.y))
+        {
+            _batcher.Submit(renderer, command, _pending);
+        }
+    }
+    _batcher.Flush(renderer, _pending);
 }
 
 // ============================================================================
@@ -95,7 +446,21 @@ dgex_error_t InitRenderer()
         DGEX_CORE_WARN("VSync not supported: {0}", SDL_GetError());
     }
 
+    return InitRenderer(renderer);
+}
+
+dgex_error_t InitRenderer(SDL_Renderer* renderer)
+{
+    DGEX_ASSERT(!sNativeRenderer, "Renderer already initialized");
+
+    if (!renderer)
+    {
+        return DGEX_ERROR_RENDERER_INIT;
+    }
+
     sNativeRenderer = renderer;
+    sRenderThread = std::this_thread::get_id();
+    sStateCache = CreateScope<RenderStateCache>(renderer);
 
     DGEX_CORE_DEBUG("Renderer initialized");
 
@@ -106,11 +471,22 @@ void DestroyRenderer()
 {
     DGEX_ASSERT(sNativeRenderer, "Renderer not initialized");
 
+    // Textures still referenced somewhere go stale from now on.
+    GetTextureLoader().Shutdown();
+    GetTextureCache().Clear();
+    GetTextureRegistry().DestroyAll();
+    sStateCache.reset();
     SDL_DestroyRenderer(sNativeRenderer);
+    sNativeRenderer = nullptr;
 
     DGEX_CORE_DEBUG("Renderer destroyed");
 }
 
+bool IsRenderThread()
+{
+    return std::this_thread::get_id() == sRenderThread;
+}
+
 SDL_Renderer* GetNativeRenderer()
 {
     DGEX_ASSERT(sNativeRenderer, "Renderer not initialized");
@@ -122,11 +498,50 @@ Ref<Renderer> CreateRenderer(const RendererProperties& properties)
 {
     DGEX_ASSERT(sNativeRenderer, "Renderer not initialized");
 
+    if (properties.PartialRedraw)
+    {
+        return CreateRef<PartialRenderer>(properties.Ordered, properties.GroupByTexture);
+    }
     if (properties.Ordered)
     {
-        return CreateRef<OrderedRenderer>();
+        return CreateRef<OrderedRenderer>(properties.GroupByTexture);
     }
     return CreateRef<DirectRenderer>();
 }
 
+RenderStateStatistics GetRenderStateStatistics()
+{
+    return GetRenderStateCache().GetStatistics();
+}
+
+void ResetRenderStateStatistics()
+{
+    GetRenderStateCache().ResetStatistics();
+}
+
+void SetDamageOutline(bool enabled)
+{
+    sDamageOutline.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsDamageOutlineEnabled()
+{
+    return sDamageOutline.load(std::memory_order_relaxed);
+}
+
+RenderStateCache& GetRenderStateCache()
+{
+    DGEX_ASSERT(sStateCache, "Renderer not initialized");
+
+    return *sStateCache;
+}
+
+void ForgetTextureState(SDL_Texture* texture)
+{
+    if (sStateCache)
+    {
+        sStateCache->ForgetTexture(texture);
+    }
+}
+
 DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 3, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -19,41 +19,163 @@
 
 #pragma once
 
+#include "Device/Graphics/DamageTracker.h"
+#include "Renderer/CommandBatcher.h"
+#include "Utils/LinearArena.h"
+#include "Utils/RadixSort.h"
+
 #include "DgeX/Device/Graphics/Renderer.h"
 
+#include <mutex>
+#include <thread>
 #include <vector>
 
 DGEX_BEGIN
 
+class Texture;
+
 /**
  * @brief Execute render commands in the issue order.
+ *
+ * Consecutive sprites and primitives are held back for batching, and are
+ * executed once a different command arrives, or on Flush and Render.
  */
 class DirectRenderer final : public Renderer
 {
 public:
-    DirectRenderer() = default;
+    DirectRenderer();
     ~DirectRenderer() override = default;
 
-    void Submit(const Ref<RenderCommand>& command) override;
+    void Submit(const RenderCommand& command) override;
 
     void Render() override;
+
+    void Flush() override;
+
+private:
+    CommandBatcher _batcher;
+    RendererStatistics _pending; // statistics since the last Render
+};
+
+/**
+ * @brief Commands recorded by one thread for an ordered renderer.
+ */
+struct CommandBuffer
+{
+    std::thread::id Owner;
+    LinearArena Arena;
+    std::vector<RenderCommand*> Commands;
+    std::vector<uint64_t> Keys; // sort key of each command
 };
 
 /**
  * @brief Execute render commands by their z index.
+ *
+ * Submitted commands are copied into a linear arena, which is reset
+ * after each Render, so that steady-state frames do not allocate.
+ * Commands are sorted by 64-bit keys with a stable radix sort, so that
+ * commands of the same z index keep their submission order. After
+ * sorting, consecutive sprites of the same texture and primitives of the
+ * same kind are merged into one draw call.
+ *
+ * Any thread may submit commands, each into a command buffer of its own,
+ * so recording needs no lock. Render merges all buffers by sort key on
+ * the render thread, and must not run while other threads still submit.
+ * Within the same key, commands of one thread keep their order, while
+ * commands of different threads are ordered by which thread submitted
+ * to this renderer first.
  */
 class OrderedRenderer final : public Renderer
 {
 public:
-    OrderedRenderer() = default;
+    explicit OrderedRenderer(bool groupByTexture);
     ~OrderedRenderer() override = default;
 
-    void Submit(const Ref<RenderCommand>& command) override;
+    void Submit(const RenderCommand& command) override;
+
+    void Render() override;
+
+    void Flush() override;
+
+private:
+    /**
+     * @brief Get the command buffer of the calling thread.
+     */
+    CommandBuffer& GetCommandBuffer();
+
+private:
+    uint64_t _id; // unique among all ordered renderers, never reused
+
+    // One buffer per thread ever submitted, kept for later frames.
+    std::vector<Scope<CommandBuffer>> _buffers;
+    std::mutex _bufferMutex;
+
+    // Commands of all buffers merged for Render.
+    std::vector<RenderCommand*> _commands;
+
+    // Sort keys, with index to _commands.
+    std::vector<SortKeyEntry> _keys;
+    std::vector<SortKeyEntry> _scratch;
+    bool _groupByTexture;
+
+    CommandBatcher _batcher;
+    RendererStatistics _pending; // statistics of the frame being rendered
+};
+
+/**
+ * @brief Redraw only what changed since the last Render.
+ *
+ * Commands are kept until Render, in issue order or by z index. Render
+ * compares them with those of the last frame, see DamageTracker, and
+ * draws only commands touching the damaged rects into a back buffer,
+ * clipped to the rects. The back buffer then goes to the target in one
+ * copy, since SDL presents the whole window anyway.
+ *
+ * Clear fills the damaged rects only, as SDL clears ignore the clip.
+ */
+class PartialRenderer final : public Renderer
+{
+public:
+    PartialRenderer(bool ordered, bool groupByTexture);
+    ~PartialRenderer() override = default;
+
+    void Submit(const RenderCommand& command) override;
 
     void Render() override;
 
+    void Flush() override;
+
+    void Invalidate() override;
+
 private:
-    std::vector<Ref<RenderCommand>> _commands;
+    /**
+     * @brief Make the back buffer the size of the current target.
+     *
+     * @return False if the back buffer cannot be created.
+     */
+    bool PrepareBackBuffer();
+
+    /**
+     * @brief Draw commands touching a damaged rect into the back buffer.
+     */
+    void Redraw(SDL_Renderer* renderer, const SDL_Rect& rect);
+
+private:
+    bool _ordered;
+    bool _groupByTexture;
+
+    LinearArena _arena;
+    std::vector<RenderCommand*> _commands;
+    std::vector<SDL_Rect> _bounds; // pixels each command may touch
+    std::vector<SortKeyEntry> _keys;
+    std::vector<SortKeyEntry> _scratch;
+
+    DamageTracker _tracker;
+    Ref<Texture> _backBuffer;
+    uint64_t _contentEpoch; // of the texture registry at the last Render
+
+    CommandBatcher _batcher;
+    RendererStatistics _pending; // statistics of the frame being rendered
 };
 
 DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : May 29, 2025                              *
  *                                                                            *
- *                    Last Update : June 1, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -36,6 +36,7 @@ static void* sAppContext = nullptr; // client app context
 
 static DgeXOnEventEntry sOnEvent;
 static DgeXOnUpdateEntry sOnUpdate;
+static DgeXOnFixedUpdateEntry sOnFixedUpdate;
 
 static void Preamble()
 {
@@ -63,6 +64,17 @@ static bool OnUpdate()
     return false;
 }
 
+// OnFixedUpdate implementation.
+static bool OnFixedUpdate()
+{
+    if (int r = sOnFixedUpdate(sAppContext); r != 0)
+    {
+        DGEX_CORE_WARN("DgeXOnFixedUpdate: {0}", r);
+        return true;
+    }
+    return false;
+}
+
 // OnEvent implementation.
 static void OnEvent()
 {
@@ -71,6 +83,13 @@ static void OnEvent()
 
 int DgeXMainImplWithCallbacks(CommandLineArgs args, DgeXOnInitEntry onInit, DgeXOnStartEntry onStart,
                               DgeXOnUpdateEntry onUpdate, DgeXOnEventEntry onEvent, DgeXOnExitEntry onExit)
+{
+    return DgeXMainImplWithFixedUpdate(args, onInit, onStart, onUpdate, onEvent, onExit, nullptr);
+}
+
+int DgeXMainImplWithFixedUpdate(CommandLineArgs args, DgeXOnInitEntry onInit, DgeXOnStartEntry onStart,
+                                DgeXOnUpdateEntry onUpdate, DgeXOnEventEntry onEvent, DgeXOnExitEntry onExit,
+                                DgeXOnFixedUpdateEntry onFixedUpdate)
 {
     Preamble();
 
@@ -100,8 +119,9 @@ int DgeXMainImplWithCallbacks(CommandLineArgs args, DgeXOnInitEntry onInit, DgeX
     // --------------------------------------------------------------
 
     sOnUpdate = onUpdate;
+    sOnFixedUpdate = onFixedUpdate;
     sOnEvent = onEvent;
-    MainLoop(OnUpdate, OnEvent);
+    MainLoop(OnUpdate, onFixedUpdate ? OnFixedUpdate : nullptr, OnEvent);
 
     // ==============================================================
     // Clean Up
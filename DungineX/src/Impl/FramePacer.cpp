@@ -0,0 +1,148 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : FramePacer.cpp                            *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Frame timing, fixed timestep and frame rate limit.                         *
+ ******************************************************************************/
+
+#include "Impl/FramePacer.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+DGEX_BEGIN
+
+FramePacer::FramePacer(uint64_t frequency, int targetFrameRate, double fixedTimestep, int maxFixedUpdates)
+    : _frequency(frequency), _period(targetFrameRate > 0 ? frequency / static_cast<uint64_t>(targetFrameRate) : 0),
+      _fixedTimestep(std::max(fixedTimestep, 0.0)), _maxFixedUpdates(std::max(maxFixedUpdates, 1)), _started(false),
+      _lastCounter(0), _deadline(0), _accumulator(0.0), _history(), _historyCount(0), _historyNext(0),
+      _historySum(0.0), _lastFrameTime(0.0)
+{
+}
+
+void FramePacer::SetTargetFrameRate(int targetFrameRate)
+{
+    _period = targetFrameRate > 0 ? _frequency / static_cast<uint64_t>(targetFrameRate) : 0;
+    if (_period == 0)
+    {
+        _deadline = 0;
+    }
+}
+
+int FramePacer::BeginFrame(uint64_t counter)
+{
+    if (!_started)
+    {
+        _started = true;
+        _lastCounter = counter;
+        _deadline = (_period > 0) ? counter + _period : 0;
+        return 0;
+    }
+
+    // Keep the beat, so a late frame is made up by the next, unless too far
+    // behind to catch up.
+    if (_period > 0)
+    {
+        _deadline = (counter > _deadline + _period) ? counter + _period : _deadline + _period;
+    }
+
+    double frameTime = static_cast<double>(counter - _lastCounter) / static_cast<double>(_frequency);
+    _lastCounter = counter;
+    _lastFrameTime = std::min(frameTime, MAX_FRAME_TIME);
+
+    if (_historyCount == SMOOTHING_FRAMES)
+    {
+        _historySum -= _history[_historyNext];
+    }
+    else
+    {
+        _historyCount++;
+    }
+    _history[_historyNext] = _lastFrameTime;
+    _historySum += _lastFrameTime;
+    _historyNext = (_historyNext + 1) % SMOOTHING_FRAMES;
+
+    if (_fixedTimestep <= 0.0)
+    {
+        return 0;
+    }
+
+    _accumulator += _lastFrameTime;
+    auto updates = static_cast<int>(_accumulator / _fixedTimestep);
+    if (updates > _maxFixedUpdates)
+    {
+        // Cannot keep up, so slow down instead of falling further behind.
+        updates = _maxFixedUpdates;
+        _accumulator = std::fmod(_accumulator, _fixedTimestep);
+    }
+    else
+    {
+        _accumulator -= updates * _fixedTimestep;
+    }
+
+    return updates;
+}
+
+uint64_t FramePacer::GetDeadline() const
+{
+    return _deadline;
+}
+
+double FramePacer::GetFrameTime() const
+{
+    return _historyCount > 0 ? _historySum / _historyCount : 0.0;
+}
+
+double FramePacer::GetLastFrameTime() const
+{
+    return _lastFrameTime;
+}
+
+double FramePacer::GetInterpolationAlpha() const
+{
+    return _fixedTimestep > 0.0 ? std::min(_accumulator / _fixedTimestep, 1.0) : 1.0;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_DelayNS
+void WaitUntil(uint64_t deadline)
+{
+    // System sleeps may overshoot by a millisecond or two.
+    const uint64_t frequency = SDL_GetPerformanceFrequency();
+    const uint64_t spin = frequency / 500;
+
+    while (true)
+    {
+        uint64_t now = SDL_GetPerformanceCounter();
+        if (now >= deadline)
+        {
+            return;
+        }
+
+        uint64_t remaining = deadline - now;
+        if (remaining > spin)
+        {
+            SDL_DelayNS((remaining - spin) * 1000000000ull / frequency);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+DGEX_END
@@ -0,0 +1,118 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : FramePacer.h                              *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Frame timing, fixed timestep and frame rate limit.                         *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief Measure frames, and decide when the next one starts.
+ *
+ * Time is in ticks of a high resolution counter, passed in by the caller,
+ * so that the pacing itself does not depend on the clock.
+ */
+class FramePacer
+{
+public:
+    /**
+     * @param frequency Counter ticks per second.
+     * @param targetFrameRate Frames per second to limit to, 0 for no limit.
+     * @param fixedTimestep Seconds per fixed update, 0 for none.
+     * @param maxFixedUpdates Most fixed updates per frame, the rest dropped.
+     */
+    FramePacer(uint64_t frequency, int targetFrameRate, double fixedTimestep, int maxFixedUpdates);
+
+    /**
+     * @brief Change frames per second to limit to, from the next frame.
+     *
+     * @param targetFrameRate Frames per second, 0 for no limit.
+     */
+    void SetTargetFrameRate(int targetFrameRate);
+
+    /**
+     * @brief Start a frame.
+     *
+     * @param counter Counter value at the start of the frame.
+     * @return Number of fixed updates to run in the frame.
+     */
+    int BeginFrame(uint64_t counter);
+
+    /**
+     * @brief Get the counter value to start the next frame at, 0 for now.
+     */
+    uint64_t GetDeadline() const;
+
+    /**
+     * @brief Get seconds per frame, averaged over the last frames.
+     */
+    double GetFrameTime() const;
+
+    /**
+     * @brief Get seconds of the last frame.
+     */
+    double GetLastFrameTime() const;
+
+    /**
+     * @brief Get how far time is between the last fixed update and the next.
+     *
+     * @return 0 ~ 1, to interpolate states of the last two fixed updates.
+     */
+    double GetInterpolationAlpha() const;
+
+private:
+    static constexpr int SMOOTHING_FRAMES = 16;
+
+    // Longer frames count as this, e.g. after a breakpoint, so that fixed
+    // updates do not pile up.
+    static constexpr double MAX_FRAME_TIME = 0.25;
+
+private:
+    uint64_t _frequency;
+    uint64_t _period; // ticks per frame, 0 for no limit
+    double _fixedTimestep;
+    int _maxFixedUpdates;
+
+    bool _started;
+    uint64_t _lastCounter; // start of the last frame
+    uint64_t _deadline;
+    double _accumulator; // seconds not consumed by fixed updates yet
+
+    // Last frame times in a ring, with their sum.
+    double _history[SMOOTHING_FRAMES];
+    int _historyCount;
+    int _historyNext;
+    double _historySum;
+    double _lastFrameTime;
+};
+
+/**
+ * @brief Wait until the performance counter reaches a value.
+ *
+ * Sleeps most of the time, and spins the last bit, which the system
+ * timer cannot hit precisely.
+ *
+ * @param deadline Counter value to wait for.
+ */
+void WaitUntil(uint64_t deadline);
+
+DGEX_END
@@ -0,0 +1,151 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : FramePipeline.cpp                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Hand-off of frames between the main thread and the simulation thread.      *
+ ******************************************************************************/
+
+#include "Impl/FramePipeline.h"
+
+#include "DgeX/MainLoop.h"
+#include "DgeX/Renderer/RenderApi.h"
+
+DGEX_BEGIN
+
+static thread_local bool sIsSimulationThread = false;
+
+bool RunUpdates(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate, int fixedUpdates)
+{
+    for (int i = 0; i < fixedUpdates; i++)
+    {
+        if (onFixedUpdate())
+        {
+            return true;
+        }
+    }
+    return onUpdate();
+}
+
+// ============================================================================
+// Simulation Thread
+// ----------------------------------------------------------------------------
+
+SimulationThread::SimulationThread(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate)
+    : _onUpdate(onUpdate), _onFixedUpdate(onFixedUpdate), _fixedUpdates(0), _busy(false), _quit(false),
+      _stopping(false), _thread(&SimulationThread::Run, this)
+{
+}
+
+SimulationThread::~SimulationThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+void SimulationThread::Start(const Ref<Renderer>& renderer, int fixedUpdates)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _renderer = renderer;
+        _fixedUpdates = fixedUpdates;
+        _busy = true;
+    }
+    _condition.notify_all();
+}
+
+bool SimulationThread::Wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return !_busy; });
+    return _quit;
+}
+
+void SimulationThread::Run()
+{
+    sIsSimulationThread = true;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _condition.wait(lock, [this] { return _busy || _stopping; });
+        if (!_busy)
+        {
+            break;
+        }
+
+        Ref<Renderer> renderer = _renderer;
+        int fixedUpdates = _fixedUpdates;
+        lock.unlock();
+
+        SetCurrentRenderer(renderer);
+        bool quit = RunUpdates(_onUpdate, _onFixedUpdate, fixedUpdates);
+        SetCurrentRenderer(nullptr);
+
+        lock.lock();
+        _renderer = nullptr;
+        _quit = quit;
+        _busy = false;
+        _condition.notify_all();
+    }
+}
+
+// ============================================================================
+// Frame Pipeline
+// ----------------------------------------------------------------------------
+
+FramePipeline::FramePipeline(const Ref<Renderer>& first, const Ref<Renderer>& second, OnUpdateCallback onUpdate,
+                             OnFixedUpdateCallback onFixedUpdate)
+    : _renderers{ first, second }, _recording(0), _simulation(onUpdate, onFixedUpdate)
+{
+}
+
+void FramePipeline::Start(int fixedUpdates)
+{
+    _simulation.Start(_renderers[_recording], fixedUpdates);
+}
+
+bool FramePipeline::HandOff(int eventCount, OnEventCallback onEvent)
+{
+    // Neither side is running from here on.
+    bool quit = _simulation.Wait();
+    for (int i = 0; i < eventCount; i++)
+    {
+        onEvent();
+    }
+
+    _recording ^= 1;
+
+    return quit;
+}
+
+const Ref<Renderer>& FramePipeline::GetRecorded() const
+{
+    return _renderers[_recording ^ 1];
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+bool IsSimulationThread()
+{
+    return sIsSimulationThread;
+}
+
+DGEX_END
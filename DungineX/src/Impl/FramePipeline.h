@@ -0,0 +1,125 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : FramePipeline.h                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Hand-off of frames between the main thread and the simulation thread.      *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Impl/MainLoop.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+DGEX_BEGIN
+
+/**
+ * @brief Run fixed updates, then the frame update.
+ *
+ * @return Whether to quit.
+ */
+bool RunUpdates(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate, int fixedUpdates);
+
+/**
+ * @brief Run OnUpdate on its own thread, one frame at a time.
+ */
+class SimulationThread
+{
+public:
+    SimulationThread(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate);
+    SimulationThread(const SimulationThread& other) = delete;
+    SimulationThread(SimulationThread&& other) noexcept = delete;
+    SimulationThread& operator=(const SimulationThread& other) = delete;
+    SimulationThread& operator=(SimulationThread&& other) noexcept = delete;
+
+    ~SimulationThread();
+
+    /**
+     * @brief Start updates of a frame, drawing into the renderer.
+     */
+    void Start(const Ref<Renderer>& renderer, int fixedUpdates);
+
+    /**
+     * @brief Wait until updates of the started frame return.
+     *
+     * @return Whether they asked to quit.
+     */
+    bool Wait();
+
+private:
+    void Run();
+
+private:
+    OnUpdateCallback _onUpdate;
+    OnFixedUpdateCallback _onFixedUpdate;
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    Ref<Renderer> _renderer; // of the started frame
+    int _fixedUpdates;       // of the started frame
+    bool _busy;              // updates started and not returned yet
+    bool _quit;              // result of the last updates
+    bool _stopping;
+
+    std::thread _thread; // last, so that it starts after the others
+};
+
+/**
+ * @brief Simulate the next frame while rendering the current one.
+ *
+ * Two ordered renderers take turns, one recorded by the simulation thread
+ * while the other is rendered by the main thread. They swap at the
+ * hand-off, when both sides are done with their frame.
+ */
+class FramePipeline
+{
+public:
+    FramePipeline(const Ref<Renderer>& first, const Ref<Renderer>& second, OnUpdateCallback onUpdate,
+                  OnFixedUpdateCallback onFixedUpdate);
+
+    /**
+     * @brief Start updates of the next frame on the simulation thread.
+     */
+    void Start(int fixedUpdates);
+
+    /**
+     * @brief Hand off the frame started last.
+     *
+     * Waits until its updates return, then calls OnEvent for the events
+     * polled meanwhile, so that OnEvent and OnUpdate never overlap.
+     *
+     * @param eventCount Number of events polled since the last hand-off.
+     * @param onEvent Called for each event.
+     * @return Whether updates asked to quit.
+     */
+    bool HandOff(int eventCount, OnEventCallback onEvent);
+
+    /**
+     * @brief Get the renderer of the frame handed off last, to render.
+     */
+    const Ref<Renderer>& GetRecorded() const;
+
+private:
+    Ref<Renderer> _renderers[2];
+    size_t _recording;
+
+    SimulationThread _simulation; // last, so that it stops first
+};
+
+DGEX_END
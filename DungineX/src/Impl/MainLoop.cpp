@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -18,39 +18,256 @@
  ******************************************************************************/
 
 #include "Impl/MainLoop.h"
+#include "Impl/FramePacer.h"
+#include "Impl/FramePipeline.h"
+
+#include "Renderer/TextureRegistry.h"
 
 #include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Device/Graphics/Window.h"
+#include "DgeX/MainLoop.h"
+#include "DgeX/Renderer/RenderApi.h"
 #include "DgeX/Utils/Log.h"
 
 #include <SDL3/SDL.h>
 #include <SDL_FontCache/SDL_FontCache.h>
 
+#include <cmath>
+
 DGEX_BEGIN
 
-void MainLoop(OnUpdateCallback onUpdate, OnEventCallback onEvent)
+static MainLoopProperties sMainLoopPropertiesHint;
+
+// Frame stats, only written at the start of a frame, before any callback.
+static double sFrameTime = 0.0;
+static double sLastFrameTime = 0.0;
+static double sInterpolationAlpha = 1.0;
+
+/**
+ * @brief Get frames per second to limit to, 0 for no limit.
+ */
+static int GetTargetFrameRate()
+{
+    const int target = sMainLoopPropertiesHint.TargetFrameRate;
+    if (target != 0)
+    {
+        return target > 0 ? target : 0;
+    }
+
+    SDL_Renderer* renderer = GetNativeRenderer();
+    int vsync = 0;
+    if (!renderer || (SDL_GetRenderVSync(renderer, &vsync) && (vsync != 0)))
+    {
+        return 0;
+    }
+
+    // No vsync to wait for, so do not render faster than the display shows.
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(GetNativeWindow()));
+    int rate = (mode && (mode->refresh_rate > 0.0f)) ? static_cast<int>(std::ceil(mode->refresh_rate)) : 60;
+    DGEX_CORE_INFO("VSync off, frame rate limited to {0}", rate);
+
+    return rate;
+}
+
+/**
+ * @brief Handle events the main loop itself cares about.
+ *
+ * @return Whether to quit.
+ */
+static bool HandleEvent(FramePacer& pacer, const SDL_Event& event)
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_QUIT:
+        return true;
+    case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
+    case SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED:
+        // The refresh rate to follow may be another.
+        pacer.SetTargetFrameRate(GetTargetFrameRate());
+        return false;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Poll all pending events.
+ *
+ * @param eventCount Increased by the number of events polled.
+ * @return Whether to quit.
+ */
+static bool PollEvents(FramePacer& pacer, int& eventCount)
+{
+    bool quit = false;
+    SDL_Event event;
+    while (SDL_PollEvent(&event))
+    {
+        eventCount++;
+        quit |= HandleEvent(pacer, event);
+    }
+    return quit;
+}
+
+/**
+ * @brief Start a frame, and publish its stats to the callbacks.
+ *
+ * @return Number of fixed updates to run in the frame.
+ */
+static int BeginFrame(FramePacer& pacer)
 {
-    DGEX_CORE_INFO("Main loop started");
+    int fixedUpdates = pacer.BeginFrame(SDL_GetPerformanceCounter());
+
+    sFrameTime = pacer.GetFrameTime();
+    sLastFrameTime = pacer.GetLastFrameTime();
+    sInterpolationAlpha = pacer.GetInterpolationAlpha();
+
+    return fixedUpdates;
+}
 
+static void RunSerial(FramePacer& pacer, OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate,
+                      OnEventCallback onEvent)
+{
     bool isRunning = true;
     while (isRunning)
     {
+        int fixedUpdates = BeginFrame(pacer);
+
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
             onEvent();
-            if (event.type == SDL_EVENT_QUIT)
+            if (HandleEvent(pacer, event))
             {
                 isRunning = false;
             }
         }
 
-        if (onUpdate())
+        if (RunUpdates(onUpdate, onFixedUpdate, fixedUpdates))
         {
             isRunning = false;
         }
+
+        WaitUntil(pacer.GetDeadline());
+    }
+}
+
+/**
+ * @brief Get properties of the renderers the simulation thread records into.
+ *
+ * They must be ordered, to take draws from another thread, but keep the
+ * grouping of the current renderer set in OnStart, which they replace.
+ */
+static RendererProperties GetPipelinedRendererProperties()
+{
+    RendererProperties properties{ true, false, false };
+
+    Ref<Renderer> current = GetCurrentRenderer();
+    if (current)
+    {
+        const RendererProperties& replaced = current->GetProperties();
+        properties.GroupByTexture = replaced.GroupByTexture;
+        if (replaced.PartialRedraw)
+        {
+            DGEX_CORE_WARN("Partial redraw is not supported when pipelined, current renderer replaced");
+        }
+    }
+
+    return properties;
+}
+
+/**
+ * @brief Simulate the next frame while rendering the current one.
+ */
+static void RunPipelined(FramePacer& pacer, OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate,
+                         OnEventCallback onEvent)
+{
+    RendererProperties properties = GetPipelinedRendererProperties();
+
+    // Textures are marked used one frame ahead of the frame presented.
+    GetTextureRegistry().SetFrameLatency(1);
+    {
+        FramePipeline pipeline(CreateRenderer(properties), CreateRenderer(properties), onUpdate, onFixedUpdate);
+        pipeline.Start(BeginFrame(pacer));
+
+        bool isRunning = true;
+        while (isRunning)
+        {
+            int eventCount = 0;
+            bool quit = PollEvents(pacer, eventCount);
+            quit |= pipeline.HandOff(eventCount, onEvent);
+            isRunning = !quit;
+
+            if (isRunning)
+            {
+                pipeline.Start(BeginFrame(pacer));
+            }
+
+            pipeline.GetRecorded()->Render();
+            FlushDevice();
+
+            WaitUntil(pacer.GetDeadline());
+        }
+    }
+    GetTextureRegistry().SetFrameLatency(0);
+}
+
+void MainLoop(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate, OnEventCallback onEvent)
+{
+    const MainLoopProperties& hint = sMainLoopPropertiesHint;
+    if (!onFixedUpdate && (hint.FixedTimestep > 0.0))
+    {
+        DGEX_CORE_WARN("Fixed timestep set without OnFixedUpdate");
+    }
+
+    FramePacer pacer(SDL_GetPerformanceFrequency(), GetTargetFrameRate(), onFixedUpdate ? hint.FixedTimestep : 0.0,
+                     hint.MaxFixedUpdates);
+
+    if (hint.Pipelined)
+    {
+        DGEX_CORE_INFO("Main loop started, pipelined");
+        RunPipelined(pacer, onUpdate, onFixedUpdate, onEvent);
+    }
+    else
+    {
+        DGEX_CORE_INFO("Main loop started");
+        RunSerial(pacer, onUpdate, onFixedUpdate, onEvent);
     }
 
     DGEX_CORE_INFO("Main loop ended");
 }
 
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+void SetMainLoopPropertiesHint(const MainLoopProperties& properties)
+{
+    sMainLoopPropertiesHint = properties;
+}
+
+const MainLoopProperties& GetMainLoopPropertiesHint()
+{
+    return sMainLoopPropertiesHint;
+}
+
+double GetFrameTime()
+{
+    return sFrameTime;
+}
+
+double GetLastFrameTime()
+{
+    return sLastFrameTime;
+}
+
+double GetFrameRate()
+{
+    return sFrameTime > 0.0 ? 1.0 / sFrameTime : 0.0;
+}
+
+double GetInterpolationAlpha()
+{
+    return sInterpolationAlpha;
+}
+
 DGEX_END
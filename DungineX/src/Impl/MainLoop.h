@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -20,18 +20,28 @@
 #pragma once
 
 #include "DgeX/Defines.h"
+#include "DgeX/MainLoop.h"
 
 DGEX_BEGIN
 
 typedef bool (*OnUpdateCallback)(void);
+typedef bool (*OnFixedUpdateCallback)(void);
 typedef void (*OnEventCallback)(void);
 
 /**
  * @brief Run the main loop.
  *
+ * Runs pipelined if hinted so, see MainLoopProperties.
+ *
  * @param onUpdate Called on frame update.
+ * @param onFixedUpdate Called on fixed update, nullptr for none.
  * @param onEvent Called on receiving new events.
  */
-void MainLoop(OnUpdateCallback onUpdate, OnEventCallback onEvent);
+void MainLoop(OnUpdateCallback onUpdate, OnFixedUpdateCallback onFixedUpdate, OnEventCallback onEvent);
+
+/**
+ * @brief Get main loop properties hint set by the client.
+ */
+const MainLoopProperties& GetMainLoopPropertiesHint();
 
 DGEX_END
@@ -0,0 +1,166 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CachedLayer.cpp                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Render target texture that is only redrawn when its content changes.       *
+ ******************************************************************************/
+
+#include "Renderer/CachedLayerImpl.h"
+
+#include "Renderer/RenderCommandImpl.h"
+
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Log.h"
+
+#include <climits>
+
+DGEX_BEGIN
+
+CachedLayerImpl::CachedLayerImpl(const Ref<Texture>& texture)
+    : _texture(texture), _hash(RENDER_COMMAND_HASH_SEED), _contentHash(0), _recording(false), _dirty(true)
+{
+    _renderer = CreateRenderer({ false, false });
+    _recorder = CreateRef<CommandRecorder>(*this);
+}
+
+void CachedLayerImpl::Begin()
+{
+    DGEX_ASSERT(!_recording, "Cached layer already recording");
+    DGEX_ASSERT(IsRenderThread(), "Cached layer can only be recorded on the render thread");
+
+    _commands.clear();
+    _arena.Reset();
+    _hash = RENDER_COMMAND_HASH_SEED;
+
+    _lastRenderer = GetCurrentRenderer();
+    SetCurrentRenderer(_recorder);
+
+    // Content is culled against the layer, not the current target.
+    auto width = static_cast<float>(_texture->GetWidth());
+    auto height = static_cast<float>(_texture->GetHeight());
+    _lastView = GetViewCullingState();
+    SetViewCullingState({ _lastView.Enabled, true, { 0.0f, 0.0f, width, height } });
+
+    // Content is in the space of the layer.
+    _lastTransform = GetTransform();
+    SetTransform(Transform());
+
+    _recording = true;
+}
+
+bool CachedLayerImpl::End()
+{
+    DGEX_ASSERT(_recording, "Cached layer not recording");
+
+    SetCurrentRenderer(_lastRenderer);
+    SetViewCullingState(_lastView);
+    SetTransform(_lastTransform);
+    _lastRenderer = nullptr;
+    _recording = false;
+
+    bool changed = _dirty || (_hash != _contentHash);
+    if (changed)
+    {
+        Redraw();
+        _contentHash = _hash;
+        _dirty = false;
+    }
+
+    // Content is no longer needed once rendered.
+    _commands.clear();
+    _arena.Reset();
+
+    return changed;
+}
+
+void CachedLayerImpl::MarkDirty()
+{
+    _dirty = true;
+}
+
+bool CachedLayerImpl::IsDirty() const
+{
+    return _dirty;
+}
+
+const Ref<Texture>& CachedLayerImpl::GetTexture() const
+{
+    return _texture;
+}
+
+uint64_t CachedLayerImpl::GetContentHash() const
+{
+    return _contentHash;
+}
+
+void CachedLayerImpl::Record(const RenderCommand& command)
+{
+    _hash = HashRenderCommand(command, _hash);
+    _commands.push_back(CopyRenderCommand(_arena, command));
+}
+
+void CachedLayerImpl::Redraw()
+{
+    USE_RENDERER(_renderer);
+    USE_RENDER_TARGET(_texture);
+
+    // Already culled and transformed when recorded.
+    ViewCullingState lastView = GetViewCullingState();
+    SetViewCullingState({ false, false, { 0.0f, 0.0f, 0.0f, 0.0f } });
+    Transform lastTransform = GetTransform();
+    SetTransform(Transform());
+
+    // Start from transparent, so that the layer blends with what is below.
+    ClearRenderCommand clear{ { RenderCommandType::Clear, INT_MIN }, Color(0, 0, 0, 0) };
+    SubmitRenderCommand(clear);
+
+    for (const RenderCommand* command : _commands)
+    {
+        SubmitRenderCommand(*command);
+    }
+    _renderer->Render();
+
+    SetViewCullingState(lastView);
+    SetTransform(lastTransform);
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<CachedLayer> CreateCachedLayer(int width, int height)
+{
+    Ref<Texture> texture = CreateTexture(width, height);
+    if (!texture || !texture->GetNativeTexture())
+    {
+        DGEX_CORE_ERROR("Failed to create cached layer of {0}x{1}: {2}", width, height, SDL_GetError());
+        return nullptr;
+    }
+    return CreateRef<CachedLayerImpl>(texture);
+}
+
+CachedLayerGuard::CachedLayerGuard(const Ref<CachedLayer>& layer) : _layer(layer)
+{
+    _layer->Begin();
+}
+
+CachedLayerGuard::~CachedLayerGuard()
+{
+    _layer->End();
+}
+
+DGEX_END
@@ -0,0 +1,74 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CachedLayerImpl.h                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Render target texture that is only redrawn when its content changes.       *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/RenderApiImpl.h"
+#include "Utils/LinearArena.h"
+
+#include "DgeX/Renderer/CachedLayer.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Cached layer that records commands and compares their hash.
+ *
+ * Recorded commands are copied into a linear arena, and replayed to the
+ * texture with a direct renderer only when needed.
+ */
+class CachedLayerImpl final : public CachedLayer, public CommandSink
+{
+public:
+    explicit CachedLayerImpl(const Ref<Texture>& texture);
+    ~CachedLayerImpl() override = default;
+
+    void Begin() override;
+    bool End() override;
+    void MarkDirty() override;
+    bool IsDirty() const override;
+    const Ref<Texture>& GetTexture() const override;
+    uint64_t GetContentHash() const override;
+
+    void Record(const RenderCommand& command) override;
+
+private:
+    void Redraw();
+
+private:
+    Ref<Texture> _texture;
+    Ref<Renderer> _renderer; // to replay the content
+    Ref<CommandRecorder> _recorder;
+    Ref<Renderer> _lastRenderer; // renderer to restore on End
+    ViewCullingState _lastView;  // view culling to restore on End
+    Transform _lastTransform;    // transform to restore on End
+
+    LinearArena _arena;
+    std::vector<RenderCommand*> _commands;
+
+    uint64_t _hash;        // hash of commands being recorded
+    uint64_t _contentHash; // hash of the rendered content
+
+    bool _recording;
+    bool _dirty;
+};
+
+DGEX_END
@@ -0,0 +1,127 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandBatcher.cpp                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Execute render commands with batching of sprites and primitives.           *
+ ******************************************************************************/
+
+#include "Renderer/CommandBatcher.h"
+
+DGEX_BEGIN
+
+void CommandBatcher::Submit(SDL_Renderer* renderer, const RenderCommand& command, RendererStatistics& statistics)
+{
+    if (command.Type == RenderCommandType::Texture)
+    {
+        const auto& textureCommand = static_cast<const TextureRenderCommand&>(command);
+        FlushPrimitives(renderer, statistics);
+        if (!_sprites.CanBatch(textureCommand))
+        {
+            FlushSprites(renderer, statistics);
+        }
+        _sprites.Add(textureCommand);
+    }
+    else if ((command.Type == RenderCommandType::Rect) &&
+             !IsAxisAlignedRect(static_cast<const RectRenderCommand&>(command)))
+    {
+        SubmitRotatedRect(renderer, static_cast<const RectRenderCommand&>(command), statistics);
+    }
+    else if (PrimitiveBatch::IsPrimitive(command))
+    {
+        SubmitPrimitive(renderer, command, statistics);
+    }
+    else if (command.Type == RenderCommandType::Geometry)
+    {
+        // Already batched, draw as is.
+        Flush(renderer, statistics);
+        ApplyRenderCommand(renderer, command);
+        statistics.SpriteCount += static_cast<const GeometryRenderCommand&>(command).SpriteCount;
+        statistics.BatchCount++;
+        statistics.DrawCallCount++;
+    }
+    else
+    {
+        Flush(renderer, statistics);
+        ApplyRenderCommand(renderer, command);
+        statistics.DrawCallCount++;
+    }
+}
+
+void CommandBatcher::Flush(SDL_Renderer* renderer, RendererStatistics& statistics)
+{
+    // At most one of them is not empty.
+    FlushSprites(renderer, statistics);
+    FlushPrimitives(renderer, statistics);
+}
+
+bool CommandBatcher::IsEmpty() const
+{
+    return _sprites.IsEmpty() && _primitives.IsEmpty();
+}
+
+void CommandBatcher::SubmitPrimitive(SDL_Renderer* renderer, const RenderCommand& command,
+                                     RendererStatistics& statistics)
+{
+    FlushSprites(renderer, statistics);
+    if (!_primitives.CanBatch(command))
+    {
+        FlushPrimitives(renderer, statistics);
+    }
+    _primitives.Add(command);
+}
+
+void CommandBatcher::SubmitRotatedRect(SDL_Renderer* renderer, const RectRenderCommand& command,
+                                       RendererStatistics& statistics)
+{
+    // Lines share the transform, so they connect into one closed polyline.
+    const SDL_FRect& rect = command.Rect;
+    const float x[5] = { rect.x, rect.x + rect.w, rect.x + rect.w, rect.x, rect.x };
+    const float y[5] = { rect.y, rect.y, rect.y + rect.h, rect.y + rect.h, rect.y };
+
+    for (int i = 0; i < 4; i++)
+    {
+        LineRenderCommand line{ { RenderCommandType::Line, command.Order, command.Transform },
+                                x[i],
+                                y[i],
+                                x[i + 1],
+                                y[i + 1],
+                                command.DrawColor };
+        SubmitPrimitive(renderer, line, statistics);
+    }
+}
+
+void CommandBatcher::FlushSprites(SDL_Renderer* renderer, RendererStatistics& statistics)
+{
+    auto count = static_cast<uint32_t>(_sprites.GetSpriteCount());
+    if (_sprites.Flush(renderer))
+    {
+        statistics.SpriteCount += count;
+        statistics.BatchCount++;
+        statistics.DrawCallCount++;
+    }
+}
+
+void CommandBatcher::FlushPrimitives(SDL_Renderer* renderer, RendererStatistics& statistics)
+{
+    auto count = static_cast<uint32_t>(_primitives.GetPrimitiveCount());
+    if (_primitives.Flush(renderer))
+    {
+        statistics.PrimitiveCount += count;
+        statistics.PrimitiveBatchCount++;
+        statistics.DrawCallCount++;
+    }
+}
+
+DGEX_END
@@ -0,0 +1,83 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandBatcher.h                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Execute render commands with batching of sprites and primitives.           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/PrimitiveBatch.h"
+#include "Renderer/SpriteBatch.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief Execute render commands in the given order, but batched.
+ *
+ * Consecutive sprites and primitives are held back and merged, and are
+ * flushed once a command that cannot join them arrives, or Flush is
+ * called explicitly. So the final result is the same as executing each
+ * command one by one.
+ */
+class CommandBatcher
+{
+public:
+    CommandBatcher() = default;
+    CommandBatcher(const CommandBatcher& other) = delete;
+    CommandBatcher(CommandBatcher&& other) noexcept = default;
+    CommandBatcher& operator=(const CommandBatcher& other) = delete;
+    CommandBatcher& operator=(CommandBatcher&& other) noexcept = default;
+
+    ~CommandBatcher() = default;
+
+    /**
+     * @brief Execute or hold a command.
+     *
+     * @param renderer The native renderer.
+     * @param command The command.
+     * @param statistics Statistics to update.
+     */
+    void Submit(SDL_Renderer* renderer, const RenderCommand& command, RendererStatistics& statistics);
+
+    /**
+     * @brief Execute all held commands.
+     *
+     * @param renderer The native renderer.
+     * @param statistics Statistics to update.
+     */
+    void Flush(SDL_Renderer* renderer, RendererStatistics& statistics);
+
+    bool IsEmpty() const;
+
+private:
+    void SubmitPrimitive(SDL_Renderer* renderer, const RenderCommand& command, RendererStatistics& statistics);
+
+    /**
+     * @brief Submit an outline rotated by its transform as four lines.
+     */
+    void SubmitRotatedRect(SDL_Renderer* renderer, const RectRenderCommand& command, RendererStatistics& statistics);
+
+    void FlushSprites(SDL_Renderer* renderer, RendererStatistics& statistics);
+    void FlushPrimitives(SDL_Renderer* renderer, RendererStatistics& statistics);
+
+private:
+    SpriteBatch _sprites;
+    PrimitiveBatch _primitives;
+};
+
+DGEX_END
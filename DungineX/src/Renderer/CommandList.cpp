@@ -0,0 +1,264 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandList.cpp                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Retained commands recorded once and replayed every frame.                  *
+ ******************************************************************************/
+
+#include "Renderer/CommandListImpl.h"
+
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Math.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief Get the bounds of vertices, empty if there is none.
+ */
+static SDL_FRect GetVertexBounds(const SDL_Vertex* vertices, size_t count)
+{
+    if (count == 0)
+    {
+        return { 0.0f, 0.0f, 0.0f, 0.0f };
+    }
+
+    float minX = vertices[0].position.x;
+    float minY = vertices[0].position.y;
+    float maxX = minX;
+    float maxY = minY;
+    for (size_t i = 1; i < count; i++)
+    {
+        minX = Math::Min(minX, vertices[i].position.x);
+        minY = Math::Min(minY, vertices[i].position.y);
+        maxX = Math::Max(maxX, vertices[i].position.x);
+        maxY = Math::Max(maxY, vertices[i].position.y);
+    }
+    return { minX, minY, maxX - minX, maxY - minY };
+}
+
+CommandListImpl::CommandListImpl(const RendererProperties& properties)
+    : _properties(properties), _spriteOrder(0), _recording(false), _valid(false)
+{
+    _recorder = CreateRef<CommandRecorder>(*this);
+}
+
+void CommandListImpl::Begin()
+{
+    DGEX_ASSERT(!_recording, "Command list already recording");
+
+    Clear();
+    _valid = false;
+
+    _lastRenderer = GetCurrentRenderer();
+    SetCurrentRenderer(_recorder);
+
+    // The list may be replayed to any view, so it is culled on Submit.
+    // Sprites are baked into geometry, culled on its vertex bounds.
+    _lastView = GetViewCullingState();
+    ViewCullingState view = _lastView;
+    view.Enabled = false;
+    SetViewCullingState(view);
+
+    // Content is in its own space, and the transform on Submit applies.
+    _lastTransform = GetTransform();
+    SetTransform(Transform());
+
+    _recording = true;
+}
+
+void CommandListImpl::End()
+{
+    DGEX_ASSERT(_recording, "Command list not recording");
+
+    SetCurrentRenderer(_lastRenderer);
+    SetViewCullingState(_lastView);
+    SetTransform(_lastTransform);
+    _lastRenderer = nullptr;
+    _recording = false;
+
+    Bake();
+    _valid = true;
+}
+
+void CommandListImpl::Invalidate()
+{
+    DGEX_ASSERT(!_recording, "Cannot invalidate command list while recording");
+
+    Clear();
+    _valid = false;
+}
+
+bool CommandListImpl::IsValid() const
+{
+    return _valid;
+}
+
+void CommandListImpl::Submit() const
+{
+    DGEX_ASSERT(!_recording, "Cannot submit command list while recording");
+
+    if (!_valid)
+    {
+        return;
+    }
+    for (const BakedCommand& baked : _baked)
+    {
+        if (baked.HasBounds)
+        {
+            SubmitRenderCommand(*baked.Command, baked.Bounds);
+        }
+        else
+        {
+            SubmitRenderCommand(*baked.Command);
+        }
+    }
+}
+
+size_t CommandListImpl::GetRecordedCount() const
+{
+    return _recorded.size();
+}
+
+size_t CommandListImpl::GetBakedCount() const
+{
+    return _baked.size();
+}
+
+void CommandListImpl::Record(const RenderCommand& command)
+{
+    if (command.Type == RenderCommandType::Geometry)
+    {
+        // The list is replayed long after the submitter changed or freed
+        // its vertices, so they are always copied, and owned by the list.
+        GeometryRenderCommand geometry = static_cast<const GeometryRenderCommand&>(command);
+        geometry.Transient = true;
+        auto* copy = static_cast<GeometryRenderCommand*>(CopyRenderCommand(_arena, geometry));
+        copy->Transient = false;
+        _recorded.push_back(copy);
+        return;
+    }
+    _recorded.push_back(CopyRenderCommand(_arena, command));
+}
+
+void CommandListImpl::Bake()
+{
+    // Same order as an ordered renderer would execute them.
+    _keys.clear();
+    for (size_t i = 0; i < _recorded.size(); i++)
+    {
+        uint64_t key = _properties.Ordered ? GetRenderSortKey(*_recorded[i], _properties.GroupByTexture) : 0;
+        _keys.push_back({ key, static_cast<uint32_t>(i) });
+    }
+    if (_properties.Ordered)
+    {
+        _scratch.resize(_keys.size());
+        RadixSort(_keys.data(), _scratch.data(), _keys.size());
+    }
+
+    for (const SortKeyEntry& entry : _keys)
+    {
+        RenderCommand* command = _recorded[entry.Index];
+        if (command->Type == RenderCommandType::Texture)
+        {
+            const auto& textureCommand = static_cast<const TextureRenderCommand&>(*command);
+            if (!_sprites.CanBatch(textureCommand) || (command->Order != _spriteOrder))
+            {
+                BakeSprites();
+            }
+            _spriteOrder = command->Order;
+            _sprites.Add(textureCommand);
+        }
+        else if (command->Type == RenderCommandType::Geometry)
+        {
+            BakeSprites();
+            const auto& geometry = static_cast<const GeometryRenderCommand&>(*command);
+            SDL_FRect bounds = GetVertexBounds(geometry.Vertices, static_cast<size_t>(geometry.VertexCount));
+            _baked.push_back({ command, bounds, true });
+        }
+        else
+        {
+            BakeSprites();
+            _baked.push_back({ command, {}, false });
+        }
+    }
+    BakeSprites();
+
+    // Vertices no longer move, so we can point to them now.
+    for (const PendingGeometry& geometry : _pending)
+    {
+        geometry.Command->Vertices = _vertices.data() + geometry.FirstVertex;
+        geometry.Command->Indices = _indices.data() + geometry.FirstIndex;
+    }
+    _pending.clear();
+    _keys.clear();
+}
+
+void CommandListImpl::BakeSprites()
+{
+    if (_sprites.IsEmpty())
+    {
+        return;
+    }
+
+    const std::vector<SDL_Vertex>& vertices = _sprites.GetVertices();
+    const std::vector<int>& indices = _sprites.GetIndices();
+
+    GeometryRenderCommand geometry{ { RenderCommandType::Geometry, _spriteOrder },
+                                    _sprites.GetTexture(),
+                                    nullptr,
+                                    nullptr,
+                                    static_cast<int>(vertices.size()),
+                                    static_cast<int>(indices.size()),
+                                    static_cast<uint32_t>(_sprites.GetSpriteCount()) };
+    GeometryRenderCommand* command = _arena.New(geometry);
+
+    _pending.push_back({ command, _vertices.size(), _indices.size() });
+    _vertices.insert(_vertices.end(), vertices.begin(), vertices.end());
+    _indices.insert(_indices.end(), indices.begin(), indices.end());
+    _baked.push_back({ command, GetVertexBounds(vertices.data(), vertices.size()), true });
+
+    _sprites.Clear();
+}
+
+void CommandListImpl::Clear()
+{
+    _recorded.clear();
+    _baked.clear();
+    _vertices.clear();
+    _indices.clear();
+    _arena.Reset();
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<CommandList> CreateCommandList(const RendererProperties& properties)
+{
+    return CreateRef<CommandListImpl>(properties);
+}
+
+CommandListGuard::CommandListGuard(const Ref<CommandList>& commandList) : _commandList(commandList)
+{
+    _commandList->Begin();
+}
+
+CommandListGuard::~CommandListGuard()
+{
+    _commandList->End();
+}
+
+DGEX_END
@@ -0,0 +1,105 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandListImpl.h                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Retained commands recorded once and replayed every frame.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/RenderApiImpl.h"
+#include "Renderer/SpriteBatch.h"
+#include "Utils/LinearArena.h"
+#include "Utils/RadixSort.h"
+
+#include "DgeX/Renderer/CommandList.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Command list that bakes sprites into prepared geometry.
+ *
+ * Recorded commands are copied into a linear arena. On End, they are
+ * sorted if ordered, and runs of sprites of the same texture and z index
+ * are turned into one geometry command. Other commands are kept as they
+ * are, and primitives among them are still batched by the renderer.
+ * Geometry has no bounds of its own, so its vertex bounds are computed
+ * once when baked, and culled against on Submit.
+ */
+class CommandListImpl final : public CommandList, public CommandSink
+{
+public:
+    explicit CommandListImpl(const RendererProperties& properties);
+    ~CommandListImpl() override = default;
+
+    void Begin() override;
+    void End() override;
+    void Invalidate() override;
+    bool IsValid() const override;
+    void Submit() const override;
+    size_t GetRecordedCount() const override;
+    size_t GetBakedCount() const override;
+
+    void Record(const RenderCommand& command) override;
+
+private:
+    void Bake();
+    void BakeSprites();
+    void Clear();
+
+private:
+    // Baked command, with vertex bounds if it is geometry.
+    struct BakedCommand
+    {
+        RenderCommand* Command;
+        SDL_FRect Bounds;
+        bool HasBounds;
+    };
+
+    // Geometry command waiting for its vertices to settle.
+    struct PendingGeometry
+    {
+        GeometryRenderCommand* Command;
+        size_t FirstVertex;
+        size_t FirstIndex;
+    };
+
+    RendererProperties _properties;
+    Ref<CommandRecorder> _recorder;
+    Ref<Renderer> _lastRenderer; // renderer to restore on End
+    ViewCullingState _lastView;  // view culling to restore on End
+    Transform _lastTransform;    // transform to restore on End
+
+    LinearArena _arena; // all recorded and baked commands
+    std::vector<RenderCommand*> _recorded;
+    std::vector<SortKeyEntry> _keys;
+    std::vector<SortKeyEntry> _scratch;
+
+    std::vector<BakedCommand> _baked;
+    std::vector<SDL_Vertex> _vertices; // vertices of all baked geometry
+    std::vector<int> _indices;         // indices relative to each geometry
+    std::vector<PendingGeometry> _pending;
+
+    SpriteBatch _sprites; // sprites being baked
+    int _spriteOrder;     // z index of _sprites
+
+    bool _recording;
+    bool _valid;
+};
+
+DGEX_END
@@ -0,0 +1,42 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandRecorder.cpp                       *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Capture commands of the draw API instead of rendering them.                *
+ ******************************************************************************/
+
+#include "Renderer/CommandRecorder.h"
+
+DGEX_BEGIN
+
+CommandRecorder::CommandRecorder(CommandSink& sink) : _sink(sink)
+{
+}
+
+void CommandRecorder::Submit(const RenderCommand& command)
+{
+    _sink.Record(command);
+}
+
+void CommandRecorder::Render()
+{
+    // Nothing to render, commands are replayed by the sink.
+}
+
+void CommandRecorder::Flush()
+{
+}
+
+DGEX_END
@@ -0,0 +1,68 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : CommandRecorder.h                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Capture commands of the draw API instead of rendering them.                *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Device/Graphics/RenderCommand.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief Receiver of recorded commands.
+ */
+class CommandSink
+{
+public:
+    virtual ~CommandSink() = default;
+
+    /**
+     * @brief Record a command.
+     *
+     * The command is only borrowed during the call.
+     *
+     * @param command The command.
+     */
+    virtual void Record(const RenderCommand& command) = 0;
+};
+
+/**
+ * @brief Renderer that only forwards commands to a sink.
+ *
+ * Set as the current renderer while recording, so that the usual draw
+ * API can be used to record.
+ */
+class CommandRecorder final : public Renderer
+{
+public:
+    explicit CommandRecorder(CommandSink& sink);
+    ~CommandRecorder() override = default;
+
+    void Submit(const RenderCommand& command) override;
+
+    void Render() override;
+
+    void Flush() override;
+
+private:
+    CommandSink& _sink;
+};
+
+DGEX_END
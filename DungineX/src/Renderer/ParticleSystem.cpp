@@ -0,0 +1,540 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : ParticleSystem.cpp                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Particles updated in bulk and drawn one emitter at a time.                 *
+ ******************************************************************************/
+
+#include "Renderer/ParticleSystemImpl.h"
+
+#include "Renderer/RenderApiImpl.h"
+#include "Renderer/RenderCommandImpl.h"
+#include "Utils/Simd.h"
+
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Math.h"
+
+#include <algorithm>
+#include <atomic>
+
+DGEX_BEGIN
+
+// ============================================================================
+// Particle Stream
+// ----------------------------------------------------------------------------
+
+ParticleStream::ParticleStream(size_t capacity)
+    : X(capacity), Y(capacity), VelocityX(capacity), VelocityY(capacity), Age(capacity), InverseLife(capacity),
+      Rotation(capacity), Spin(capacity), Scale(capacity), R(capacity), G(capacity), B(capacity), A(capacity)
+{
+}
+
+void ParticleStream::Remove(size_t index)
+{
+    size_t last = --Count;
+    X[index] = X[last];
+    Y[index] = Y[last];
+    VelocityX[index] = VelocityX[last];
+    VelocityY[index] = VelocityY[last];
+    Age[index] = Age[last];
+    InverseLife[index] = InverseLife[last];
+    Rotation[index] = Rotation[last];
+    Spin[index] = Spin[last];
+    Scale[index] = Scale[last];
+    R[index] = R[last];
+    G[index] = G[last];
+    B[index] = B[last];
+    A[index] = A[last];
+}
+
+// ============================================================================
+// Scalar Path
+// ----------------------------------------------------------------------------
+
+void UpdateParticlesScalar(ParticleStream& stream, const ParticleMotion& motion, float seconds, size_t first,
+                           size_t last)
+{
+    // Same operations as the SIMD path, so that both give the same result.
+    float gravityX = motion.GravityX * seconds;
+    float gravityY = motion.GravityY * seconds;
+    float scaleDelta = motion.EndScale - motion.StartScale;
+    float colorDelta[4];
+    for (int c = 0; c < 4; c++)
+    {
+        colorDelta[c] = motion.EndColor[c] - motion.StartColor[c];
+    }
+    float* colors[4] = { stream.R.data(), stream.G.data(), stream.B.data(), stream.A.data() };
+
+    for (size_t i = first; i < last; i++)
+    {
+        float age = stream.Age[i] + seconds;
+        stream.Age[i] = age;
+        float t = Math::Min(age * stream.InverseLife[i], 1.0f);
+
+        float velocityX = stream.VelocityX[i] + gravityX;
+        float velocityY = stream.VelocityY[i] + gravityY;
+        stream.VelocityX[i] = velocityX;
+        stream.VelocityY[i] = velocityY;
+        stream.X[i] = stream.X[i] + velocityX * seconds;
+        stream.Y[i] = stream.Y[i] + velocityY * seconds;
+        stream.Rotation[i] = stream.Rotation[i] + stream.Spin[i] * seconds;
+
+        stream.Scale[i] = motion.StartScale + scaleDelta * t;
+        for (int c = 0; c < 4; c++)
+        {
+            colors[c][i] = motion.StartColor[c] + colorDelta[c] * t;
+        }
+    }
+}
+
+// ============================================================================
+// SIMD Path
+// ----------------------------------------------------------------------------
+// Each instruction set provides Vec with a few operations. The update is
+// element-wise, so the math is shared below.
+// ----------------------------------------------------------------------------
+
+#if defined(DGEX_SIMD_AVX2)
+
+using Vec = __m256;
+static constexpr size_t LANES = 8;
+
+static inline Vec Load(const float* p)
+{
+    return _mm256_loadu_ps(p);
+}
+
+static inline void Store(float* p, Vec v)
+{
+    _mm256_storeu_ps(p, v);
+}
+
+static inline Vec Set1(float value)
+{
+    return _mm256_set1_ps(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return _mm256_add_ps(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return _mm256_mul_ps(a, b);
+}
+
+static inline Vec Min(Vec a, Vec b)
+{
+    return _mm256_min_ps(a, b);
+}
+
+#elif defined(DGEX_SIMD_SSE2)
+
+using Vec = __m128;
+static constexpr size_t LANES = 4;
+
+static inline Vec Load(const float* p)
+{
+    return _mm_loadu_ps(p);
+}
+
+static inline void Store(float* p, Vec v)
+{
+    _mm_storeu_ps(p, v);
+}
+
+static inline Vec Set1(float value)
+{
+    return _mm_set1_ps(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return _mm_add_ps(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return _mm_mul_ps(a, b);
+}
+
+static inline Vec Min(Vec a, Vec b)
+{
+    return _mm_min_ps(a, b);
+}
+
+#elif defined(DGEX_SIMD_NEON)
+
+using Vec = float32x4_t;
+static constexpr size_t LANES = 4;
+
+static inline Vec Load(const float* p)
+{
+    return vld1q_f32(p);
+}
+
+static inline void Store(float* p, Vec v)
+{
+    vst1q_f32(p, v);
+}
+
+static inline Vec Set1(float value)
+{
+    return vdupq_n_f32(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return vaddq_f32(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return vmulq_f32(a, b);
+}
+
+static inline Vec Min(Vec a, Vec b)
+{
+    return vminq_f32(a, b);
+}
+
+#endif
+
+#if defined(DGEX_SIMD_SCALAR)
+
+void UpdateParticles(ParticleStream& stream, const ParticleMotion& motion, float seconds)
+{
+    UpdateParticlesScalar(stream, motion, seconds, 0, stream.Count);
+}
+
+#else
+
+void UpdateParticles(ParticleStream& stream, const ParticleMotion& motion, float seconds)
+{
+    const Vec dt = Set1(seconds);
+    const Vec one = Set1(1.0f);
+    const Vec gravityX = Set1(motion.GravityX * seconds);
+    const Vec gravityY = Set1(motion.GravityY * seconds);
+    const Vec startScale = Set1(motion.StartScale);
+    const Vec scaleDelta = Set1(motion.EndScale - motion.StartScale);
+    Vec startColor[4];
+    Vec colorDelta[4];
+    for (int c = 0; c < 4; c++)
+    {
+        startColor[c] = Set1(motion.StartColor[c]);
+        colorDelta[c] = Set1(motion.EndColor[c] - motion.StartColor[c]);
+    }
+    float* colors[4] = { stream.R.data(), stream.G.data(), stream.B.data(), stream.A.data() };
+
+    size_t i = 0;
+    for (; i + LANES <= stream.Count; i += LANES)
+    {
+        Vec age = Add(Load(&stream.Age[i]), dt);
+        Store(&stream.Age[i], age);
+        Vec t = Min(Mul(age, Load(&stream.InverseLife[i])), one);
+
+        Vec velocityX = Add(Load(&stream.VelocityX[i]), gravityX);
+        Vec velocityY = Add(Load(&stream.VelocityY[i]), gravityY);
+        Store(&stream.VelocityX[i], velocityX);
+        Store(&stream.VelocityY[i], velocityY);
+        Store(&stream.X[i], Add(Load(&stream.X[i]), Mul(velocityX, dt)));
+        Store(&stream.Y[i], Add(Load(&stream.Y[i]), Mul(velocityY, dt)));
+        Store(&stream.Rotation[i], Add(Load(&stream.Rotation[i]), Mul(Load(&stream.Spin[i]), dt)));
+
+        Store(&stream.Scale[i], Add(startScale, Mul(scaleDelta, t)));
+        for (int c = 0; c < 4; c++)
+        {
+            Store(colors[c] + i, Add(startColor[c], Mul(colorDelta[c], t)));
+        }
+    }
+
+    UpdateParticlesScalar(stream, motion, seconds, i, stream.Count);
+}
+
+#endif
+
+void RemoveDeadParticles(ParticleStream& stream)
+{
+    size_t i = 0;
+    while (i < stream.Count)
+    {
+        if (stream.Age[i] * stream.InverseLife[i] >= 1.0f)
+        {
+            stream.Remove(i); // check the one moved in
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+const char* GetParticlePath()
+{
+    return DGEX_SIMD_NAME;
+}
+
+// ============================================================================
+// Particle Emitter
+// ----------------------------------------------------------------------------
+
+static uint32_t NextSeed()
+{
+    // Emitters must not share a sequence, and xorshift never leaves zero.
+    static std::atomic<uint32_t> sCounter(0);
+    return ((sCounter.fetch_add(1, std::memory_order_relaxed) + 1) * 0x9E3779B9u) | 1u;
+}
+
+static void ToFloatColor(const Color& color, float* out)
+{
+    out[0] = static_cast<float>(color.R) / 255.0f;
+    out[1] = static_cast<float>(color.G) / 255.0f;
+    out[2] = static_cast<float>(color.B) / 255.0f;
+    out[3] = static_cast<float>(color.A) / 255.0f;
+}
+
+ParticleEmitterImpl::ParticleEmitterImpl(const ParticleEmitterDesc& desc)
+    : _desc(desc), _texture(desc.Texture.Texture->GetHandle()), _stream(desc.Capacity), _motion(), _u0(0.0f),
+      _v0(0.0f), _u1(1.0f), _v1(1.0f), _halfWidth(0.0f), _halfHeight(0.0f), _rotates(false), _x(0.0f), _y(0.0f),
+      _rate(desc.Rate), _pending(0.0f), _seed(NextSeed()), _vertices(desc.Capacity * 4), _indices(desc.Capacity * 6)
+{
+    // Region in pixels, whole texture if empty.
+    auto textureWidth = static_cast<float>(desc.Texture.Texture->GetWidth());
+    auto textureHeight = static_cast<float>(desc.Texture.Texture->GetHeight());
+    const Rect& region = desc.Texture.Region;
+    bool whole = (region.Width <= 0) || (region.Height <= 0);
+    float width = whole ? textureWidth : static_cast<float>(region.Width);
+    float height = whole ? textureHeight : static_cast<float>(region.Height);
+    if (!whole && (textureWidth > 0.0f) && (textureHeight > 0.0f))
+    {
+        _u0 = static_cast<float>(region.X) / textureWidth;
+        _v0 = static_cast<float>(region.Y) / textureHeight;
+        _u1 = static_cast<float>(region.X + region.Width) / textureWidth;
+        _v1 = static_cast<float>(region.Y + region.Height) / textureHeight;
+    }
+    _halfWidth = width * 0.5f;
+    _halfHeight = height * 0.5f;
+    _rotates = (desc.MinRotation != 0.0f) || (desc.MaxRotation != 0.0f) || (desc.MinSpin != 0.0f) ||
+               (desc.MaxSpin != 0.0f);
+
+    _motion.GravityX = desc.GravityX;
+    _motion.GravityY = desc.GravityY;
+    _motion.StartScale = desc.StartScale;
+    _motion.EndScale = desc.EndScale;
+    ToFloatColor(desc.StartColor, _motion.StartColor);
+    ToFloatColor(desc.EndColor, _motion.EndColor);
+
+    // Quads never change order within a vertex array, so neither do indices.
+    for (size_t i = 0; i < desc.Capacity; i++)
+    {
+        int base = static_cast<int>(i * 4);
+        int* quad = _indices.data() + i * 6;
+        quad[0] = base;
+        quad[1] = base + 1;
+        quad[2] = base + 2;
+        quad[3] = base + 2;
+        quad[4] = base + 3;
+        quad[5] = base;
+    }
+}
+
+void ParticleEmitterImpl::SetPosition(float x, float y)
+{
+    _x = x;
+    _y = y;
+}
+
+void ParticleEmitterImpl::SetRate(float rate)
+{
+    _rate = rate;
+}
+
+size_t ParticleEmitterImpl::Burst(size_t count)
+{
+    ParticleStream& stream = _stream;
+    size_t spawned = std::min(count, _desc.Capacity - stream.Count);
+    for (size_t n = 0; n < spawned; n++)
+    {
+        size_t i = stream.Count++;
+        float life = Math::Max(Random(_desc.MinLife, _desc.MaxLife), 0.001f);
+        float direction = Math::ToRadians(Random(_desc.MinDirection, _desc.MaxDirection));
+        float speed = Random(_desc.MinSpeed, _desc.MaxSpeed);
+
+        stream.X[i] = _x;
+        stream.Y[i] = _y;
+        stream.VelocityX[i] = Math::Cos(direction) * speed;
+        stream.VelocityY[i] = Math::Sin(direction) * speed;
+        stream.Age[i] = 0.0f;
+        stream.InverseLife[i] = 1.0f / life;
+        stream.Rotation[i] = Random(_desc.MinRotation, _desc.MaxRotation);
+        stream.Spin[i] = Random(_desc.MinSpin, _desc.MaxSpin);
+        stream.Scale[i] = _motion.StartScale;
+        stream.R[i] = _motion.StartColor[0];
+        stream.G[i] = _motion.StartColor[1];
+        stream.B[i] = _motion.StartColor[2];
+        stream.A[i] = _motion.StartColor[3];
+    }
+    return spawned;
+}
+
+void ParticleEmitterImpl::Clear()
+{
+    _stream.Count = 0;
+    _pending = 0.0f;
+}
+
+size_t ParticleEmitterImpl::GetParticleCount() const
+{
+    return _stream.Count;
+}
+
+size_t ParticleEmitterImpl::GetCapacity() const
+{
+    return _desc.Capacity;
+}
+
+void ParticleEmitterImpl::Update(float seconds)
+{
+    UpdateParticles(_stream, _motion, seconds);
+    RemoveDeadParticles(_stream);
+
+    // New particles start where the emitter is, and move from next update.
+    if (_rate > 0.0f)
+    {
+        _pending += _rate * seconds;
+        auto count = static_cast<size_t>(_pending);
+        _pending -= static_cast<float>(count);
+        Burst(count);
+    }
+}
+
+void ParticleEmitterImpl::Submit()
+{
+    const ParticleStream& stream = _stream;
+    if (stream.Count == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < stream.Count; i++)
+    {
+        float halfWidth = _halfWidth * stream.Scale[i];
+        float halfHeight = _halfHeight * stream.Scale[i];
+
+        // Half axes of the quad, rotated only if needed, as trigonometry is
+        // most of the cost.
+        float ax = halfWidth;
+        float ay = 0.0f;
+        float bx = 0.0f;
+        float by = halfHeight;
+        if (_rotates)
+        {
+            float radians = Math::ToRadians(stream.Rotation[i]);
+            float c = Math::Cos(radians);
+            float s = Math::Sin(radians);
+            ax = halfWidth * c;
+            ay = halfWidth * s;
+            bx = -halfHeight * s;
+            by = halfHeight * c;
+        }
+
+        float x = stream.X[i];
+        float y = stream.Y[i];
+        SDL_FColor color{ stream.R[i], stream.G[i], stream.B[i], stream.A[i] };
+        SDL_Vertex* quad = _vertices.data() + i * 4;
+        quad[0] = { { x - ax - bx, y - ay - by }, color, { _u0, _v0 } };
+        quad[1] = { { x + ax - bx, y + ay - by }, color, { _u1, _v0 } };
+        quad[2] = { { x + ax + bx, y + ay + by }, color, { _u1, _v1 } };
+        quad[3] = { { x - ax + bx, y - ay + by }, color, { _u0, _v1 } };
+    }
+
+    GeometryRenderCommand command{ { RenderCommandType::Geometry, _desc.Z },
+                                   _texture,
+                                   _vertices.data(),
+                                   _indices.data(),
+                                   static_cast<int>(stream.Count * 4),
+                                   static_cast<int>(stream.Count * 6),
+                                   static_cast<uint32_t>(stream.Count) };
+    SubmitRenderCommand(command);
+}
+
+float ParticleEmitterImpl::Random(float min, float max)
+{
+    // Reference: George Marsaglia, Xorshift RNGs, 2003.
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return min + (max - min) * static_cast<float>(_seed >> 8) * (1.0f / 16777216.0f);
+}
+
+// ============================================================================
+// Particle System
+// ----------------------------------------------------------------------------
+
+Ref<ParticleEmitter> ParticleSystemImpl::AddEmitter(const ParticleEmitterDesc& desc)
+{
+    DGEX_ASSERT(desc.Texture.Texture, "Particle emitter without texture");
+
+    auto emitter = CreateRef<ParticleEmitterImpl>(desc);
+    _emitters.push_back(emitter);
+    return emitter;
+}
+
+void ParticleSystemImpl::RemoveEmitter(const Ref<ParticleEmitter>& emitter)
+{
+    auto it = std::find(_emitters.begin(), _emitters.end(), emitter);
+    if (it != _emitters.end())
+    {
+        _emitters.erase(it); // keep the order of submission
+    }
+}
+
+void ParticleSystemImpl::Update(float seconds)
+{
+    for (const Ref<ParticleEmitterImpl>& emitter : _emitters)
+    {
+        emitter->Update(seconds);
+    }
+}
+
+void ParticleSystemImpl::Submit()
+{
+    for (const Ref<ParticleEmitterImpl>& emitter : _emitters)
+    {
+        emitter->Submit();
+    }
+}
+
+size_t ParticleSystemImpl::GetParticleCount() const
+{
+    size_t count = 0;
+    for (const Ref<ParticleEmitterImpl>& emitter : _emitters)
+    {
+        count += emitter->GetParticleCount();
+    }
+    return count;
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<ParticleSystem> CreateParticleSystem()
+{
+    return CreateRef<ParticleSystemImpl>();
+}
+
+DGEX_END
@@ -0,0 +1,171 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : ParticleSystemImpl.h                      *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Particles updated in bulk and drawn one emitter at a time.                 *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/ParticleSystem.h"
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Live particles of an emitter in structure-of-arrays layout.
+ *
+ * Arrays are sized to the capacity once, and live particles are kept
+ * packed at the front, so that they are updated in whole registers.
+ */
+struct ParticleStream
+{
+    std::vector<float> X; // center in the world
+    std::vector<float> Y;
+    std::vector<float> VelocityX; // in pixels per second
+    std::vector<float> VelocityY;
+    std::vector<float> Age;         // in seconds
+    std::vector<float> InverseLife; // 1 over life, so that age becomes 0 ~ 1 by product
+    std::vector<float> Rotation;    // in degree
+    std::vector<float> Spin;        // in degree per second
+    std::vector<float> Scale;
+    std::vector<float> R; // color, 0 ~ 1
+    std::vector<float> G;
+    std::vector<float> B;
+    std::vector<float> A;
+    size_t Count = 0;
+
+    explicit ParticleStream(size_t capacity);
+
+    /**
+     * @brief Move the last particle into a slot, and drop the last.
+     */
+    void Remove(size_t index);
+};
+
+/**
+ * @brief What an update does to every particle of an emitter.
+ */
+struct ParticleMotion
+{
+    float GravityX;
+    float GravityY;
+    float StartScale;
+    float EndScale;
+    float StartColor[4];
+    float EndColor[4];
+};
+
+/**
+ * @brief Age, move, spin, scale and color particles.
+ *
+ * Uses the best instruction set chosen at build time, see Simd.h. Dead
+ * particles are updated as well, see RemoveDeadParticles.
+ *
+ * @param stream Particles to update.
+ * @param motion What to do to them.
+ * @param seconds Time since the last update.
+ */
+void UpdateParticles(ParticleStream& stream, const ParticleMotion& motion, float seconds);
+
+/**
+ * @brief Update particles one by one, without SIMD.
+ *
+ * Reference of UpdateParticles, also used for the remainder.
+ *
+ * @param first Index of the first particle to update.
+ * @param last Index past the last particle to update.
+ */
+void UpdateParticlesScalar(ParticleStream& stream, const ParticleMotion& motion, float seconds, size_t first,
+                           size_t last);
+
+/**
+ * @brief Remove particles older than their life.
+ */
+void RemoveDeadParticles(ParticleStream& stream);
+
+/**
+ * @brief Get the name of the instruction set used.
+ */
+const char* GetParticlePath();
+
+class ParticleEmitterImpl final : public ParticleEmitter
+{
+public:
+    explicit ParticleEmitterImpl(const ParticleEmitterDesc& desc);
+    ~ParticleEmitterImpl() override = default;
+
+    void SetPosition(float x, float y) override;
+    void SetRate(float rate) override;
+    size_t Burst(size_t count) override;
+    void Clear() override;
+    size_t GetParticleCount() const override;
+    size_t GetCapacity() const override;
+
+    void Update(float seconds);
+
+    /**
+     * @brief Generate vertices of live particles, and submit them.
+     */
+    void Submit();
+
+private:
+    /**
+     * @brief Get a random number in a range, xorshift32.
+     */
+    float Random(float min, float max);
+
+private:
+    ParticleEmitterDesc _desc;
+    TextureHandle _texture;
+    ParticleStream _stream;
+    ParticleMotion _motion;
+
+    float _u0, _v0, _u1, _v1; // region in texture coordinates
+    float _halfWidth;         // half size of the region, in pixels
+    float _halfHeight;
+    bool _rotates; // whether any particle may rotate
+
+    float _x;
+    float _y;
+    float _rate;
+    float _pending; // fraction of a particle to spawn
+    uint32_t _seed;
+
+    std::vector<SDL_Vertex> _vertices; // capacity * 4, held until the next Submit
+    std::vector<int> _indices;         // capacity * 6, the same every frame
+};
+
+class ParticleSystemImpl final : public ParticleSystem
+{
+public:
+    ParticleSystemImpl() = default;
+    ~ParticleSystemImpl() override = default;
+
+    Ref<ParticleEmitter> AddEmitter(const ParticleEmitterDesc& desc) override;
+    void RemoveEmitter(const Ref<ParticleEmitter>& emitter) override;
+    void Update(float seconds) override;
+    void Submit() override;
+    size_t GetParticleCount() const override;
+
+private:
+    std::vector<Ref<ParticleEmitterImpl>> _emitters;
+};
+
+DGEX_END
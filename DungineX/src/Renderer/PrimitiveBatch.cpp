@@ -0,0 +1,246 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : PrimitiveBatch.cpp                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Merge runs of points, lines and rectangles into one draw call.             *
+ ******************************************************************************/
+
+#include "Renderer/PrimitiveBatch.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+
+#include "DgeX/Utils/Assert.h"
+
+DGEX_BEGIN
+
+static bool IsSameColor(const Color& lhs, const Color& rhs)
+{
+    return (lhs.R == rhs.R) && (lhs.G == rhs.G) && (lhs.B == rhs.B) && (lhs.A == rhs.A);
+}
+
+/**
+ * @brief Get the color of a primitive command.
+ */
+static const Color& GetPrimitiveColor(const RenderCommand& command)
+{
+    switch (command.Type)
+    {
+    case RenderCommandType::Point:
+        return static_cast<const PointRenderCommand&>(command).LineColor;
+    case RenderCommandType::Line:
+        return static_cast<const LineRenderCommand&>(command).LineColor;
+    default:
+        return static_cast<const RectRenderCommand&>(command).DrawColor;
+    }
+}
+
+PrimitiveBatch::PrimitiveBatch()
+    : _type(RenderCommandType::Point), _color(), _uniformColor(true), _axisAligned(true), _count(0)
+{
+}
+
+bool PrimitiveBatch::IsPrimitive(const RenderCommand& command)
+{
+    switch (command.Type)
+    {
+    case RenderCommandType::Point:
+    case RenderCommandType::Line:
+    case RenderCommandType::Rect:
+    case RenderCommandType::FilledRect:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool PrimitiveBatch::CanBatch(const RenderCommand& command) const
+{
+    DGEX_ASSERT((command.Type != RenderCommandType::Rect) ||
+                    IsAxisAlignedRect(static_cast<const RectRenderCommand&>(command)),
+                "Rotated outline must be drawn as lines");
+
+    if (_count == 0)
+    {
+        return true;
+    }
+    if (command.Type != _type)
+    {
+        return false;
+    }
+
+    switch (command.Type)
+    {
+    case RenderCommandType::Line: {
+        // Only connected lines make a polyline.
+        const auto& line = static_cast<const LineRenderCommand&>(command);
+        SDL_FPoint start = TransformPoint(line, line.X1, line.Y1);
+        const SDL_FPoint& last = _points.back();
+        return IsSameColor(line.LineColor, _color) && (start.x == last.x) && (start.y == last.y);
+    }
+    case RenderCommandType::FilledRect:
+        // Mixed colors fall back to geometry.
+        return true;
+    default:
+        return IsSameColor(GetPrimitiveColor(command), _color);
+    }
+}
+
+void PrimitiveBatch::Add(const RenderCommand& command)
+{
+    DGEX_ASSERT(IsPrimitive(command) && CanBatch(command), "Primitive cannot be batched");
+
+    const Color& color = GetPrimitiveColor(command);
+    if (_count == 0)
+    {
+        _type = command.Type;
+        _color = color;
+        _uniformColor = true;
+        _axisAligned = true;
+    }
+
+    // Transforms are applied here, as primitives are added to the batch.
+    switch (command.Type)
+    {
+    case RenderCommandType::Point: {
+        const auto& point = static_cast<const PointRenderCommand&>(command);
+        _points.push_back(TransformPoint(point, point.X, point.Y));
+        break;
+    }
+    case RenderCommandType::Line: {
+        const auto& line = static_cast<const LineRenderCommand&>(command);
+        if (_points.empty())
+        {
+            _points.push_back(TransformPoint(line, line.X1, line.Y1));
+        }
+        _points.push_back(TransformPoint(line, line.X2, line.Y2));
+        break;
+    }
+    case RenderCommandType::Rect:
+        _rects.push_back(GetTransformedRect(static_cast<const RectRenderCommand&>(command)));
+        break;
+    case RenderCommandType::FilledRect: {
+        // Keep both forms, as we only know which one to draw on flush.
+        const auto& rect = static_cast<const RectRenderCommand&>(command);
+        size_t base = _points.size();
+        _points.resize(base + 4);
+        GetRectCorners(rect, _points.data() + base);
+        if (IsAxisAlignedRect(rect))
+        {
+            _rects.push_back(GetTransformedRect(rect));
+        }
+        else
+        {
+            _axisAligned = false;
+        }
+        _colors.push_back(color);
+        _uniformColor = _uniformColor && IsSameColor(color, _color);
+        break;
+    }
+    default:
+        break;
+    }
+
+    _count++;
+}
+
+// References:
+// - https://wiki.libsdl.org/SDL3/SDL_RenderPoints
+// - https://wiki.libsdl.org/SDL3/SDL_RenderLines
+// - https://wiki.libsdl.org/SDL3/SDL_RenderRects
+// - https://wiki.libsdl.org/SDL3/SDL_RenderFillRects
+bool PrimitiveBatch::Flush(SDL_Renderer* renderer)
+{
+    if (_count == 0)
+    {
+        return false;
+    }
+
+    switch (_type)
+    {
+    case RenderCommandType::Point:
+        GetRenderStateCache().SetDrawColor(_color.R, _color.G, _color.B, _color.A);
+        SDL_RenderPoints(renderer, _points.data(), static_cast<int>(_points.size()));
+        break;
+    case RenderCommandType::Line:
+        GetRenderStateCache().SetDrawColor(_color.R, _color.G, _color.B, _color.A);
+        SDL_RenderLines(renderer, _points.data(), static_cast<int>(_points.size()));
+        break;
+    case RenderCommandType::Rect:
+        GetRenderStateCache().SetDrawColor(_color.R, _color.G, _color.B, _color.A);
+        SDL_RenderRects(renderer, _rects.data(), static_cast<int>(_rects.size()));
+        break;
+    case RenderCommandType::FilledRect:
+        FlushFilledRects(renderer);
+        break;
+    default:
+        break;
+    }
+
+    _points.clear();
+    _rects.clear();
+    _colors.clear();
+    _count = 0;
+
+    return true;
+}
+
+bool PrimitiveBatch::IsEmpty() const
+{
+    return _count == 0;
+}
+
+size_t PrimitiveBatch::GetPrimitiveCount() const
+{
+    return _count;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_RenderGeometry
+void PrimitiveBatch::FlushFilledRects(SDL_Renderer* renderer)
+{
+    if (_uniformColor && _axisAligned)
+    {
+        GetRenderStateCache().SetDrawColor(_color.R, _color.G, _color.B, _color.A);
+        SDL_RenderFillRects(renderer, _rects.data(), static_cast<int>(_rects.size()));
+        return;
+    }
+
+    // Untextured geometry uses the draw blend mode, same as filled rects.
+    for (size_t i = 0; i < _colors.size(); i++)
+    {
+        const SDL_FPoint* corners = _points.data() + i * 4;
+        SDL_FColor color = ToFColor(_colors[i]);
+        int base = static_cast<int>(_vertices.size());
+
+        for (int j = 0; j < 4; j++)
+        {
+            _vertices.push_back({ corners[j], color, { 0.0f, 0.0f } });
+        }
+
+        _indices.push_back(base);
+        _indices.push_back(base + 1);
+        _indices.push_back(base + 2);
+        _indices.push_back(base + 2);
+        _indices.push_back(base + 3);
+        _indices.push_back(base);
+    }
+
+    SDL_RenderGeometry(renderer, nullptr, _vertices.data(), static_cast<int>(_vertices.size()), _indices.data(),
+                       static_cast<int>(_indices.size()));
+
+    _vertices.clear();
+    _indices.clear();
+}
+
+DGEX_END
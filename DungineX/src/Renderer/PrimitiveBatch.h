@@ -0,0 +1,107 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : PrimitiveBatch.h                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Merge runs of points, lines and rectangles into one draw call.             *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/RenderCommandImpl.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Accumulate primitives of one type into a single draw call.
+ *
+ * - Points and outlined rectangles of the same color are drawn with
+ *   SDL_RenderPoints and SDL_RenderRects.
+ * - Lines of the same color that connect end to start are drawn as one
+ *   polyline with SDL_RenderLines.
+ * - Filled rectangles are drawn with SDL_RenderFillRects if they share
+ *   one color and are not rotated, otherwise as geometry with per-vertex
+ *   color.
+ *
+ * Outlined rectangles rotated by their transform are not rectangles any
+ * more, and must be split into lines before being added.
+ */
+class PrimitiveBatch
+{
+public:
+    PrimitiveBatch();
+    PrimitiveBatch(const PrimitiveBatch& other) = delete;
+    PrimitiveBatch(PrimitiveBatch&& other) noexcept = default;
+    PrimitiveBatch& operator=(const PrimitiveBatch& other) = delete;
+    PrimitiveBatch& operator=(PrimitiveBatch&& other) noexcept = default;
+
+    ~PrimitiveBatch() = default;
+
+    /**
+     * @brief Check whether the command is a primitive at all.
+     */
+    static bool IsPrimitive(const RenderCommand& command);
+
+    /**
+     * @brief Check whether the primitive can join the current batch.
+     *
+     * @param command Primitive command, see IsPrimitive.
+     * @return Whether it can be drawn together with the batch.
+     */
+    bool CanBatch(const RenderCommand& command) const;
+
+    /**
+     * @brief Add a primitive to the batch.
+     *
+     * @param command Primitive command, must pass CanBatch.
+     */
+    void Add(const RenderCommand& command);
+
+    /**
+     * @brief Draw all primitives in the batch, and clear it.
+     *
+     * @param renderer The native renderer.
+     * @return Whether a draw call is issued, i.e. the batch is not empty.
+     */
+    bool Flush(SDL_Renderer* renderer);
+
+    bool IsEmpty() const;
+
+    /**
+     * @brief Get the number of primitives in the current batch.
+     */
+    size_t GetPrimitiveCount() const;
+
+private:
+    void FlushFilledRects(SDL_Renderer* renderer);
+
+private:
+    RenderCommandType _type;
+    Color _color;       // color of the first primitive
+    bool _uniformColor; // whether all primitives share _color
+    bool _axisAligned;  // whether all filled rectangles are not rotated
+    size_t _count;
+
+    std::vector<SDL_FPoint> _points; // for points, lines, and corners of filled rectangles
+    std::vector<SDL_FRect> _rects;   // for rectangles
+    std::vector<Color> _colors;      // for filled rectangles
+
+    // Geometry for filled rectangles of mixed colors.
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices;
+};
+
+DGEX_END
@@ -0,0 +1,173 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RectPacker.cpp                            *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * MaxRects bin packing for texture atlases.                                  *
+ ******************************************************************************/
+
+#include "Renderer/RectPacker.h"
+
+#include <climits>
+
+DGEX_BEGIN
+
+RectPacker::RectPacker(int width, int height) : _width(width), _height(height), _rectCount(0), _usedArea(0)
+{
+    _free.emplace_back(0, 0, width, height);
+}
+
+bool RectPacker::Insert(int width, int height, Rect& rect)
+{
+    if ((width <= 0) || (height <= 0))
+    {
+        return false;
+    }
+
+    // Best short side fit, ties broken by the long side.
+    const Rect* best = nullptr;
+    int bestShort = INT_MAX;
+    int bestLong = INT_MAX;
+    for (const Rect& free : _free)
+    {
+        if ((free.Width < width) || (free.Height < height))
+        {
+            continue;
+        }
+        int leftoverX = free.Width - width;
+        int leftoverY = free.Height - height;
+        int shortSide = leftoverX < leftoverY ? leftoverX : leftoverY;
+        int longSide = leftoverX < leftoverY ? leftoverY : leftoverX;
+        if ((shortSide < bestShort) || ((shortSide == bestShort) && (longSide < bestLong)))
+        {
+            best = &free;
+            bestShort = shortSide;
+            bestLong = longSide;
+        }
+    }
+    if (!best)
+    {
+        return false;
+    }
+
+    rect = Rect(best->X, best->Y, width, height);
+    Place(rect);
+
+    _rectCount++;
+    _usedArea += static_cast<int64_t>(width) * height;
+
+    return true;
+}
+
+int RectPacker::GetWidth() const
+{
+    return _width;
+}
+
+int RectPacker::GetHeight() const
+{
+    return _height;
+}
+
+int RectPacker::GetRectCount() const
+{
+    return _rectCount;
+}
+
+int64_t RectPacker::GetUsedArea() const
+{
+    return _usedArea;
+}
+
+float RectPacker::GetOccupancy() const
+{
+    return static_cast<float>(static_cast<double>(_usedArea) / (static_cast<double>(_width) * _height));
+}
+
+void RectPacker::Place(const Rect& used)
+{
+    int usedRight = used.X + used.Width;
+    int usedBottom = used.Y + used.Height;
+
+    _split.clear();
+    size_t i = 0;
+    while (i < _free.size())
+    {
+        Rect free = _free[i];
+        int freeRight = free.X + free.Width;
+        int freeBottom = free.Y + free.Height;
+        if ((used.X >= freeRight) || (usedRight <= free.X) || (used.Y >= freeBottom) || (usedBottom <= free.Y))
+        {
+            i++;
+            continue;
+        }
+
+        // Keep the maximal parts on each side of the used rectangle.
+        if (used.X > free.X)
+        {
+            _split.emplace_back(free.X, free.Y, used.X - free.X, free.Height);
+        }
+        if (usedRight < freeRight)
+        {
+            _split.emplace_back(usedRight, free.Y, freeRight - usedRight, free.Height);
+        }
+        if (used.Y > free.Y)
+        {
+            _split.emplace_back(free.X, free.Y, free.Width, used.Y - free.Y);
+        }
+        if (usedBottom < freeBottom)
+        {
+            _split.emplace_back(free.X, usedBottom, free.Width, freeBottom - usedBottom);
+        }
+
+        _free[i] = _free.back();
+        _free.pop_back();
+    }
+
+    _free.insert(_free.end(), _split.begin(), _split.end());
+    Prune();
+}
+
+static bool Contains(const Rect& outer, const Rect& inner)
+{
+    return (inner.X >= outer.X) && (inner.Y >= outer.Y) && (inner.X + inner.Width <= outer.X + outer.Width) &&
+           (inner.Y + inner.Height <= outer.Y + outer.Height);
+}
+
+void RectPacker::Prune()
+{
+    for (size_t i = 0; i < _free.size(); i++)
+    {
+        for (size_t j = i + 1; j < _free.size();)
+        {
+            if (Contains(_free[i], _free[j]))
+            {
+                _free[j] = _free.back();
+                _free.pop_back();
+            }
+            else if (Contains(_free[j], _free[i]))
+            {
+                _free[i] = _free.back();
+                _free.pop_back();
+                j = i + 1; // recheck the one moved in
+            }
+            else
+            {
+                j++;
+            }
+        }
+    }
+}
+
+DGEX_END
@@ -0,0 +1,93 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RectPacker.h                              *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * MaxRects bin packing for texture atlases.                                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+#include "DgeX/Utils/Types.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Pack rectangles into a fixed size bin, one at a time.
+ *
+ * Keeps all maximal free rectangles, and puts a new rectangle where it
+ * leaves the shortest side, i.e. best short side fit. Rectangles are
+ * never moved or rotated once placed, so that regions handed out stay
+ * valid while more are added.
+ *
+ * Reference: Jukka Jylanki, A Thousand Ways to Pack the Bin, 2010.
+ */
+class RectPacker
+{
+public:
+    RectPacker(int width, int height);
+
+    /**
+     * @brief Find a place for a rectangle.
+     *
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param rect Receives the place on success.
+     * @return Whether there is enough room.
+     */
+    bool Insert(int width, int height, Rect& rect);
+
+    int GetWidth() const;
+    int GetHeight() const;
+
+    /**
+     * @brief Get the number of rectangles placed.
+     */
+    int GetRectCount() const;
+
+    /**
+     * @brief Get the area covered by placed rectangles.
+     */
+    int64_t GetUsedArea() const;
+
+    /**
+     * @brief Get the fraction of the bin covered, 0 ~ 1.
+     */
+    float GetOccupancy() const;
+
+private:
+    /**
+     * @brief Cut the used rectangle out of all free rectangles.
+     */
+    void Place(const Rect& used);
+
+    /**
+     * @brief Remove free rectangles contained in another one.
+     */
+    void Prune();
+
+private:
+    int _width;
+    int _height;
+    int _rectCount;
+    int64_t _usedArea;
+
+    std::vector<Rect> _free;
+    std::vector<Rect> _split; // scratch for Place
+};
+
+DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 3, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -19,20 +19,34 @@
 
 #include "DgeX/Renderer/RenderApi.h"
 
+#include "Device/Graphics/RenderStateCache.h"
+#include "Renderer/RenderApiImpl.h"
 #include "Renderer/RenderCommandImpl.h"
+#include "Renderer/TextureLoaderImpl.h"
+#include "Renderer/TextureRegistry.h"
+#include "Renderer/TextureResidencyImpl.h"
 
 #include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/MainLoop.h"
 #include "DgeX/Renderer/Font.h"
 #include "DgeX/Renderer/Texture.h"
 #include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Math.h"
 
 #include <SDL3/SDL.h>
-#include <SDL_FontCache/SDL_FontCache.h>
 
+#include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cmath>
+#include <mutex>
+#include <vector>
 
 DGEX_BEGIN
 
+/**
+ * @brief Recording state of one thread.
+ */
 struct RenderApiContext
 {
     Color ClearColor;
@@ -42,30 +56,108 @@ struct RenderApiContext
     Color FontColor;
     Ref<Font> Font;
     float FontSize;
+
+    Ref<Renderer> ActiveRenderer;
+
+    ViewCullingState View;
+
+    Transform CurrentTransform;
+    std::vector<Transform> TransformStack;
+    bool HasTransform; // whether CurrentTransform is not identity
 };
 
-static Ref<Renderer> sActiveRenderer = nullptr;
+// Render target is bound to the native renderer, so it is not per thread.
 static Ref<Texture> sActiveRenderTarget = nullptr;
 
-static RenderApiContext sContext;
+// Size of the render target, for view culling of all threads.
+static std::atomic<int> sTargetWidth{ 0 };
+static std::atomic<int> sTargetHeight{ 0 };
 
-dgex_error_t InitRenderApi()
+// Culling counters of the current frame, and the published last frame.
+static std::atomic<uint32_t> sKeptCount{ 0 };
+static std::atomic<uint32_t> sCulledCount{ 0 };
+static CullingStatistics sCullingStatistics{};
+
+// Every thread starts with the default font.
+static Ref<Font> sDefaultFont = nullptr;
+
+static RenderApiContext MakeDefaultContext()
+{
+    return { Color::Black, Color::White, Color::White, Color::White, sDefaultFont, 16.0f, nullptr,
+             { true, false, { 0.0f, 0.0f, 0.0f, 0.0f } },
+             Transform(),
+             {},
+             false };
+}
+
+// Contexts of living threads, so that fonts and renderers they hold do not
+// outlive DestroyRenderApi.
+static std::mutex sContextMutex;
+static std::vector<RenderApiContext*> sContexts;
+
+/**
+ * @brief Context of a thread, registered while the thread lives.
+ */
+struct ThreadContext : RenderApiContext
+{
+    ThreadContext() : RenderApiContext(MakeDefaultContext())
+    {
+        std::lock_guard<std::mutex> lock(sContextMutex);
+        sContexts.push_back(this);
+    }
+
+    ThreadContext(const ThreadContext& other) = delete;
+    ThreadContext(ThreadContext&& other) noexcept = delete;
+    ThreadContext& operator=(const ThreadContext& other) = delete;
+    ThreadContext& operator=(ThreadContext&& other) noexcept = delete;
+
+    ~ThreadContext()
+    {
+        std::lock_guard<std::mutex> lock(sContextMutex);
+        sContexts.erase(std::find(sContexts.begin(), sContexts.end(), this));
+    }
+};
+
+// Each thread records with its own state, so workers can draw in parallel.
+static thread_local ThreadContext sContext;
+
+/**
+ * @brief Reset contexts of all threads.
+ *
+ * Other threads must not record meanwhile, as for init and destroy.
+ */
+static void ResetContexts(const RenderApiContext& context)
+{
+    std::lock_guard<std::mutex> lock(sContextMutex);
+    for (RenderApiContext* threadContext : sContexts)
+    {
+        *threadContext = context;
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_GetCurrentRenderOutputSize
+static void UpdateTargetSize()
 {
-    // Initialize context.
-    sContext.ClearColor = Color::Black;
-    sContext.LineColor = Color::White;
-    sContext.FillColor = Color::White;
-    sContext.FontColor = Color::White;
-    sContext.Font = nullptr;
-    sContext.FontSize = 16.0f;
+    int width = 0;
+    int height = 0;
+    SDL_GetCurrentRenderOutputSize(GetNativeRenderer(), &width, &height);
+    sTargetWidth.store(width, std::memory_order_relaxed);
+    sTargetHeight.store(height, std::memory_order_relaxed);
+}
 
+dgex_error_t InitRenderApi()
+{
     Ref<Font> font = LoadFont("C:/Windows/Fonts/Arial.ttf");
     if (!font)
     {
         DGEX_CORE_ERROR("Failed to load default system font");
         return DGEX_ERROR_RENDERER_API_INIT;
     }
-    SetFont(font);
+    sDefaultFont = font;
+
+    // Initialize contexts, including those of threads already running.
+    ResetContexts(MakeDefaultContext());
+    UpdateTargetSize();
 
     DGEX_CORE_DEBUG("Render API initialized");
 
@@ -74,17 +166,25 @@ dgex_error_t InitRenderApi()
 
 void DestroyRenderApi()
 {
+    ResetContexts({});
+    sDefaultFont = nullptr;
+
     DGEX_CORE_DEBUG("Render API destroyed");
 }
 
 void SetCurrentRenderer(const Ref<Renderer>& renderer)
 {
-    sActiveRenderer = renderer;
+    // Held commands of the last renderer belong to the current state.
+    if (sContext.ActiveRenderer && (sContext.ActiveRenderer != renderer) && IsRenderThread())
+    {
+        sContext.ActiveRenderer->Flush();
+    }
+    sContext.ActiveRenderer = renderer;
 }
 
 Ref<Renderer> GetCurrentRenderer()
 {
-    return sActiveRenderer;
+    return sContext.ActiveRenderer;
 }
 
 RendererGuard::RendererGuard(const Ref<Renderer>& renderer) : _lastRenderer(GetCurrentRenderer())
@@ -100,11 +200,20 @@ RendererGuard::~RendererGuard()
 // Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderTarget
 void SetCurrentRenderTarget(const Ref<Texture>& texture)
 {
+    DGEX_ASSERT(IsRenderThread(), "Render target can only be set on the render thread");
+
+    // Held commands must land on the old target.
+    if (sContext.ActiveRenderer)
+    {
+        sContext.ActiveRenderer->Flush();
+    }
+
     sActiveRenderTarget = texture;
 
     SDL_Texture* target = sActiveRenderTarget ? sActiveRenderTarget->GetNativeTexture() : nullptr;
 
-    SDL_SetRenderTarget(GetNativeRenderer(), target);
+    GetRenderStateCache().SetRenderTarget(target);
+    UpdateTargetSize();
 }
 
 Ref<Texture> GetCurrentRenderTarget()
@@ -123,22 +232,162 @@ RenderTargetGuard::~RenderTargetGuard()
 }
 
 // ============================================================================
-// Render Property Settings
-// ----------------------------------------------------------------------------
-// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderDrawColor
+// View Culling
 // ----------------------------------------------------------------------------
 
+void SetViewRect(const Rect& rect)
+{
+    sContext.View.HasViewRect = true;
+    sContext.View.ViewRect = { static_cast<float>(rect.X), static_cast<float>(rect.Y), static_cast<float>(rect.Width),
+                               static_cast<float>(rect.Height) };
+}
+
+void ResetViewRect()
+{
+    sContext.View.HasViewRect = false;
+}
+
+void SetViewCulling(bool enabled)
+{
+    sContext.View.Enabled = enabled;
+}
+
+bool IsViewCullingEnabled()
+{
+    return sContext.View.Enabled;
+}
+
+CullingStatistics GetCullingStatistics()
+{
+    return sCullingStatistics;
+}
+
+ViewCullingState GetViewCullingState()
+{
+    return sContext.View;
+}
+
+void SetViewCullingState(const ViewCullingState& state)
+{
+    sContext.View = state;
+}
+
 /**
- * @brief Set SDL draw color.
- *
- * @param renderer Specified renderer.
- * @param color Draw color.
+ * @brief Get the rect to cull against, the render target if none is set.
  */
-static void SetDrawColor(SDL_Renderer* renderer, const Color& color)
+static SDL_FRect GetViewRect()
 {
-    SDL_SetRenderDrawColor(renderer, color.R, color.G, color.B, color.A);
+    if (sContext.View.HasViewRect)
+    {
+        return sContext.View.ViewRect;
+    }
+    return { 0.0f, 0.0f, static_cast<float>(sTargetWidth.load(std::memory_order_relaxed)),
+             static_cast<float>(sTargetHeight.load(std::memory_order_relaxed)) };
 }
 
+/**
+ * @brief Check whether bounds, already transformed, overlap the current view.
+ */
+static bool IsInView(const SDL_FRect& bounds)
+{
+    SDL_FRect view = GetViewRect();
+    return (bounds.x < view.x + view.w) && (bounds.x + bounds.w > view.x) && (bounds.y < view.y + view.h) &&
+           (bounds.y + bounds.h > view.y);
+}
+
+/**
+ * @brief Check whether a command may be visible in the current view.
+ */
+static bool IsInView(const RenderCommand& command)
+{
+    SDL_FRect bounds;
+    if (!GetRenderCommandBounds(command, bounds))
+    {
+        return true;
+    }
+    return IsInView(bounds);
+}
+
+/**
+ * @brief Get bounds of a rect after a transform.
+ */
+static SDL_FRect TransformBounds(const SDL_FRect& bounds, const Transform& transform)
+{
+    float xs[4] = { bounds.x, bounds.x + bounds.w, bounds.x + bounds.w, bounds.x };
+    float ys[4] = { bounds.y, bounds.y, bounds.y + bounds.h, bounds.y + bounds.h };
+    for (int i = 0; i < 4; i++)
+    {
+        transform.Apply(xs[i], ys[i]);
+    }
+
+    float minX = Math::Min(Math::Min(xs[0], xs[1]), Math::Min(xs[2], xs[3]));
+    float minY = Math::Min(Math::Min(ys[0], ys[1]), Math::Min(ys[2], ys[3]));
+    float maxX = Math::Max(Math::Max(xs[0], xs[1]), Math::Max(xs[2], xs[3]));
+    float maxY = Math::Max(Math::Max(ys[0], ys[1]), Math::Max(ys[2], ys[3]));
+    return { minX, minY, maxX - minX, maxY - minY };
+}
+
+// ============================================================================
+// Transform
+// ----------------------------------------------------------------------------
+
+void SetTransform(const Transform& transform)
+{
+    sContext.CurrentTransform = transform;
+    sContext.HasTransform = !transform.IsIdentity();
+}
+
+Transform GetTransform()
+{
+    return sContext.CurrentTransform;
+}
+
+void PushTransform(const Transform& transform)
+{
+    sContext.TransformStack.push_back(sContext.CurrentTransform);
+    SetTransform(sContext.CurrentTransform * transform);
+}
+
+void PopTransform()
+{
+    if (sContext.TransformStack.empty())
+    {
+        DGEX_CORE_WARN("Transform stack is empty");
+        return;
+    }
+    SetTransform(sContext.TransformStack.back());
+    sContext.TransformStack.pop_back();
+}
+
+void Translate(float x, float y)
+{
+    SetTransform(sContext.CurrentTransform * Transform::Translation(x, y));
+}
+
+void Rotate(float degree)
+{
+    SetTransform(sContext.CurrentTransform * Transform::Rotation(degree));
+}
+
+void Scale(float x, float y)
+{
+    SetTransform(sContext.CurrentTransform * Transform::Scaling(x, y));
+}
+
+TransformGuard::TransformGuard(const Transform& transform)
+{
+    PushTransform(transform);
+}
+
+TransformGuard::~TransformGuard()
+{
+    PopTransform();
+}
+
+// ============================================================================
+// Render Property Settings
+// ----------------------------------------------------------------------------
+
 void SetClearColor(Color color)
 {
     sContext.ClearColor = color;
@@ -235,141 +484,266 @@ float GetFontSize()
 }
 
 // ============================================================================
-// Device Render API
-// ----------------------------------------------------------------------------
-// References:
-// - https://wiki.libsdl.org/SDL2/SDL_RenderClear
-// - https://wiki.libsdl.org/SDL3/SDL_RenderPresent
+// Command Submission
 // ----------------------------------------------------------------------------
 
-static void ClearDeviceImpl(SDL_Renderer* renderer, Color color)
+/**
+ * @brief Keep textures of a command alive until this frame is rendered.
+ */
+static void MarkTextureUsed(const RenderCommand& command)
 {
-    SetDrawColor(renderer, color);
-    SDL_RenderClear(renderer);
+    if (command.Type == RenderCommandType::Texture)
+    {
+        GetTextureRegistry().MarkUsed(static_cast<const TextureRenderCommand&>(command).Texture);
+    }
+    else if (command.Type == RenderCommandType::Geometry)
+    {
+        GetTextureRegistry().MarkUsed(static_cast<const GeometryRenderCommand&>(command).Texture);
+    }
 }
 
-void ClearDevice()
+/**
+ * @brief Submit a command that passed culling.
+ */
+static void SubmitVisibleCommand(const RenderCommand& command)
 {
-    if (sActiveRenderer)
+    if (sContext.ActiveRenderer)
     {
-        Color color = sContext.ClearColor;
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [color](SDL_Renderer* renderer) { ClearDeviceImpl(renderer, color); }, INT_MIN));
+        sContext.ActiveRenderer->Submit(command);
     }
     else
     {
-        ClearDeviceImpl(GetNativeRenderer(), sContext.ClearColor);
+        DGEX_ASSERT(IsRenderThread(), "Other threads must record into an ordered renderer");
+        ApplyRenderCommand(GetNativeRenderer(), command);
     }
 }
 
-void FlushDevice()
+/**
+ * @brief Get the smallest variant of a texture still sharp where it is drawn.
+ *
+ * The larger axis of the transform decides, so that a squashed texture
+ * is never blurred along the other.
+ */
+static TextureHandle SelectTextureVariant(const TextureRenderCommand& command)
 {
-    SDL_RenderPresent(GetNativeRenderer());
-}
-
-// ============================================================================
-// Primitives Render API
-// ----------------------------------------------------------------------------
-// References:
-// - https://wiki.libsdl.org/SDL3/SDL_RenderPoint
-// - https://wiki.libsdl.org/SDL3/SDL_RenderLine
-// - https://wiki.libsdl.org/SDL3/SDL_RenderRect
-// ----------------------------------------------------------------------------
+    float scale = Math::Abs(command.Scale);
+    if (command.Transform)
+    {
+        const Transform& transform = *command.Transform;
+        scale *= Math::Sqrt(Math::Max(transform.A * transform.A + transform.B * transform.B,
+                                      transform.C * transform.C + transform.D * transform.D));
+    }
 
-static void DrawPointImpl(SDL_Renderer* renderer, int x, int y, Color color)
-{
-    SetDrawColor(renderer, color);
-    SDL_RenderPoint(renderer, static_cast<float>(x), static_cast<float>(y));
+    // Variants are half the size at most.
+    return scale <= 0.5f ? GetTextureRegistry().SelectVariant(command.Texture, scale) : command.Texture;
 }
 
-void DrawPoint(int x, int y, int z)
+/**
+ * @brief Submit a command, whose transform is final.
+ */
+static void SubmitTransformedCommand(const RenderCommand& command)
 {
-    if (sActiveRenderer)
+    // Only counted where culling is decided, so that commands replayed
+    // with culling off, e.g. by a cached layer, are not counted twice.
+    if (sContext.View.Enabled)
     {
-        Color color = sContext.LineColor;
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [x, y, color](SDL_Renderer* renderer) { DrawPointImpl(renderer, x, y, color); }, z));
+        if (!IsInView(command))
+        {
+            sCulledCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        sKeptCount.fetch_add(1, std::memory_order_relaxed);
     }
-    else
+    MarkTextureUsed(command);
+
+    if (command.Type == RenderCommandType::Texture)
     {
-        DrawPointImpl(GetNativeRenderer(), x, y, sContext.LineColor);
+        // Same size as the texture, so only the handle changes. The texture
+        // is still marked used, to be there once drawn larger again.
+        const auto& texture = static_cast<const TextureRenderCommand&>(command);
+        TextureHandle variant = SelectTextureVariant(texture);
+        if (variant != texture.Texture)
+        {
+            TextureRenderCommand selected = texture;
+            selected.Texture = variant;
+            GetTextureRegistry().MarkUsed(variant);
+            SubmitVisibleCommand(selected);
+            return;
+        }
     }
+    else if ((command.Type == RenderCommandType::Geometry) && IsSimulationThread())
+    {
+        // The frame is rendered while the submitter already updates its
+        // vertices for the next one, so they go with the command.
+        GeometryRenderCommand copy = static_cast<const GeometryRenderCommand&>(command);
+        copy.Transient = true;
+        SubmitVisibleCommand(copy);
+        return;
+    }
+    SubmitVisibleCommand(command);
 }
 
-static void DrawLineImpl(SDL_Renderer* renderer, int x1, int y1, int x2, int y2, Color color)
+/**
+ * @brief Submit a copy of the concrete command with another transform.
+ */
+template <typename T> static void SubmitWithTransform(const RenderCommand& command, const Transform& transform)
 {
-    SetDrawColor(renderer, color);
-    SDL_RenderLine(renderer, static_cast<float>(x1), static_cast<float>(y1), static_cast<float>(x2),
-                   static_cast<float>(y2));
+    T transformed = static_cast<const T&>(command);
+    transformed.Transform = &transform;
+    SubmitTransformedCommand(transformed);
 }
 
-void DrawLine(int x1, int y1, int x2, int y2, int z)
+void SubmitRenderCommand(const RenderCommand& command)
 {
-    if (sActiveRenderer)
+    if (!sContext.HasTransform)
     {
-        Color color = sContext.LineColor;
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [x1, y1, x2, y2, color](SDL_Renderer* renderer) { DrawLineImpl(renderer, x1, y1, x2, y2, color); }, z));
+        SubmitTransformedCommand(command);
+        return;
     }
-    else
+
+    // Only the matrix is combined here, vertices are transformed when the
+    // command is batched or executed.
+    Transform transform = command.Transform ? sContext.CurrentTransform * *command.Transform
+                                            : sContext.CurrentTransform;
+
+    switch (command.Type)
+    {
+    case RenderCommandType::Clear:
+        SubmitWithTransform<ClearRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Point:
+        SubmitWithTransform<PointRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Line:
+        SubmitWithTransform<LineRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Rect:
+    case RenderCommandType::FilledRect:
+        SubmitWithTransform<RectRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Texture:
+        SubmitWithTransform<TextureRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Text:
+    case RenderCommandType::TextArea:
+        SubmitWithTransform<TextRenderCommand>(command, transform);
+        break;
+    case RenderCommandType::Geometry:
+        SubmitWithTransform<GeometryRenderCommand>(command, transform);
+        break;
+    }
+}
+
+void SubmitRenderCommand(const RenderCommand& command, const SDL_FRect& bounds)
+{
+    if (!sContext.View.Enabled)
+    {
+        SubmitRenderCommand(command);
+        return;
+    }
+
+    Transform transform = command.Transform ? sContext.CurrentTransform * *command.Transform
+                                            : sContext.CurrentTransform;
+    if (!IsInView(TransformBounds(bounds, transform)))
     {
-        DrawLineImpl(GetNativeRenderer(), x1, y1, x2, y2, sContext.LineColor);
+        sCulledCount.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
+    SubmitRenderCommand(command);
 }
 
-static void DrawRectImpl(SDL_Renderer* renderer, int x, int y, int width, int height, Color color)
+// ============================================================================
+// Device Render API
+// ----------------------------------------------------------------------------
+// References:
+// - https://wiki.libsdl.org/SDL2/SDL_RenderClear
+// - https://wiki.libsdl.org/SDL3/SDL_RenderPresent
+// ----------------------------------------------------------------------------
+
+void ClearDevice()
 {
-    SetDrawColor(renderer, color);
-    SDL_FRect rect{ static_cast<float>(x), static_cast<float>(y), static_cast<float>(width),
-                    static_cast<float>(height) };
-    SDL_RenderRect(renderer, &rect);
+    ClearRenderCommand command{ { RenderCommandType::Clear, INT_MIN }, sContext.ClearColor };
+    SubmitRenderCommand(command);
 }
 
-void DrawRect(int x, int y, int width, int height, int z)
+void FlushDevice()
 {
-    if (sActiveRenderer)
+    DGEX_ASSERT(IsRenderThread(), "Device can only be flushed on the render thread");
+
+    if (sContext.ActiveRenderer)
     {
-        Color color = sContext.LineColor;
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [x, y, width, height, color](SDL_Renderer* renderer) {
-                DrawRectImpl(renderer, x, y, width, height, color);
-            },
-            z));
+        sContext.ActiveRenderer->Flush();
     }
-    else
+    SDL_RenderPresent(GetNativeRenderer());
+
+    // Frame ends here, textures released during it can go now.
+    GetTextureRegistry().EndFrame();
+    UpdateTextureResidency();
+
+    // Textures loaded in the background are ready for the next frame.
+    GetTextureLoader().Upload();
+    sCullingStatistics = { sKeptCount.exchange(0, std::memory_order_relaxed),
+                           sCulledCount.exchange(0, std::memory_order_relaxed) };
+
+    // Window may be resized.
+    if (!sActiveRenderTarget)
     {
-        DrawRectImpl(GetNativeRenderer(), x, y, width, height, sContext.LineColor);
+        UpdateTargetSize();
     }
 }
 
-void DrawRect(const Rect& rect, int z)
+// ============================================================================
+// Primitives Render API
+// ----------------------------------------------------------------------------
+// References:
+// - https://wiki.libsdl.org/SDL3/SDL_RenderPoint
+// - https://wiki.libsdl.org/SDL3/SDL_RenderLine
+// - https://wiki.libsdl.org/SDL3/SDL_RenderRect
+// ----------------------------------------------------------------------------
+
+void DrawPoint(int x, int y, int z)
 {
-    DrawRect(rect.X, rect.Y, rect.Width, rect.Height, z);
+    PointRenderCommand command{
+        { RenderCommandType::Point, z }, static_cast<float>(x), static_cast<float>(y), sContext.LineColor
+    };
+    SubmitRenderCommand(command);
 }
 
-static void DrawFilledRectImpl(SDL_Renderer* renderer, int x, int y, int width, int height, Color color)
+void DrawLine(int x1, int y1, int x2, int y2, int z)
 {
-    SetDrawColor(renderer, color);
-    SDL_FRect rect{ static_cast<float>(x), static_cast<float>(y), static_cast<float>(width),
-                    static_cast<float>(height) };
-    SDL_RenderFillRect(renderer, &rect);
+    LineRenderCommand command{ { RenderCommandType::Line, z },
+                               static_cast<float>(x1),
+                               static_cast<float>(y1),
+                               static_cast<float>(x2),
+                               static_cast<float>(y2),
+                               sContext.LineColor };
+    SubmitRenderCommand(command);
+}
+
+/**
+ * @brief Make a rectangle command, either outlined or filled.
+ */
+static RectRenderCommand MakeRectCommand(RenderCommandType type, int x, int y, int width, int height, int z,
+                                         Color color)
+{
+    return { { type, z },
+             { static_cast<float>(x), static_cast<float>(y), static_cast<float>(width), static_cast<float>(height) },
+             color };
+}
+
+void DrawRect(int x, int y, int width, int height, int z)
+{
+    SubmitRenderCommand(MakeRectCommand(RenderCommandType::Rect, x, y, width, height, z, sContext.LineColor));
+}
+
+void DrawRect(const Rect& rect, int z)
+{
+    DrawRect(rect.X, rect.Y, rect.Width, rect.Height, z);
 }
 
 void DrawFilledRect(int x, int y, int width, int height, int z)
 {
-    if (sActiveRenderer)
-    {
-        Color color = sContext.FillColor;
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [x, y, width, height, color](SDL_Renderer* renderer) {
-                DrawFilledRectImpl(renderer, x, y, width, height, color);
-            },
-            z));
-    }
-    else
-    {
-        DrawFilledRectImpl(GetNativeRenderer(), x, y, width, height, sContext.FillColor);
-    }
+    SubmitRenderCommand(MakeRectCommand(RenderCommandType::FilledRect, x, y, width, height, z, sContext.FillColor));
 }
 
 void DrawFilledRect(const Rect& rect, int z)
@@ -381,87 +755,90 @@ void DrawFilledRect(const Rect& rect, int z)
 // Texture Render API
 // ----------------------------------------------------------------------------
 
-static void DrawTextureImpl(const Ref<TextureRenderCommand>& command)
+// Simple texture rendering is just a texture command with default properties.
+void DrawTexture(const Ref<Texture>& texture, int x, int y, int z)
 {
-    if (sActiveRenderer)
-    {
-        sActiveRenderer->Submit(command);
-    }
-    else
-    {
-        command->Apply(GetNativeRenderer());
-    }
+    DrawTextureBegin(texture, x, y, z).Submit();
 }
 
-static void DrawTextureImpl(SDL_Renderer* renderer, SDL_Texture* texture, int x, int y)
+void DrawTexture(const SubTexture& texture, int x, int y, int z)
 {
-    SDL_PropertiesID props = SDL_GetTextureProperties(texture);
-    float width = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
-    float height = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_HEIGHT_NUMBER, 0));
-    SDL_FRect rect{ static_cast<float>(x), static_cast<float>(y), width, height };
-    SDL_RenderTexture(renderer, texture, nullptr, &rect);
+    DrawTextureBegin(texture, x, y, z).Submit();
 }
 
-// Simple texture rendering can be implemented simply.
-void DrawTexture(const Ref<Texture>& texture, int x, int y, int z)
+DrawTextureClause::DrawTextureClause(const Ref<Texture>& texture, int x, int y, int z)
+    : _texture(texture->GetHandle()), _anchor(), _source(), _x(static_cast<float>(x)), _y(static_cast<float>(y)),
+      _z(z), _scale(1.0f), _degree(0.0f), _alpha(DGEX_COLOR_OPAQUE), _flipX(false), _flipY(false),
+      _defaultAnchor(true)
 {
-    if (sActiveRenderer)
-    {
-        sActiveRenderer->Submit(NativeRenderCommand::Create(
-            [texture, x, y](SDL_Renderer* renderer) { DrawTextureImpl(renderer, texture->GetNativeTexture(), x, y); },
-            z));
-    }
-    else
-    {
-        DrawTextureImpl(GetNativeRenderer(), texture->GetNativeTexture(), x, y);
-    }
 }
 
-DrawTextureClause::DrawTextureClause(const Ref<Texture>& texture, int x, int y, int z)
-    : _builder(CreateRef<TextureRenderCommandBuilder>(texture->GetNativeTexture()))
+DrawTextureClause::DrawTextureClause(const SubTexture& texture, int x, int y, int z)
+    : DrawTextureClause(texture.Texture, x, y, z)
 {
-    _builder->SetPosition(x, y, z);
+    Source(texture.Region);
 }
 
-DrawTextureClause DrawTextureClause::Alpha(uint8_t alpha)
+DrawTextureClause& DrawTextureClause::Alpha(uint8_t alpha)
 {
-    _builder->SetAlpha(alpha);
+    _alpha = alpha;
     return *this;
 }
 
-DrawTextureClause DrawTextureClause::Anchor(int x, int y)
+DrawTextureClause& DrawTextureClause::Anchor(int x, int y)
 {
-    _builder->SetAnchor(x, y);
+    _anchor.x = static_cast<float>(x);
+    _anchor.y = static_cast<float>(y);
+    _defaultAnchor = false;
     return *this;
 }
 
-DrawTextureClause DrawTextureClause::FlipX()
+DrawTextureClause& DrawTextureClause::FlipX()
 {
-    _builder->FlipX();
+    _flipX = true;
     return *this;
 }
 
-DrawTextureClause DrawTextureClause::FlipY()
+DrawTextureClause& DrawTextureClause::FlipY()
 {
-    _builder->FlipY();
+    _flipY = true;
     return *this;
 }
 
-DrawTextureClause DrawTextureClause::Rotate(float degree)
+DrawTextureClause& DrawTextureClause::Rotate(float degree)
 {
-    _builder->SetRotation(degree);
+    _degree = degree;
     return *this;
 }
 
-DrawTextureClause DrawTextureClause::Scale(float scale)
+DrawTextureClause& DrawTextureClause::Scale(float scale)
 {
-    _builder->SetScale(scale);
+    _scale = scale;
+    return *this;
+}
+
+DrawTextureClause& DrawTextureClause::Source(const Rect& region)
+{
+    _source = { static_cast<float>(region.X), static_cast<float>(region.Y), static_cast<float>(region.Width),
+                static_cast<float>(region.Height) };
     return *this;
 }
 
 void DrawTextureClause::Submit()
 {
-    DrawTextureImpl(_builder->Create());
+    TextureRenderCommand command{ { RenderCommandType::Texture, _z },
+                                  _texture,
+                                  _anchor,
+                                  _x,
+                                  _y,
+                                  _scale,
+                                  _degree,
+                                  _alpha,
+                                  _flipX,
+                                  _flipY,
+                                  _defaultAnchor,
+                                  _source };
+    SubmitRenderCommand(command);
 }
 
 DrawTextureClause DrawTextureBegin(const Ref<Texture>& texture, int x, int y, int z)
@@ -469,62 +846,219 @@ DrawTextureClause DrawTextureBegin(const Ref<Texture>& texture, int x, int y, in
     return { texture, x, y, z };
 }
 
-static void DrawTextImpl(SDL_Renderer* renderer, FC_Font* font, const char* text, int x, int y, Color color,
-                         float scale, TextFlags flags)
+DrawTextureClause DrawTextureBegin(const SubTexture& texture, int x, int y, int z)
 {
-    FC_Effect effect;
+    return { texture, x, y, z };
+}
+
+// ============================================================================
+// Texture Geometry Render API
+// ----------------------------------------------------------------------------
+// Quads are gathered on the submitting thread, and sent as one transient
+// geometry command, which queued renderers copy.
+// ----------------------------------------------------------------------------
 
-    if (flags & DGEX_TextAlignRight)
+static thread_local std::vector<SDL_Vertex> sQuadVertices;
+static thread_local std::vector<int> sQuadIndices;
+
+// Most quads of one tiled draw, far more than a view ever shows.
+static constexpr int64_t MAX_TILED_QUADS = 65536;
+
+/**
+ * @brief Get the current view before the current transform.
+ *
+ * @return False if view culling is off, or nothing is visible at all.
+ */
+static bool GetLocalViewRect(SDL_FRect& rect)
+{
+    const Transform& transform = sContext.CurrentTransform;
+    if (!sContext.View.Enabled || (transform.A * transform.D - transform.B * transform.C == 0.0f))
     {
-        effect.alignment = FC_ALIGN_RIGHT;
+        return false;
     }
-    else if (flags & DGEX_TextAlignCenter)
+    rect = sContext.HasTransform ? TransformBounds(GetViewRect(), transform.Inverse()) : GetViewRect();
+    return true;
+}
+
+/**
+ * @brief Get the region of a texture to draw, in pixels.
+ */
+static SDL_FRect GetTextureRegion(const SubTexture& texture)
+{
+    const Rect& region = texture.Region;
+    if ((region.Width > 0) && (region.Height > 0))
     {
-        effect.alignment = FC_ALIGN_CENTER;
+        return { static_cast<float>(region.X), static_cast<float>(region.Y), static_cast<float>(region.Width),
+                 static_cast<float>(region.Height) };
     }
-    else
+    return { 0.0f, 0.0f, static_cast<float>(texture.Texture->GetWidth()),
+             static_cast<float>(texture.Texture->GetHeight()) };
+}
+
+/**
+ * @brief Add a quad, positions on the screen and texture coordinates 0 ~ 1.
+ */
+static void PushQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1)
+{
+    if ((x1 <= x0) || (y1 <= y0))
     {
-        effect.alignment = FC_ALIGN_LEFT;
+        return;
     }
 
-    effect.scale = FC_MakeScale(scale, scale);
-    effect.color = FC_MakeColor(color.R, color.G, color.B, color.A);
+    const SDL_FColor white{ 1.0f, 1.0f, 1.0f, 1.0f };
+    int first = static_cast<int>(sQuadVertices.size());
+    sQuadVertices.push_back({ { x0, y0 }, white, { u0, v0 } });
+    sQuadVertices.push_back({ { x1, y0 }, white, { u1, v0 } });
+    sQuadVertices.push_back({ { x1, y1 }, white, { u1, v1 } });
+    sQuadVertices.push_back({ { x0, y1 }, white, { u0, v1 } });
+    for (int index : { 0, 1, 2, 2, 3, 0 })
+    {
+        sQuadIndices.push_back(first + index);
+    }
+}
 
-    FC_DrawEffect(font, renderer, static_cast<float>(x), static_cast<float>(y), effect, text);
+/**
+ * @brief Submit quads gathered so far as one draw.
+ */
+static void SubmitQuads(const Ref<Texture>& texture, int z)
+{
+    if (!sQuadVertices.empty())
+    {
+        GeometryRenderCommand command{ { RenderCommandType::Geometry, z },
+                                       texture->GetHandle(),
+                                       sQuadVertices.data(),
+                                       sQuadIndices.data(),
+                                       static_cast<int>(sQuadVertices.size()),
+                                       static_cast<int>(sQuadIndices.size()),
+                                       static_cast<uint32_t>(sQuadVertices.size() / 4),
+                                       true };
+        SubmitRenderCommand(command);
+    }
+    sQuadVertices.clear();
+    sQuadIndices.clear();
 }
 
-static void DrawTextAreaImpl(SDL_Renderer* renderer, FC_Font* font, const char* text, FC_Rect rect, Color color,
-                             float scale, TextFlags flags)
+void DrawNineSlice(const Ref<Texture>& texture, const Rect& rect, const NineSliceBorder& border, int z)
 {
-    FC_Effect effect;
+    DrawNineSlice(SubTexture{ texture }, rect, border, z);
+}
 
-    if (flags & DGEX_TextAlignRight)
+void DrawNineSlice(const SubTexture& texture, const Rect& rect, const NineSliceBorder& border, int z)
+{
+    SDL_FRect region = GetTextureRegion(texture);
+    auto textureWidth = static_cast<float>(texture.Texture->GetWidth());
+    auto textureHeight = static_cast<float>(texture.Texture->GetHeight());
+    if ((textureWidth <= 0.0f) || (textureHeight <= 0.0f))
     {
-        effect.alignment = FC_ALIGN_RIGHT;
+        return;
     }
-    else if (flags & DGEX_TextAlignCenter)
+
+    // Borders shrink evenly if they do not fit.
+    auto left = static_cast<float>(border.Left);
+    auto top = static_cast<float>(border.Top);
+    auto right = static_cast<float>(border.Right);
+    auto bottom = static_cast<float>(border.Bottom);
+    auto width = static_cast<float>(rect.Width);
+    auto height = static_cast<float>(rect.Height);
+    float scaleX = (left + right > width) ? width / (left + right) : 1.0f;
+    float scaleY = (top + bottom > height) ? height / (top + bottom) : 1.0f;
+
+    auto x = static_cast<float>(rect.X);
+    auto y = static_cast<float>(rect.Y);
+    const float xs[4] = { x, x + left * scaleX, x + width - right * scaleX, x + width };
+    const float ys[4] = { y, y + top * scaleY, y + height - bottom * scaleY, y + height };
+    const float us[4] = { region.x / textureWidth, (region.x + left) / textureWidth,
+                          (region.x + region.w - right) / textureWidth, (region.x + region.w) / textureWidth };
+    const float vs[4] = { region.y / textureHeight, (region.y + top) / textureHeight,
+                          (region.y + region.h - bottom) / textureHeight, (region.y + region.h) / textureHeight };
+
+    // Empty parts, e.g. no border, are skipped.
+    for (int row = 0; row < 3; row++)
     {
-        effect.alignment = FC_ALIGN_CENTER;
+        for (int column = 0; column < 3; column++)
+        {
+            PushQuad(xs[column], ys[row], xs[column + 1], ys[row + 1], us[column], vs[row], us[column + 1],
+                     vs[row + 1]);
+        }
     }
-    else
+    SubmitQuads(texture.Texture, z);
+}
+
+void DrawTiled(const Ref<Texture>& texture, const Rect& rect, int z)
+{
+    DrawTiled(SubTexture{ texture }, rect, z);
+}
+
+void DrawTiled(const SubTexture& texture, const Rect& rect, int z)
+{
+    SDL_FRect region = GetTextureRegion(texture);
+    auto textureWidth = static_cast<float>(texture.Texture->GetWidth());
+    auto textureHeight = static_cast<float>(texture.Texture->GetHeight());
+    auto tileWidth = static_cast<int>(region.w);
+    auto tileHeight = static_cast<int>(region.h);
+    if ((tileWidth <= 0) || (tileHeight <= 0) || (textureWidth <= 0.0f) || (textureHeight <= 0.0f))
     {
-        effect.alignment = FC_ALIGN_LEFT;
+        return;
     }
 
-    effect.scale = FC_MakeScale(scale, scale);
-    effect.color = FC_MakeColor(color.R, color.G, color.B, color.A);
+    // Integer steps, so that tiles meet without gaps.
+    int right = rect.X + rect.Width;
+    int bottom = rect.Y + rect.Height;
+
+    // Only tiles in view, starting on a whole tile so that none moves.
+    int left = rect.X;
+    int top = rect.Y;
+    int endX = right;
+    int endY = bottom;
+    SDL_FRect view;
+    if (GetLocalViewRect(view))
+    {
+        if ((view.x >= static_cast<float>(right)) || (view.x + view.w <= static_cast<float>(left)) ||
+            (view.y >= static_cast<float>(bottom)) || (view.y + view.h <= static_cast<float>(top)))
+        {
+            return;
+        }
+        if (view.x > static_cast<float>(left))
+        {
+            left += static_cast<int>((view.x - static_cast<float>(rect.X)) / static_cast<float>(tileWidth)) * tileWidth;
+        }
+        if (view.y > static_cast<float>(top))
+        {
+            top += static_cast<int>((view.y - static_cast<float>(rect.Y)) / static_cast<float>(tileHeight)) * tileHeight;
+        }
+        endX = static_cast<int>(std::ceil(Math::Min(static_cast<float>(endX), view.x + view.w)));
+        endY = static_cast<int>(std::ceil(Math::Min(static_cast<float>(endY), view.y + view.h)));
+    }
 
-    if (flags & DGEX_TextOverflow)
+    int64_t columns = (static_cast<int64_t>(endX) - left + tileWidth - 1) / tileWidth;
+    int64_t rows = (static_cast<int64_t>(endY) - top + tileHeight - 1) / tileHeight;
+    if (columns * rows > MAX_TILED_QUADS)
     {
-        FC_DrawColumnEffect(font, renderer, static_cast<float>(rect.x), static_cast<float>(rect.y),
-                            static_cast<Uint16>(rect.w), effect, text);
+        DGEX_CORE_WARN("Too many tiles to draw: {0}, at most {1}", columns * rows, MAX_TILED_QUADS);
+        return;
     }
-    else
+
+    for (int y = top; y < endY; y += tileHeight)
     {
-        FC_DrawBoxEffect(font, renderer, rect, effect, text);
+        int y1 = y + tileHeight < bottom ? y + tileHeight : bottom;
+        float v0 = region.y / textureHeight;
+        float v1 = (region.y + static_cast<float>(y1 - y)) / textureHeight;
+        for (int x = left; x < endX; x += tileWidth)
+        {
+            int x1 = x + tileWidth < right ? x + tileWidth : right;
+            float u0 = region.x / textureWidth;
+            float u1 = (region.x + static_cast<float>(x1 - x)) / textureWidth;
+            PushQuad(static_cast<float>(x), static_cast<float>(y), static_cast<float>(x1), static_cast<float>(y1), u0,
+                     v0, u1, v1);
+        }
     }
+    SubmitQuads(texture.Texture, z);
 }
 
+// ============================================================================
+// Text Render API
+// ----------------------------------------------------------------------------
+
 void DrawText(const char* text, int x, int y, TextFlags flags)
 {
     if (!sContext.Font)
@@ -533,21 +1067,14 @@ void DrawText(const char* text, int x, int y, TextFlags flags)
         return;
     }
 
-    FC_Font* font = static_cast<FC_Font*>(sContext.Font->GetImpl());
-    float scale = GetFontScale(sContext.FontSize);
-
-    if (sActiveRenderer)
-    {
-        Color color = sContext.FontColor;
-        sActiveRenderer->Submit(
-            NativeRenderCommand::Create([font, text, x, y, color, scale, flags](SDL_Renderer* renderer) {
-                DrawTextImpl(renderer, font, text, x, y, color, scale, flags);
-            }));
-    }
-    else
-    {
-        DrawTextImpl(GetNativeRenderer(), font, text, x, y, sContext.FontColor, scale, flags);
-    }
+    TextRenderCommand command{ { RenderCommandType::Text, 0 },
+                               sContext.Font->GetImpl(),
+                               text,
+                               { x, y, 0, 0 },
+                               sContext.FontColor,
+                               GetFontScale(sContext.FontSize),
+                               flags };
+    SubmitRenderCommand(command);
 }
 
 void DrawTextArea(const char* text, int x, int y, int width, int height, TextFlags flags)
@@ -558,22 +1085,14 @@ void DrawTextArea(const char* text, int x, int y, int width, int height, TextFla
         return;
     }
 
-    FC_Font* font = static_cast<FC_Font*>(sContext.Font->GetImpl());
-    float scale = GetFontScale(sContext.FontSize);
-    FC_Rect rect{ x, y, width, height };
-
-    if (sActiveRenderer)
-    {
-        Color color = sContext.FontColor;
-        sActiveRenderer->Submit(
-            NativeRenderCommand::Create([font, text, rect, color, scale, flags](SDL_Renderer* renderer) {
-                DrawTextAreaImpl(renderer, font, text, rect, color, scale, flags);
-            }));
-    }
-    else
-    {
-        DrawTextAreaImpl(GetNativeRenderer(), font, text, rect, sContext.FontColor, scale, flags);
-    }
+    TextRenderCommand command{ { RenderCommandType::TextArea, 0 },
+                               sContext.Font->GetImpl(),
+                               text,
+                               { x, y, width, height },
+                               sContext.FontColor,
+                               GetFontScale(sContext.FontSize),
+                               flags };
+    SubmitRenderCommand(command);
 }
 
 void DrawTextArea(const char* text, const Rect& rect, TextFlags flags)
@@ -0,0 +1,71 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RenderApiImpl.h                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Internal entries of render API for other engine modules.                   *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Device/Graphics/RenderCommand.h"
+
+DGEX_BEGIN
+
+/**
+ * @brief View culling settings of a thread.
+ */
+struct ViewCullingState
+{
+    bool Enabled;
+    bool HasViewRect; // otherwise cull against the render target
+    SDL_FRect ViewRect;
+};
+
+/**
+ * @brief Get view culling settings of the calling thread.
+ *
+ * For modules that record commands to draw elsewhere, so they can save
+ * and change the settings while recording.
+ */
+ViewCullingState GetViewCullingState();
+
+/**
+ * @brief Set view culling settings of the calling thread.
+ */
+void SetViewCullingState(const ViewCullingState& state);
+
+/**
+ * @brief Submit a command to the active renderer, or execute it directly.
+ *
+ * Commands are built on the stack, the renderer copies it if needed.
+ * The current transform is combined with the one of the command, and
+ * commands out of view are dropped.
+ *
+ * @param command The command to submit.
+ */
+void SubmitRenderCommand(const RenderCommand& command);
+
+/**
+ * @brief Submit a command culled on bounds computed ahead.
+ *
+ * For commands that have no bounds of their own, e.g. geometry baked
+ * once and replayed every frame.
+ *
+ * @param command The command to submit.
+ * @param bounds Bounds of the command before any transform.
+ */
+void SubmitRenderCommand(const RenderCommand& command, const SDL_FRect& bounds);
+
+DGEX_END
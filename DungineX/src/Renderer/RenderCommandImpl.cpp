@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 19, 2025                             *
  *                                                                            *
- *                    Last Update : June 19, 2025                             *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -19,149 +19,733 @@
 
 #include "Renderer/RenderCommandImpl.h"
 
-#include "DgeX/Renderer/Color.h"
+#include "Device/Graphics/RenderStateCache.h"
+#include "Renderer/TextureRegistry.h"
+#include "Utils/LinearArena.h"
+
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Math.h"
+
+#include <SDL_FontCache/SDL_FontCache.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 DGEX_BEGIN
 
-NativeRenderCommand::NativeRenderCommand(const std::function<void(SDL_Renderer*)>& action, int order)
-    : RenderCommand(order), _action(action)
+// ============================================================================
+// Command Implementations
+// ----------------------------------------------------------------------------
+// Reference: https://wiki.libsdl.org/SDL3/SDL_SetRenderDrawColor
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Set SDL draw color, skipped if unchanged.
+ *
+ * @param renderer Specified renderer.
+ * @param color Draw color.
+ */
+static void SetDrawColor(SDL_Renderer* renderer, const Color& color)
 {
+    DGEX_ASSERT(renderer == GetNativeRenderer(), "Render state cache only tracks the native renderer");
+
+    GetRenderStateCache().SetDrawColor(color.R, color.G, color.B, color.A);
 }
 
-void NativeRenderCommand::Apply(SDL_Renderer* renderer)
+static void ApplyClear(SDL_Renderer* renderer, const ClearRenderCommand& command)
 {
-    _action(renderer);
+    SetDrawColor(renderer, command.ClearColor);
+    SDL_RenderClear(renderer);
 }
 
-Ref<NativeRenderCommand> NativeRenderCommand::Create(const RenderAction& action, int order)
+static void ApplyPoint(SDL_Renderer* renderer, const PointRenderCommand& command)
 {
-    return CreateRef<NativeRenderCommand>(action, order);
+    SDL_FPoint point = TransformPoint(command, command.X, command.Y);
+    SetDrawColor(renderer, command.LineColor);
+    SDL_RenderPoint(renderer, point.x, point.y);
 }
 
-TextureRenderCommand::TextureRenderCommand(SDL_Texture* texture, float x, float y, int z, float scale, float degree,
-                                           uint8_t alpha, bool flipX, bool flipY)
-    : RenderCommand(z), _texture(texture), _anchor(), _x(x), _y(y), _scale(scale), _degree(degree), _alpha(alpha),
-      _flipX(flipX), _flipY(flipY), _defaultAnchor(true)
+static void ApplyLine(SDL_Renderer* renderer, const LineRenderCommand& command)
 {
+    SDL_FPoint start = TransformPoint(command, command.X1, command.Y1);
+    SDL_FPoint end = TransformPoint(command, command.X2, command.Y2);
+    SetDrawColor(renderer, command.LineColor);
+    SDL_RenderLine(renderer, start.x, start.y, end.x, end.y);
 }
 
-TextureRenderCommand::TextureRenderCommand(SDL_Texture* texture, float x, float y, int z, float anchorX, float anchorY,
-                                           float scale, float degree, uint8_t alpha, bool flipX, bool flipY)
-    : RenderCommand(z), _texture(texture), _anchor({ anchorX, anchorY }), _x(x), _y(y), _scale(scale), _degree(degree),
-      _alpha(alpha), _flipX(flipX), _flipY(flipY), _defaultAnchor(false)
+static void ApplyRect(SDL_Renderer* renderer, const RectRenderCommand& command)
 {
+    SetDrawColor(renderer, command.DrawColor);
+    if (IsAxisAlignedRect(command))
+    {
+        SDL_FRect rect = GetTransformedRect(command);
+        SDL_RenderRect(renderer, &rect);
+        return;
+    }
+
+    // Rotated outline is a closed polyline.
+    SDL_FPoint corners[5];
+    GetRectCorners(command, corners);
+    corners[4] = corners[0];
+    SDL_RenderLines(renderer, corners, 5);
 }
 
-void TextureRenderCommand::Apply(SDL_Renderer* renderer)
+static const int QUAD_INDICES[6] = { 0, 1, 2, 2, 3, 0 };
+
+static void ApplyFilledRect(SDL_Renderer* renderer, const RectRenderCommand& command)
 {
-    SDL_PropertiesID props = SDL_GetTextureProperties(_texture);
+    if (IsAxisAlignedRect(command))
+    {
+        SDL_FRect rect = GetTransformedRect(command);
+        SetDrawColor(renderer, command.DrawColor);
+        SDL_RenderFillRect(renderer, &rect);
+        return;
+    }
+
+    SDL_FPoint corners[4];
+    GetRectCorners(command, corners);
 
-    float width = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
-    float height = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_HEIGHT_NUMBER, 0));
+    SDL_FColor color = ToFColor(command.DrawColor);
+    SDL_Vertex vertices[4];
+    for (int i = 0; i < 4; i++)
+    {
+        vertices[i] = { corners[i], color, { 0.0f, 0.0f } };
+    }
+    SDL_RenderGeometry(renderer, nullptr, vertices, 4, QUAD_INDICES, 6);
+}
+
+static void ApplyTexture(SDL_Renderer* renderer, const TextureRenderCommand& command)
+{
+    TextureInfo texture;
+    if (!GetTextureRegistry().Resolve(command.Texture, texture))
+    {
+        return; // destroyed before it was drawn
+    }
+
+    SDL_FRect source = GetTextureSource(command, texture.Width, texture.Height);
+    float width = source.w;
+    float height = source.h;
+
+    if (command.Transform)
+    {
+        // SDL cannot shear or scale unevenly, so draw the quad as sprite
+        // batches do, alpha in vertex color.
+        SDL_Vertex vertices[4];
+        GetTextureQuad(command, texture.Width, texture.Height, vertices);
+        GetRenderStateCache().SetTextureAlphaMod(texture.Native, DGEX_COLOR_OPAQUE);
+        SDL_RenderGeometry(renderer, texture.Native, vertices, 4, QUAD_INDICES, 6);
+        return;
+    }
 
-    // Scale the source rectangle around the center of the texture.
-    float xOffset = -width * (_scale - 1.0f) * 0.5f;
-    float yOffset = -height * (_scale - 1.0f) * 0.5f;
-    SDL_FRect destRect{ _x + xOffset, _y + yOffset, width * _scale, height * _scale };
+    // Scale the destination rectangle around the center of the region.
+    float xOffset = -width * (command.Scale - 1.0f) * 0.5f;
+    float yOffset = -height * (command.Scale - 1.0f) * 0.5f;
+    SDL_FRect destRect{ command.X + xOffset, command.Y + yOffset, width * command.Scale, height * command.Scale };
 
     // Set additional alpha.
-    SDL_SetTextureAlphaMod(_texture, _alpha);
+    GetRenderStateCache().SetTextureAlphaMod(texture.Native, command.Alpha);
 
     // Rotate the texture around the center.
+    double degree = command.Degree;
     SDL_FlipMode flip = SDL_FLIP_NONE;
-    if (_flipX && _flipY)
+    if (command.FlipX && command.FlipY)
     {
         // Flip horizontally and vertically is equivalent to rotate 180deg.
-        _degree += 180.0f;
+        degree += 180.0;
     }
-    else if (_flipX)
+    else if (command.FlipX)
     {
         flip = SDL_FLIP_HORIZONTAL;
     }
-    else if (_flipY)
+    else if (command.FlipY)
     {
         flip = SDL_FLIP_VERTICAL;
     }
 
-    if (_defaultAnchor)
+    SDL_FPoint anchor;
+    if (command.DefaultAnchor)
     {
-        SDL_FPoint anchor{ destRect.w * 0.5f, destRect.h * 0.5f };
-        SDL_RenderTextureRotated(renderer, _texture, nullptr, &destRect, _degree, &anchor, flip);
+        anchor = { destRect.w * 0.5f, destRect.h * 0.5f };
     }
     else
     {
-        _anchor.x *= _scale;
-        _anchor.y *= _scale;
-        SDL_RenderTextureRotated(renderer, _texture, nullptr, &destRect, _degree, &_anchor, flip);
+        anchor = { command.Anchor.x * command.Scale, command.Anchor.y * command.Scale };
+    }
+    if ((texture.ResolutionX != 1.0f) || (texture.ResolutionY != 1.0f))
+    {
+        // Smaller variant of the texture, see SelectVariant.
+        source = { source.x * texture.ResolutionX, source.y * texture.ResolutionY, source.w * texture.ResolutionX,
+                   source.h * texture.ResolutionY };
+    }
+    SDL_RenderTextureRotated(renderer, texture.Native, &source, &destRect, degree, &anchor, flip);
+}
+
+/**
+ * @brief Get the uniform part of the scale of a command transform.
+ */
+static float GetTransformScale(const RenderCommand& command)
+{
+    if (!command.Transform)
+    {
+        return 1.0f;
+    }
+    const Transform& transform = *command.Transform;
+    return Math::Sqrt(Math::Abs(transform.A * transform.D - transform.B * transform.C));
+}
+
+static FC_Effect GetTextEffect(const TextRenderCommand& command)
+{
+    FC_Effect effect;
+
+    if (command.Flags & DGEX_TextAlignRight)
+    {
+        effect.alignment = FC_ALIGN_RIGHT;
+    }
+    else if (command.Flags & DGEX_TextAlignCenter)
+    {
+        effect.alignment = FC_ALIGN_CENTER;
+    }
+    else
+    {
+        effect.alignment = FC_ALIGN_LEFT;
+    }
+
+    float scale = command.Scale * GetTransformScale(command);
+    effect.scale = FC_MakeScale(scale, scale);
+    effect.color = FC_MakeColor(command.FontColor.R, command.FontColor.G, command.FontColor.B, command.FontColor.A);
+
+    return effect;
+}
+
+// Font cache cannot rotate text, so only the position and the uniform scale
+// of the transform are applied.
+static void ApplyText(SDL_Renderer* renderer, const TextRenderCommand& command)
+{
+    FC_Font* font = static_cast<FC_Font*>(command.Font);
+    FC_Effect effect = GetTextEffect(command);
+    SDL_FPoint position =
+        TransformPoint(command, static_cast<float>(command.Area.x), static_cast<float>(command.Area.y));
+
+    FC_DrawEffect(font, renderer, position.x, position.y, effect, command.Text);
+
+    // Font cache may change draw state behind our back.
+    GetRenderStateCache().InvalidateDrawState();
+}
+
+static void ApplyTextArea(SDL_Renderer* renderer, const TextRenderCommand& command)
+{
+    FC_Font* font = static_cast<FC_Font*>(command.Font);
+    FC_Effect effect = GetTextEffect(command);
+    SDL_FPoint position =
+        TransformPoint(command, static_cast<float>(command.Area.x), static_cast<float>(command.Area.y));
+    float scale = GetTransformScale(command);
+
+    if (command.Flags & DGEX_TextOverflow)
+    {
+        FC_DrawColumnEffect(font, renderer, position.x, position.y,
+                            static_cast<Uint16>(static_cast<float>(command.Area.w) * scale), effect, command.Text);
+    }
+    else
+    {
+        FC_Rect area{ static_cast<int>(position.x), static_cast<int>(position.y),
+                      static_cast<int>(static_cast<float>(command.Area.w) * scale),
+                      static_cast<int>(static_cast<float>(command.Area.h) * scale) };
+        FC_DrawBoxEffect(font, renderer, area, effect, command.Text);
+    }
+
+    GetRenderStateCache().InvalidateDrawState();
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_RenderGeometry
+static void ApplyGeometry(SDL_Renderer* renderer, const GeometryRenderCommand& command)
+{
+    TextureInfo texture{};
+    if (command.Texture.IsValid())
+    {
+        if (!GetTextureRegistry().Resolve(command.Texture, texture))
+        {
+            return; // destroyed before it was drawn
+        }
+
+        // Alpha is in vertex color, same as sprite batches.
+        GetRenderStateCache().SetTextureAlphaMod(texture.Native, DGEX_COLOR_OPAQUE);
+    }
+
+    const SDL_Vertex* vertices = command.Vertices;
+    if (command.Transform)
+    {
+        // Prepared vertices are shared, so transform a copy of them. Only
+        // the render thread gets here.
+        static std::vector<SDL_Vertex> sTransformed;
+        sTransformed.assign(command.Vertices, command.Vertices + command.VertexCount);
+        for (SDL_Vertex& vertex : sTransformed)
+        {
+            command.Transform->Apply(vertex.position.x, vertex.position.y);
+        }
+        vertices = sTransformed.data();
+    }
+
+    SDL_RenderGeometry(renderer, texture.Native, vertices, command.VertexCount, command.Indices, command.IndexCount);
+}
+
+// ============================================================================
+// Dispatch
+// ----------------------------------------------------------------------------
+
+void ApplyRenderCommand(SDL_Renderer* renderer, const RenderCommand& command)
+{
+    switch (command.Type)
+    {
+    case RenderCommandType::Clear:
+        ApplyClear(renderer, static_cast<const ClearRenderCommand&>(command));
+        break;
+    case RenderCommandType::Point:
+        ApplyPoint(renderer, static_cast<const PointRenderCommand&>(command));
+        break;
+    case RenderCommandType::Line:
+        ApplyLine(renderer, static_cast<const LineRenderCommand&>(command));
+        break;
+    case RenderCommandType::Rect:
+        ApplyRect(renderer, static_cast<const RectRenderCommand&>(command));
+        break;
+    case RenderCommandType::FilledRect:
+        ApplyFilledRect(renderer, static_cast<const RectRenderCommand&>(command));
+        break;
+    case RenderCommandType::Texture:
+        ApplyTexture(renderer, static_cast<const TextureRenderCommand&>(command));
+        break;
+    case RenderCommandType::Text:
+        ApplyText(renderer, static_cast<const TextRenderCommand&>(command));
+        break;
+    case RenderCommandType::TextArea:
+        ApplyTextArea(renderer, static_cast<const TextRenderCommand&>(command));
+        break;
+    case RenderCommandType::Geometry:
+        ApplyGeometry(renderer, static_cast<const GeometryRenderCommand&>(command));
+        break;
+    }
+}
+
+/**
+ * @brief Get a compact material id of a texture.
+ *
+ * Slot indices are already compact, and a slot holds one texture at a
+ * time, so the index alone tells textures apart.
+ */
+static uint32_t GetMaterialId(TextureHandle texture)
+{
+    return texture.Index;
+}
+
+uint64_t GetRenderSortKey(const RenderCommand& command, bool groupByMaterial)
+{
+    // Flip the sign bit, so that signed order maps to unsigned order.
+    uint64_t key = static_cast<uint64_t>(static_cast<uint32_t>(command.Order) ^ 0x80000000u) << 32;
+
+    if (groupByMaterial && (command.Type == RenderCommandType::Texture))
+    {
+        key |= GetMaterialId(static_cast<const TextureRenderCommand&>(command).Texture);
+    }
+    else if (groupByMaterial && (command.Type == RenderCommandType::Geometry))
+    {
+        key |= GetMaterialId(static_cast<const GeometryRenderCommand&>(command).Texture);
+    }
+
+    return key;
+}
+
+// ============================================================================
+// Transform Helpers
+// ----------------------------------------------------------------------------
+
+SDL_FColor ToFColor(const Color& color)
+{
+    return { static_cast<float>(color.R) / 255.0f, static_cast<float>(color.G) / 255.0f,
+             static_cast<float>(color.B) / 255.0f, static_cast<float>(color.A) / 255.0f };
+}
+
+SDL_FPoint TransformPoint(const RenderCommand& command, float x, float y)
+{
+    if (command.Transform)
+    {
+        command.Transform->Apply(x, y);
     }
+    return { x, y };
 }
 
-TextureRenderCommandBuilder::TextureRenderCommandBuilder(SDL_Texture* texture)
-    : _texture(texture), _anchor(), _x(0), _y(0), _z(0), _scale(1.0f), _degree(0.0f), _alpha(DGEX_COLOR_OPAQUE),
-      _flipX(false), _flipY(false), _defaultAnchor(true)
+bool IsAxisAlignedRect(const RectRenderCommand& command)
 {
+    return !command.Transform || command.Transform->IsAxisAligned();
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::SetAlpha(uint8_t alpha)
+SDL_FRect GetTransformedRect(const RectRenderCommand& command)
 {
-    _alpha = alpha;
+    DGEX_ASSERT(IsAxisAlignedRect(command), "Rectangle is rotated by its transform");
+
+    if (!command.Transform)
+    {
+        return command.Rect;
+    }
+
+    const Transform& transform = *command.Transform;
+    SDL_FRect rect{ transform.A * command.Rect.x + transform.X, transform.D * command.Rect.y + transform.Y,
+                    transform.A * command.Rect.w, transform.D * command.Rect.h };
 
-    return *this;
+    // Mirrored rectangles start from the other side.
+    if (rect.w < 0.0f)
+    {
+        rect.x += rect.w;
+        rect.w = -rect.w;
+    }
+    if (rect.h < 0.0f)
+    {
+        rect.y += rect.h;
+        rect.h = -rect.h;
+    }
+
+    return rect;
+}
+
+void GetRectCorners(const RectRenderCommand& command, SDL_FPoint* corners)
+{
+    const SDL_FRect& rect = command.Rect;
+    corners[0] = TransformPoint(command, rect.x, rect.y);
+    corners[1] = TransformPoint(command, rect.x + rect.w, rect.y);
+    corners[2] = TransformPoint(command, rect.x + rect.w, rect.y + rect.h);
+    corners[3] = TransformPoint(command, rect.x, rect.y + rect.h);
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::SetAnchor(int x, int y)
+// Reference: https://wiki.libsdl.org/SDL3/SDL_RenderTextureRotated
+SDL_FRect GetTextureSource(const TextureRenderCommand& command, float textureWidth, float textureHeight)
 {
-    _anchor.x = static_cast<float>(x);
-    _anchor.y = static_cast<float>(y);
-    _defaultAnchor = false;
-    return *this;
+    if ((command.Source.w > 0.0f) && (command.Source.h > 0.0f))
+    {
+        return command.Source;
+    }
+    return { 0.0f, 0.0f, textureWidth, textureHeight };
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::SetPosition(int x, int y, int z)
+void GetTextureQuad(const TextureRenderCommand& command, float textureWidth, float textureHeight,
+                    SDL_Vertex* vertices)
 {
-    _x = static_cast<float>(x);
-    _y = static_cast<float>(y);
-    _z = z;
+    SDL_FRect source = GetTextureSource(command, textureWidth, textureHeight);
+
+    // Destination rectangle, scaled around the center of the region.
+    float width = source.w * command.Scale;
+    float height = source.h * command.Scale;
+    float left = command.X - source.w * (command.Scale - 1.0f) * 0.5f;
+    float top = command.Y - source.h * (command.Scale - 1.0f) * 0.5f;
+
+    // Flip horizontally and vertically is equivalent to rotate 180deg.
+    float degree = command.Degree;
+    float u0 = 0.0f, u1 = 1.0f;
+    float v0 = 0.0f, v1 = 1.0f;
+    if ((textureWidth > 0.0f) && (textureHeight > 0.0f))
+    {
+        u0 = source.x / textureWidth;
+        u1 = (source.x + source.w) / textureWidth;
+        v0 = source.y / textureHeight;
+        v1 = (source.y + source.h) / textureHeight;
+    }
+    if (command.FlipX && command.FlipY)
+    {
+        degree += 180.0f;
+    }
+    else if (command.FlipX)
+    {
+        std::swap(u0, u1);
+    }
+    else if (command.FlipY)
+    {
+        std::swap(v0, v1);
+    }
+
+    // Pivot relative to the top-left corner of the destination.
+    float pivotX, pivotY;
+    if (command.DefaultAnchor)
+    {
+        pivotX = width * 0.5f;
+        pivotY = height * 0.5f;
+    }
+    else
+    {
+        pivotX = command.Anchor.x * command.Scale;
+        pivotY = command.Anchor.y * command.Scale;
+    }
+
+    float radians = Math::ToRadians(degree);
+    float c = Math::Cos(radians);
+    float s = Math::Sin(radians);
+    float originX = left + pivotX;
+    float originY = top + pivotY;
 
-    return *this;
+    // Corners relative to the pivot, in clockwise order from top-left.
+    const float cornerX[4] = { -pivotX, width - pivotX, width - pivotX, -pivotX };
+    const float cornerY[4] = { -pivotY, -pivotY, height - pivotY, height - pivotY };
+    const float cornerU[4] = { u0, u1, u1, u0 };
+    const float cornerV[4] = { v0, v0, v1, v1 };
+
+    SDL_FColor color{ 1.0f, 1.0f, 1.0f, static_cast<float>(command.Alpha) / 255.0f };
+
+    for (int i = 0; i < 4; i++)
+    {
+        SDL_Vertex& vertex = vertices[i];
+        vertex.position.x = originX + cornerX[i] * c - cornerY[i] * s;
+        vertex.position.y = originY + cornerX[i] * s + cornerY[i] * c;
+        vertex.color = color;
+        vertex.tex_coord.x = cornerU[i];
+        vertex.tex_coord.y = cornerV[i];
+    }
+
+    // Rotation and transform can be folded into one matrix, but sprites are
+    // mostly drawn without a transform.
+    if (command.Transform)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            command.Transform->Apply(vertices[i].position.x, vertices[i].position.y);
+        }
+    }
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::SetRotation(float degree)
+// ============================================================================
+// Bounds
+// ----------------------------------------------------------------------------
+
+static SDL_FRect GetPointsBounds(const SDL_FPoint* points, int count)
 {
-    _degree = degree;
+    float minX = points[0].x;
+    float minY = points[0].y;
+    float maxX = points[0].x;
+    float maxY = points[0].y;
+    for (int i = 1; i < count; i++)
+    {
+        minX = Math::Min(minX, points[i].x);
+        minY = Math::Min(minY, points[i].y);
+        maxX = Math::Max(maxX, points[i].x);
+        maxY = Math::Max(maxY, points[i].y);
+    }
+    return { minX, minY, maxX - minX, maxY - minY };
+}
 
-    return *this;
+static SDL_FRect GetLineBounds(SDL_FPoint start, SDL_FPoint end)
+{
+    // Lines and points are one pixel wide.
+    const SDL_FPoint points[2] = { start, end };
+    SDL_FRect bounds = GetPointsBounds(points, 2);
+    bounds.w += 1.0f;
+    bounds.h += 1.0f;
+    return bounds;
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::SetScale(float scale)
+static SDL_FRect GetTextureBounds(const TextureRenderCommand& command)
 {
-    _scale = scale;
+    TextureInfo texture{};
+    GetTextureRegistry().Resolve(command.Texture, texture); // stale texture has no size
+
+    SDL_Vertex vertices[4];
+    GetTextureQuad(command, texture.Width, texture.Height, vertices);
 
-    return *this;
+    const SDL_FPoint points[4] = { vertices[0].position, vertices[1].position, vertices[2].position,
+                                   vertices[3].position };
+    return GetPointsBounds(points, 4);
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::FlipX()
+bool GetRenderCommandBounds(const RenderCommand& command, SDL_FRect& bounds)
 {
-    _flipX = true;
+    switch (command.Type)
+    {
+    case RenderCommandType::Point: {
+        const auto& point = static_cast<const PointRenderCommand&>(command);
+        SDL_FPoint position = TransformPoint(point, point.X, point.Y);
+        bounds = GetLineBounds(position, position);
+        return true;
+    }
+    case RenderCommandType::Line: {
+        const auto& line = static_cast<const LineRenderCommand&>(command);
+        bounds = GetLineBounds(TransformPoint(line, line.X1, line.Y1), TransformPoint(line, line.X2, line.Y2));
+        return true;
+    }
+    case RenderCommandType::Rect:
+    case RenderCommandType::FilledRect: {
+        const auto& rect = static_cast<const RectRenderCommand&>(command);
+        if (IsAxisAlignedRect(rect))
+        {
+            bounds = GetTransformedRect(rect);
+        }
+        else
+        {
+            SDL_FPoint corners[4];
+            GetRectCorners(rect, corners);
+            bounds = GetPointsBounds(corners, 4);
+        }
+        return true;
+    }
+    case RenderCommandType::Texture:
+        bounds = GetTextureBounds(static_cast<const TextureRenderCommand&>(command));
+        return true;
+    default:
+        // Text is not measured, and geometry is usually prepared already.
+        return false;
+    }
+}
+
+// ============================================================================
+// Hash
+// ----------------------------------------------------------------------------
+// FNV-1a, simple and good enough to detect changes.
+// Reference: http://www.isthe.com/chongo/tech/comp/fnv/
+// ----------------------------------------------------------------------------
 
-    return *this;
+static constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
 }
 
-TextureRenderCommandBuilder& TextureRenderCommandBuilder::FlipY()
+template <typename T> static uint64_t HashValue(uint64_t hash, const T& value)
 {
-    _flipY = true;
+    return HashBytes(hash, &value, sizeof(T));
+}
 
-    return *this;
+static uint64_t HashColor(uint64_t hash, const Color& color)
+{
+    uint8_t channels[4] = { color.R, color.G, color.B, color.A };
+    return HashBytes(hash, channels, sizeof(channels));
 }
 
-Ref<TextureRenderCommand> TextureRenderCommandBuilder::Create() const
+static uint64_t HashVertices(uint64_t hash, const SDL_Vertex* vertices, int count)
 {
-    if (_defaultAnchor)
+    for (int i = 0; i < count; i++)
+    {
+        const SDL_Vertex& vertex = vertices[i];
+        float values[8] = { vertex.position.x, vertex.position.y, vertex.color.r,     vertex.color.g,
+                            vertex.color.b,    vertex.color.a,    vertex.tex_coord.x, vertex.tex_coord.y };
+        hash = HashBytes(hash, values, sizeof(values));
+    }
+    return hash;
+}
+
+uint64_t HashRenderCommand(const RenderCommand& command, uint64_t seed)
+{
+    uint64_t hash = HashValue(seed, command.Type);
+    hash = HashValue(hash, command.Order);
+    if (command.Transform)
+    {
+        const Transform& transform = *command.Transform;
+        float values[6] = { transform.A, transform.B, transform.C, transform.D, transform.X, transform.Y };
+        hash = HashBytes(hash, values, sizeof(values));
+    }
+
+    switch (command.Type)
     {
-        return CreateRef<TextureRenderCommand>(_texture, _x, _y, _z, _scale, _degree, _alpha, _flipX, _flipY);
+    case RenderCommandType::Clear:
+        return HashColor(hash, static_cast<const ClearRenderCommand&>(command).ClearColor);
+    case RenderCommandType::Point: {
+        const auto& point = static_cast<const PointRenderCommand&>(command);
+        float values[2] = { point.X, point.Y };
+        return HashColor(HashBytes(hash, values, sizeof(values)), point.LineColor);
     }
-    return CreateRef<TextureRenderCommand>(_texture, _x, _y, _z, _anchor.x, _anchor.y, _scale, _degree, _alpha, _flipX,
-                                           _flipY);
+    case RenderCommandType::Line: {
+        const auto& line = static_cast<const LineRenderCommand&>(command);
+        float values[4] = { line.X1, line.Y1, line.X2, line.Y2 };
+        return HashColor(HashBytes(hash, values, sizeof(values)), line.LineColor);
+    }
+    case RenderCommandType::Rect:
+    case RenderCommandType::FilledRect: {
+        const auto& rect = static_cast<const RectRenderCommand&>(command);
+        float values[4] = { rect.Rect.x, rect.Rect.y, rect.Rect.w, rect.Rect.h };
+        return HashColor(HashBytes(hash, values, sizeof(values)), rect.DrawColor);
+    }
+    case RenderCommandType::Texture: {
+        const auto& texture = static_cast<const TextureRenderCommand&>(command);
+        float values[10] = { texture.Anchor.x, texture.Anchor.y, texture.X,        texture.Y,        texture.Scale,
+                             texture.Degree,   texture.Source.x, texture.Source.y, texture.Source.w, texture.Source.h };
+        uint8_t flags[4] = { texture.Alpha, texture.FlipX, texture.FlipY, texture.DefaultAnchor };
+        hash = HashValue(hash, texture.Texture);
+        hash = HashBytes(hash, values, sizeof(values));
+        return HashBytes(hash, flags, sizeof(flags));
+    }
+    case RenderCommandType::Text:
+    case RenderCommandType::TextArea: {
+        const auto& text = static_cast<const TextRenderCommand&>(command);
+        int area[4] = { text.Area.x, text.Area.y, text.Area.w, text.Area.h };
+        hash = HashValue(hash, text.Font);
+        hash = HashBytes(hash, text.Text, text.Text ? std::strlen(text.Text) : 0);
+        hash = HashBytes(hash, area, sizeof(area));
+        hash = HashColor(hash, text.FontColor);
+        hash = HashValue(hash, text.Scale);
+        return HashValue(hash, text.Flags);
+    }
+    case RenderCommandType::Geometry: {
+        const auto& geometry = static_cast<const GeometryRenderCommand&>(command);
+        hash = HashValue(hash, geometry.Texture);
+        hash = HashVertices(hash, geometry.Vertices, geometry.VertexCount);
+        return HashBytes(hash, geometry.Indices, sizeof(int) * static_cast<size_t>(geometry.IndexCount));
+    }
+    }
+
+    return hash;
+}
+
+static RenderCommand* CopyCommandBody(LinearArena& arena, const RenderCommand& command)
+{
+    switch (command.Type)
+    {
+    case RenderCommandType::Clear:
+        return arena.New(static_cast<const ClearRenderCommand&>(command));
+    case RenderCommandType::Point:
+        return arena.New(static_cast<const PointRenderCommand&>(command));
+    case RenderCommandType::Line:
+        return arena.New(static_cast<const LineRenderCommand&>(command));
+    case RenderCommandType::Rect:
+    case RenderCommandType::FilledRect:
+        return arena.New(static_cast<const RectRenderCommand&>(command));
+    case RenderCommandType::Texture:
+        return arena.New(static_cast<const TextureRenderCommand&>(command));
+    case RenderCommandType::Text:
+    case RenderCommandType::TextArea: {
+        // Text is owned by the caller, so we need our own copy.
+        TextRenderCommand* copy = arena.New(static_cast<const TextRenderCommand&>(command));
+        copy->Text = arena.CopyString(copy->Text);
+        return copy;
+    }
+    case RenderCommandType::Geometry: {
+        // Vertices are owned by the submitter, see GeometryRenderCommand,
+        // unless they only live as long as the call.
+        GeometryRenderCommand* copy = arena.New(static_cast<const GeometryRenderCommand&>(command));
+        if (copy->Transient)
+        {
+            copy->Vertices = arena.NewArray(copy->Vertices, static_cast<size_t>(copy->VertexCount));
+            copy->Indices = arena.NewArray(copy->Indices, static_cast<size_t>(copy->IndexCount));
+        }
+        return copy;
+    }
+    }
+
+    DGEX_ASSERT(false, "Unknown render command type");
+    return nullptr;
+}
+
+RenderCommand* CopyRenderCommand(LinearArena& arena, const RenderCommand& command)
+{
+    RenderCommand* copy = CopyCommandBody(arena, command);
+
+    // Transform is usually on the stack of the submitter.
+    if (copy && copy->Transform)
+    {
+        copy->Transform = arena.New(*copy->Transform);
+    }
+
+    return copy;
 }
 
 DGEX_END
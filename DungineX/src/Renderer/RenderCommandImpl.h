@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 3, 2025                              *
  *                                                                            *
- *                    Last Update : June 4, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -21,122 +21,169 @@
 
 #include "Device/Graphics/RenderCommand.h"
 
-#include "DgeX/Utils/Types.h"
-
-#include <functional>
+#include "DgeX/Renderer/Color.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
 
 DGEX_BEGIN
 
 /**
- * @brief Native render command represents a render action.
- *
- * You can have more flexibility to control what you want to render
- * using NativeRenderCommand.
+ * @brief Clear the current render target.
  */
-class NativeRenderCommand final : public RenderCommand
+struct ClearRenderCommand : RenderCommand
 {
-    using RenderAction = std::function<void(SDL_Renderer*)>;
-
-public:
-    NativeRenderCommand(const RenderAction& action, int order);
-    ~NativeRenderCommand() override = default;
+    Color ClearColor;
+};
 
-    void Apply(SDL_Renderer* renderer) override;
+/**
+ * @brief Draw a single point.
+ */
+struct PointRenderCommand : RenderCommand
+{
+    float X;
+    float Y;
+    Color LineColor;
+};
 
-    static Ref<NativeRenderCommand> Create(const RenderAction& action, int order = 0);
+/**
+ * @brief Draw a line segment.
+ */
+struct LineRenderCommand : RenderCommand
+{
+    float X1;
+    float Y1;
+    float X2;
+    float Y2;
+    Color LineColor;
+};
 
-private:
-    RenderAction _action;
+/**
+ * @brief Draw a rectangle, either outlined or filled.
+ *
+ * Outlined rectangle uses RenderCommandType::Rect, and filled one uses
+ * RenderCommandType::FilledRect.
+ */
+struct RectRenderCommand : RenderCommand
+{
+    SDL_FRect Rect;
+    Color DrawColor;
 };
 
 /**
  * @brief Render a prepared texture.
  *
  * If you have a texture ready to go, use TextureRenderCommand to draw
- * it.
+ * it. With a source region, only that part is drawn, as if it were the
+ * whole texture, so anchor and size are relative to the region.
  */
-class TextureRenderCommand final : public RenderCommand
+struct TextureRenderCommand : RenderCommand
 {
-public:
-    // clang-format off
-    TextureRenderCommand(
-        SDL_Texture* texture,
-        float x,
-        float y,
-        int z,
-        float scale, 
-        float degree,
-        uint8_t alpha,
-        bool flipX,
-        bool flipY);
-
-    TextureRenderCommand(
-        SDL_Texture* texture,
-        float x,
-        float y,
-        int z,
-        float anchorX,
-        float anchorY,
-        float scale, 
-        float degree,
-        uint8_t alpha,
-        bool flipX,
-        bool flipY);
-    // clang-format on
-
-    ~TextureRenderCommand() override = default;
-
-    void Apply(SDL_Renderer* renderer) override;
-
-private:
-    SDL_Texture* _texture;
-    SDL_FPoint _anchor;
-
-    float _x; // x on the screen
-    float _y; // y on the screen
-
-    float _scale;  // scale, 1.0 for no scale
-    float _degree; // rotation in degree
-
-    uint8_t _alpha; // alpha value, 0 ~ 255
-
-    bool _flipX : 1;         // flip horizontally
-    bool _flipY : 1;         // flip vertically
-    bool _defaultAnchor : 1; // whether to use default anchor or not
+    TextureHandle Texture;
+    SDL_FPoint Anchor; // only valid if DefaultAnchor is false
+
+    float X; // x on the screen
+    float Y; // y on the screen
+
+    float Scale;  // scale, 1.0 for no scale
+    float Degree; // rotation in degree
+
+    uint8_t Alpha; // alpha value, 0 ~ 255
+
+    bool FlipX : 1;         // flip horizontally
+    bool FlipY : 1;         // flip vertically
+    bool DefaultAnchor : 1; // whether to use default anchor or not
+
+    SDL_FRect Source = { 0.0f, 0.0f, 0.0f, 0.0f }; // region in the texture, whole texture if empty
 };
 
-class TextureRenderCommandBuilder
+/**
+ * @brief Draw text at a point, or in an area.
+ *
+ * Point text uses RenderCommandType::Text, in which case only X and Y of
+ * the area are used. Area text uses RenderCommandType::TextArea.
+ */
+struct TextRenderCommand : RenderCommand
 {
-public:
-    TextureRenderCommandBuilder(SDL_Texture* texture);
+    void* Font;       // font implementation, see Font::GetImpl
+    const char* Text; // copied into the arena when queued
+    SDL_Rect Area;
+    Color FontColor;
+    float Scale;
+    TextFlags Flags;
+};
 
-    TextureRenderCommandBuilder& SetAlpha(uint8_t alpha);
-    TextureRenderCommandBuilder& SetAnchor(int x, int y);
-    TextureRenderCommandBuilder& SetPosition(int x, int y, int z = 0);
-    TextureRenderCommandBuilder& SetRotation(float degree);
-    TextureRenderCommandBuilder& SetScale(float scale);
+/**
+ * @brief Draw prepared triangles, optionally textured.
+ *
+ * Vertices and indices are not owned, and are not copied when queued,
+ * so the owner must keep them alive until the command is rendered.
+ * Transient geometry, only alive during submission, is copied instead.
+ * So is geometry submitted by the simulation thread of a pipelined main
+ * loop, which updates its vertices while the last frame is rendered.
+ */
+struct GeometryRenderCommand : RenderCommand
+{
+    TextureHandle Texture; // invalid for untextured geometry
+    const SDL_Vertex* Vertices;
+    const int* Indices;
+    int VertexCount;
+    int IndexCount;
+    uint32_t SpriteCount;   // sprites baked into the geometry, for statistics
+    bool Transient = false; // copy vertices and indices when queued
+};
+
+// ============================================================================
+// Transform Helpers
+// ----------------------------------------------------------------------------
 
-    TextureRenderCommandBuilder& FlipX();
-    TextureRenderCommandBuilder& FlipY();
+SDL_FColor ToFColor(const Color& color);
 
-    Ref<TextureRenderCommand> Create() const;
+/**
+ * @brief Transform a point of a command by the command transform.
+ */
+SDL_FPoint TransformPoint(const RenderCommand& command, float x, float y);
 
-private:
-    SDL_Texture* _texture;
-    SDL_FPoint _anchor;
+/**
+ * @brief Check whether a rectangle stays a rectangle after its transform.
+ */
+bool IsAxisAlignedRect(const RectRenderCommand& command);
 
-    float _x; // x on the screen
-    float _y; // y on the screen
-    int _z;
+/**
+ * @brief Get the rectangle after its transform.
+ *
+ * @param command Rectangle command, must pass IsAxisAlignedRect.
+ * @return The transformed rectangle, with non-negative size.
+ */
+SDL_FRect GetTransformedRect(const RectRenderCommand& command);
 
-    float _scale;  // scale, 1.0 for no scale
-    float _degree; // rotation in degree
+/**
+ * @brief Get corners of a rectangle after its transform.
+ *
+ * @param command Rectangle command.
+ * @param corners Four corners, clockwise from the top-left one.
+ */
+void GetRectCorners(const RectRenderCommand& command, SDL_FPoint* corners);
 
-    uint8_t _alpha; // alpha value, 0 ~ 255
+/**
+ * @brief Get the region of the texture a sprite draws.
+ *
+ * @return Source region of the command, or the whole texture.
+ */
+SDL_FRect GetTextureSource(const TextureRenderCommand& command, float textureWidth, float textureHeight);
 
-    bool _flipX : 1;         // flip horizontally
-    bool _flipY : 1;         // flip vertically
-    bool _defaultAnchor : 1; // whether to use default anchor
-};
+/**
+ * @brief Get the quad of a sprite after its transform.
+ *
+ * The quad is computed the same way SDL does for a rotated texture, so
+ * that batched and non-batched sprites look identical. Flips are done by
+ * texture coordinates, and alpha is put in vertex color.
+ *
+ * @param command Texture command.
+ * @param textureWidth Width of the texture.
+ * @param textureHeight Height of the texture.
+ * @param vertices Four vertices, clockwise from the top-left one.
+ */
+void GetTextureQuad(const TextureRenderCommand& command, float textureWidth, float textureHeight,
+                    SDL_Vertex* vertices);
 
 DGEX_END
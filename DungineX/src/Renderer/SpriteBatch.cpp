@@ -0,0 +1,168 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : SpriteBatch.cpp                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Merge texture commands of the same texture into one geometry draw.         *
+ ******************************************************************************/
+
+#include "Renderer/SpriteBatch.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+#include "Renderer/TextureRegistry.h"
+
+#include "DgeX/Utils/Assert.h"
+
+DGEX_BEGIN
+
+SpriteBatch::SpriteBatch() : _texture(), _native(nullptr), _textureWidth(0.0f), _textureHeight(0.0f), _hasTransform(false)
+{
+}
+
+bool SpriteBatch::CanBatch(const TextureRenderCommand& command) const
+{
+    return IsEmpty() || (command.Texture == _texture);
+}
+
+/**
+ * @brief Check whether a sprite is under the transform of pending ones.
+ */
+static bool IsSameTransform(const Transform* transform, const Transform& current, bool hasTransform)
+{
+    if (!transform)
+    {
+        return !hasTransform;
+    }
+    return hasTransform && (transform->A == current.A) && (transform->B == current.B) &&
+           (transform->C == current.C) && (transform->D == current.D) && (transform->X == current.X) &&
+           (transform->Y == current.Y);
+}
+
+void SpriteBatch::Add(const TextureRenderCommand& command)
+{
+    DGEX_ASSERT(CanBatch(command), "Texture mismatch in sprite batch");
+
+    if (IsEmpty())
+    {
+        // Stale texture resolves to nothing, and the batch draws nothing.
+        TextureInfo texture{};
+        GetTextureRegistry().Resolve(command.Texture, texture);
+        _texture = command.Texture;
+        _native = texture.Native;
+        _textureWidth = texture.Width;
+        _textureHeight = texture.Height;
+    }
+
+    // Pending sprites share one transform, which is usually the camera.
+    if (!IsSameTransform(command.Transform, _transform, _hasTransform))
+    {
+        Generate();
+        _hasTransform = command.Transform != nullptr;
+        _transform = _hasTransform ? *command.Transform : Transform();
+    }
+
+    _pending.Push(command, _textureWidth, _textureHeight);
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_RenderGeometry
+bool SpriteBatch::Flush(SDL_Renderer* renderer)
+{
+    if (IsEmpty())
+    {
+        return false;
+    }
+
+    Generate();
+
+    // The texture may be destroyed since the batch started.
+    TextureInfo texture;
+    if (!GetTextureRegistry().Resolve(_texture, texture))
+    {
+        Clear();
+        return false;
+    }
+
+    // Alpha is in vertex color, so clear any alpha left by non-batched draws.
+    GetRenderStateCache().SetTextureAlphaMod(_native, DGEX_COLOR_OPAQUE);
+    SDL_RenderGeometry(renderer, _native, _vertices.data(), static_cast<int>(_vertices.size()), _indices.data(),
+                       static_cast<int>(_indices.size()));
+
+    _vertices.clear();
+    _indices.clear();
+
+    return true;
+}
+
+bool SpriteBatch::IsEmpty() const
+{
+    return _vertices.empty() && (_pending.Size() == 0);
+}
+
+size_t SpriteBatch::GetSpriteCount() const
+{
+    return _vertices.size() / 4 + _pending.Size();
+}
+
+TextureHandle SpriteBatch::GetTexture() const
+{
+    return _texture;
+}
+
+const std::vector<SDL_Vertex>& SpriteBatch::GetVertices()
+{
+    Generate();
+    return _vertices;
+}
+
+const std::vector<int>& SpriteBatch::GetIndices()
+{
+    Generate();
+    return _indices;
+}
+
+void SpriteBatch::Clear()
+{
+    _pending.Clear();
+    _vertices.clear();
+    _indices.clear();
+}
+
+void SpriteBatch::Generate()
+{
+    size_t count = _pending.Size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t base = _vertices.size();
+    _vertices.resize(base + count * 4);
+    GenerateSpriteVertices(_pending, _hasTransform ? &_transform : nullptr, _vertices.data() + base);
+
+    _indices.reserve(_indices.size() + count * 6);
+    for (size_t i = 0; i < count; i++)
+    {
+        int first = static_cast<int>(base + i * 4);
+        _indices.push_back(first);
+        _indices.push_back(first + 1);
+        _indices.push_back(first + 2);
+        _indices.push_back(first + 2);
+        _indices.push_back(first + 3);
+        _indices.push_back(first);
+    }
+
+    _pending.Clear();
+}
+
+DGEX_END
@@ -0,0 +1,128 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : SpriteBatch.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Merge texture commands of the same texture into one geometry draw.         *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/RenderCommandImpl.h"
+#include "Renderer/SpriteVertex.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Accumulate sprites of one texture into a single vertex stream.
+ *
+ * Each texture command becomes a quad with its corners already scaled,
+ * rotated, flipped and transformed, and alpha carried as vertex color, so
+ * that the whole run can be drawn with one SDL_RenderGeometry call.
+ *
+ * Sprites are first collected in a SpriteStream, and turned into quads in
+ * bulk with SIMD when the vertices are needed, or when the transform
+ * changes.
+ */
+class SpriteBatch
+{
+public:
+    SpriteBatch();
+    SpriteBatch(const SpriteBatch& other) = delete;
+    SpriteBatch(SpriteBatch&& other) noexcept = default;
+    SpriteBatch& operator=(const SpriteBatch& other) = delete;
+    SpriteBatch& operator=(SpriteBatch&& other) noexcept = default;
+
+    ~SpriteBatch() = default;
+
+    /**
+     * @brief Check whether the command can join the current batch.
+     *
+     * @param command Texture command.
+     * @return Whether the command shares the texture of the batch.
+     */
+    bool CanBatch(const TextureRenderCommand& command) const;
+
+    /**
+     * @brief Add a sprite to the batch.
+     *
+     * If the batch is empty, it will adopt the texture of the command,
+     * otherwise, the texture must match, see CanBatch.
+     *
+     * @param command Texture command.
+     */
+    void Add(const TextureRenderCommand& command);
+
+    /**
+     * @brief Draw all sprites in the batch, and clear it.
+     *
+     * @param renderer The native renderer.
+     * @return Whether a draw call is issued, i.e. the batch is not empty.
+     */
+    bool Flush(SDL_Renderer* renderer);
+
+    bool IsEmpty() const;
+
+    /**
+     * @brief Get the number of sprites in the current batch.
+     */
+    size_t GetSpriteCount() const;
+
+    /**
+     * @brief Get the texture of the current batch.
+     */
+    TextureHandle GetTexture() const;
+
+    /**
+     * @brief Get vertices of the current batch, to bake them elsewhere.
+     *
+     * Pending sprites are generated first.
+     */
+    const std::vector<SDL_Vertex>& GetVertices();
+
+    /**
+     * @brief Get indices of the current batch, relative to its vertices.
+     *
+     * Pending sprites are generated first.
+     */
+    const std::vector<int>& GetIndices();
+
+    /**
+     * @brief Clear the batch without drawing.
+     */
+    void Clear();
+
+private:
+    /**
+     * @brief Generate quads of pending sprites.
+     */
+    void Generate();
+
+private:
+    TextureHandle _texture;
+    SDL_Texture* _native; // resolved when the batch starts
+    float _textureWidth;
+    float _textureHeight;
+
+    SpriteStream _pending;  // sprites not yet generated
+    Transform _transform;   // transform of pending sprites
+    bool _hasTransform;     // whether _transform is not identity
+
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices;
+};
+
+DGEX_END
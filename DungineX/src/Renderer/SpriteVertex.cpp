@@ -0,0 +1,416 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : SpriteVertex.cpp                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Generate sprite quads in bulk with SIMD.                                   *
+ ******************************************************************************/
+
+#include "Renderer/SpriteVertex.h"
+
+#include "Utils/Simd.h"
+
+#include "DgeX/Utils/Math.h"
+
+DGEX_BEGIN
+
+// Vertices are written as 8 floats: x, y, r, g, b, a, u, v.
+static_assert(sizeof(SDL_Vertex) == sizeof(float) * 8, "Unexpected SDL_Vertex layout");
+
+// ============================================================================
+// Sprite Stream
+// ----------------------------------------------------------------------------
+
+void SpriteStream::Push(const TextureRenderCommand& command, float textureWidth, float textureHeight)
+{
+    SDL_FRect source = GetTextureSource(command, textureWidth, textureHeight);
+
+    // Flip horizontally and vertically is equivalent to rotate 180deg.
+    float degree = command.Degree;
+    bool flipX = command.FlipX;
+    bool flipY = command.FlipY;
+    if (flipX && flipY)
+    {
+        degree += 180.0f;
+        flipX = false;
+        flipY = false;
+    }
+
+    float radians = Math::ToRadians(degree);
+
+    float u0 = 0.0f, u1 = 1.0f;
+    float v0 = 0.0f, v1 = 1.0f;
+    if ((textureWidth > 0.0f) && (textureHeight > 0.0f))
+    {
+        u0 = source.x / textureWidth;
+        u1 = (source.x + source.w) / textureWidth;
+        v0 = source.y / textureHeight;
+        v1 = (source.y + source.h) / textureHeight;
+    }
+
+    X.push_back(command.X);
+    Y.push_back(command.Y);
+    Width.push_back(source.w);
+    Height.push_back(source.h);
+    Scale.push_back(command.Scale);
+    Cos.push_back(Math::Cos(radians));
+    Sin.push_back(Math::Sin(radians));
+    AnchorX.push_back(command.DefaultAnchor ? source.w * 0.5f : command.Anchor.x);
+    AnchorY.push_back(command.DefaultAnchor ? source.h * 0.5f : command.Anchor.y);
+    U0.push_back(flipX ? u1 : u0);
+    V0.push_back(flipY ? v1 : v0);
+    U1.push_back(flipX ? u0 : u1);
+    V1.push_back(flipY ? v0 : v1);
+    Alpha.push_back(static_cast<float>(command.Alpha) / 255.0f);
+}
+
+void SpriteStream::Clear()
+{
+    X.clear();
+    Y.clear();
+    Width.clear();
+    Height.clear();
+    Scale.clear();
+    Cos.clear();
+    Sin.clear();
+    AnchorX.clear();
+    AnchorY.clear();
+    U0.clear();
+    V0.clear();
+    U1.clear();
+    V1.clear();
+    Alpha.clear();
+}
+
+size_t SpriteStream::Size() const
+{
+    return X.size();
+}
+
+// ============================================================================
+// Scalar Path
+// ----------------------------------------------------------------------------
+
+void GenerateSpriteVerticesScalar(const SpriteStream& stream, const Transform* transform, SDL_Vertex* vertices,
+                                  size_t first, size_t last)
+{
+    Transform t = transform ? *transform : Transform();
+
+    for (size_t i = first; i < last; i++)
+    {
+        float scale = stream.Scale[i];
+        float width = stream.Width[i] * scale;
+        float height = stream.Height[i] * scale;
+        float pivotX = stream.AnchorX[i] * scale;
+        float pivotY = stream.AnchorY[i] * scale;
+        float originX = stream.X[i] - stream.Width[i] * (scale - 1.0f) * 0.5f + pivotX;
+        float originY = stream.Y[i] - stream.Height[i] * (scale - 1.0f) * 0.5f + pivotY;
+        float c = stream.Cos[i];
+        float s = stream.Sin[i];
+        float u0 = stream.U0[i];
+        float v0 = stream.V0[i];
+        float u1 = stream.U1[i];
+        float v1 = stream.V1[i];
+
+        const float cornerX[4] = { -pivotX, width - pivotX, width - pivotX, -pivotX };
+        const float cornerY[4] = { -pivotY, -pivotY, height - pivotY, height - pivotY };
+        const float cornerU[4] = { u0, u1, u1, u0 };
+        const float cornerV[4] = { v0, v0, v1, v1 };
+
+        SDL_Vertex* quad = vertices + i * 4;
+        for (int j = 0; j < 4; j++)
+        {
+            float x = originX + cornerX[j] * c - cornerY[j] * s;
+            float y = originY + cornerX[j] * s + cornerY[j] * c;
+            t.Apply(x, y);
+            quad[j] = { { x, y }, { 1.0f, 1.0f, 1.0f, stream.Alpha[i] }, { cornerU[j], cornerV[j] } };
+        }
+    }
+}
+
+// ============================================================================
+// SIMD Path
+// ----------------------------------------------------------------------------
+// Each instruction set provides Vec with a few operations, and StoreCorner
+// to write one corner of LANES sprites. The math is shared below.
+// ----------------------------------------------------------------------------
+
+#if defined(DGEX_SIMD_AVX2)
+
+using Vec = __m256;
+static constexpr size_t LANES = 8;
+
+static inline Vec Load(const float* p)
+{
+    return _mm256_loadu_ps(p);
+}
+
+static inline Vec Set1(float value)
+{
+    return _mm256_set1_ps(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return _mm256_add_ps(a, b);
+}
+
+static inline Vec Sub(Vec a, Vec b)
+{
+    return _mm256_sub_ps(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return _mm256_mul_ps(a, b);
+}
+
+// Reference: https://stackoverflow.com/questions/25622745/transpose-an-8x8-float-using-avx-avx2
+static inline void StoreCorner(float* out, Vec x, Vec y, Vec alpha, Vec u, Vec v)
+{
+    // Rows are attributes of a vertex, transpose them into vertices.
+    Vec one = _mm256_set1_ps(1.0f);
+    Vec t0 = _mm256_unpacklo_ps(x, y);
+    Vec t1 = _mm256_unpackhi_ps(x, y);
+    Vec t2 = _mm256_unpacklo_ps(one, one);
+    Vec t3 = _mm256_unpackhi_ps(one, one);
+    Vec t4 = _mm256_unpacklo_ps(one, alpha);
+    Vec t5 = _mm256_unpackhi_ps(one, alpha);
+    Vec t6 = _mm256_unpacklo_ps(u, v);
+    Vec t7 = _mm256_unpackhi_ps(u, v);
+
+    Vec s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    Vec s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    Vec s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    Vec s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    Vec s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    Vec s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    Vec s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    Vec s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    // Corners of consecutive sprites are 4 vertices apart.
+    constexpr size_t STRIDE = 32;
+    _mm256_storeu_ps(out + STRIDE * 0, _mm256_permute2f128_ps(s0, s4, 0x20));
+    _mm256_storeu_ps(out + STRIDE * 1, _mm256_permute2f128_ps(s1, s5, 0x20));
+    _mm256_storeu_ps(out + STRIDE * 2, _mm256_permute2f128_ps(s2, s6, 0x20));
+    _mm256_storeu_ps(out + STRIDE * 3, _mm256_permute2f128_ps(s3, s7, 0x20));
+    _mm256_storeu_ps(out + STRIDE * 4, _mm256_permute2f128_ps(s0, s4, 0x31));
+    _mm256_storeu_ps(out + STRIDE * 5, _mm256_permute2f128_ps(s1, s5, 0x31));
+    _mm256_storeu_ps(out + STRIDE * 6, _mm256_permute2f128_ps(s2, s6, 0x31));
+    _mm256_storeu_ps(out + STRIDE * 7, _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+
+#elif defined(DGEX_SIMD_SSE2)
+
+using Vec = __m128;
+static constexpr size_t LANES = 4;
+
+static inline Vec Load(const float* p)
+{
+    return _mm_loadu_ps(p);
+}
+
+static inline Vec Set1(float value)
+{
+    return _mm_set1_ps(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return _mm_add_ps(a, b);
+}
+
+static inline Vec Sub(Vec a, Vec b)
+{
+    return _mm_sub_ps(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return _mm_mul_ps(a, b);
+}
+
+static inline void StoreCorner(float* out, Vec x, Vec y, Vec alpha, Vec u, Vec v)
+{
+    // Rows are attributes, so transposing gives the halves of vertices.
+    Vec one = _mm_set1_ps(1.0f);
+    Vec lo0 = x, lo1 = y, lo2 = one, lo3 = one;
+    Vec hi0 = one, hi1 = alpha, hi2 = u, hi3 = v;
+    _MM_TRANSPOSE4_PS(lo0, lo1, lo2, lo3);
+    _MM_TRANSPOSE4_PS(hi0, hi1, hi2, hi3);
+
+    // Corners of consecutive sprites are 4 vertices apart.
+    constexpr size_t STRIDE = 32;
+    _mm_storeu_ps(out + STRIDE * 0, lo0);
+    _mm_storeu_ps(out + STRIDE * 0 + 4, hi0);
+    _mm_storeu_ps(out + STRIDE * 1, lo1);
+    _mm_storeu_ps(out + STRIDE * 1 + 4, hi1);
+    _mm_storeu_ps(out + STRIDE * 2, lo2);
+    _mm_storeu_ps(out + STRIDE * 2 + 4, hi2);
+    _mm_storeu_ps(out + STRIDE * 3, lo3);
+    _mm_storeu_ps(out + STRIDE * 3 + 4, hi3);
+}
+
+#elif defined(DGEX_SIMD_NEON)
+
+using Vec = float32x4_t;
+static constexpr size_t LANES = 4;
+
+static inline Vec Load(const float* p)
+{
+    return vld1q_f32(p);
+}
+
+static inline Vec Set1(float value)
+{
+    return vdupq_n_f32(value);
+}
+
+static inline Vec Add(Vec a, Vec b)
+{
+    return vaddq_f32(a, b);
+}
+
+static inline Vec Sub(Vec a, Vec b)
+{
+    return vsubq_f32(a, b);
+}
+
+static inline Vec Mul(Vec a, Vec b)
+{
+    return vmulq_f32(a, b);
+}
+
+/**
+ * @brief Transpose 4x4, so that lane i of every row goes to row i.
+ */
+static inline void Transpose(Vec& r0, Vec& r1, Vec& r2, Vec& r3)
+{
+    float32x4x2_t p01 = vtrnq_f32(r0, r1);
+    float32x4x2_t p23 = vtrnq_f32(r2, r3);
+    r0 = vcombine_f32(vget_low_f32(p01.val[0]), vget_low_f32(p23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(p01.val[1]), vget_low_f32(p23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(p01.val[0]), vget_high_f32(p23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(p01.val[1]), vget_high_f32(p23.val[1]));
+}
+
+static inline void StoreCorner(float* out, Vec x, Vec y, Vec alpha, Vec u, Vec v)
+{
+    // Rows are attributes, so transposing gives the halves of vertices.
+    Vec one = vdupq_n_f32(1.0f);
+    Vec lo0 = x, lo1 = y, lo2 = one, lo3 = one;
+    Vec hi0 = one, hi1 = alpha, hi2 = u, hi3 = v;
+    Transpose(lo0, lo1, lo2, lo3);
+    Transpose(hi0, hi1, hi2, hi3);
+
+    // Corners of consecutive sprites are 4 vertices apart.
+    constexpr size_t STRIDE = 32;
+    vst1q_f32(out + STRIDE * 0, lo0);
+    vst1q_f32(out + STRIDE * 0 + 4, hi0);
+    vst1q_f32(out + STRIDE * 1, lo1);
+    vst1q_f32(out + STRIDE * 1 + 4, hi1);
+    vst1q_f32(out + STRIDE * 2, lo2);
+    vst1q_f32(out + STRIDE * 2 + 4, hi2);
+    vst1q_f32(out + STRIDE * 3, lo3);
+    vst1q_f32(out + STRIDE * 3 + 4, hi3);
+}
+
+#endif
+
+#ifndef DGEX_SIMD_SCALAR
+
+/**
+ * @brief Generate quads of LANES sprites starting from index i.
+ *
+ * Same math as GenerateSpriteVerticesScalar, one lane per sprite.
+ */
+static void GenerateLanes(const SpriteStream& stream, size_t i, const Transform& t, SDL_Vertex* vertices)
+{
+    Vec one = Set1(1.0f);
+    Vec half = Set1(0.5f);
+    Vec regionWidth = Load(stream.Width.data() + i);
+    Vec regionHeight = Load(stream.Height.data() + i);
+
+    Vec scale = Load(stream.Scale.data() + i);
+    Vec c = Load(stream.Cos.data() + i);
+    Vec s = Load(stream.Sin.data() + i);
+    Vec alpha = Load(stream.Alpha.data() + i);
+
+    Vec width = Mul(regionWidth, scale);
+    Vec height = Mul(regionHeight, scale);
+    Vec pivotX = Mul(Load(stream.AnchorX.data() + i), scale);
+    Vec pivotY = Mul(Load(stream.AnchorY.data() + i), scale);
+    Vec scaleOffset = Mul(Sub(scale, one), half);
+    Vec originX = Add(Sub(Load(stream.X.data() + i), Mul(regionWidth, scaleOffset)), pivotX);
+    Vec originY = Add(Sub(Load(stream.Y.data() + i), Mul(regionHeight, scaleOffset)), pivotY);
+
+    Vec left = Sub(Set1(0.0f), pivotX);
+    Vec right = Sub(width, pivotX);
+    Vec top = Sub(Set1(0.0f), pivotY);
+    Vec bottom = Sub(height, pivotY);
+
+    Vec u0 = Load(stream.U0.data() + i);
+    Vec v0 = Load(stream.V0.data() + i);
+    Vec u1 = Load(stream.U1.data() + i);
+    Vec v1 = Load(stream.V1.data() + i);
+
+    const Vec cornerX[4] = { left, right, right, left };
+    const Vec cornerY[4] = { top, top, bottom, bottom };
+    const Vec cornerU[4] = { u0, u1, u1, u0 };
+    const Vec cornerV[4] = { v0, v0, v1, v1 };
+
+    Vec a = Set1(t.A);
+    Vec b = Set1(t.B);
+    Vec tc = Set1(t.C);
+    Vec d = Set1(t.D);
+    Vec tx = Set1(t.X);
+    Vec ty = Set1(t.Y);
+
+    auto* out = reinterpret_cast<float*>(vertices + i * 4);
+    for (int j = 0; j < 4; j++)
+    {
+        // Rotate about the pivot, then transform.
+        Vec x = Sub(Add(originX, Mul(cornerX[j], c)), Mul(cornerY[j], s));
+        Vec y = Add(Add(originY, Mul(cornerX[j], s)), Mul(cornerY[j], c));
+        Vec screenX = Add(Add(Mul(a, x), Mul(tc, y)), tx);
+        Vec screenY = Add(Add(Mul(b, x), Mul(d, y)), ty);
+
+        StoreCorner(out + j * 8, screenX, screenY, alpha, cornerU[j], cornerV[j]);
+    }
+}
+
+#endif
+
+void GenerateSpriteVertices(const SpriteStream& stream, const Transform* transform, SDL_Vertex* vertices)
+{
+    size_t count = stream.Size();
+    size_t i = 0;
+
+#ifndef DGEX_SIMD_SCALAR
+    Transform t = transform ? *transform : Transform();
+    for (; i + LANES <= count; i += LANES)
+    {
+        GenerateLanes(stream, i, t, vertices);
+    }
+#endif
+
+    GenerateSpriteVerticesScalar(stream, transform, vertices, i, count);
+}
+
+const char* GetSpriteVertexPath()
+{
+    return DGEX_SIMD_NAME;
+}
+
+DGEX_END
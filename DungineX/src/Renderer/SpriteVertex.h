@@ -0,0 +1,95 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : SpriteVertex.h                            *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Generate sprite quads in bulk with SIMD.                                   *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/RenderCommandImpl.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Sprites of one texture in structure-of-arrays layout.
+ *
+ * Only what differs between sprites is stored, one array per field, so
+ * that vertices can be generated for several sprites at once. Rotation is
+ * stored as cosine and sine, as trigonometry does not vectorize well.
+ */
+struct SpriteStream
+{
+    std::vector<float> X; // top-left on the screen, before scaling
+    std::vector<float> Y;
+    std::vector<float> Width; // size of the region, before scaling
+    std::vector<float> Height;
+    std::vector<float> Scale;
+    std::vector<float> Cos;
+    std::vector<float> Sin;
+    std::vector<float> AnchorX; // pivot in region pixels, center by default
+    std::vector<float> AnchorY;
+    std::vector<float> U0; // texture coordinates of the top-left corner, flipped
+    std::vector<float> V0;
+    std::vector<float> U1; // texture coordinates of the bottom-right corner, flipped
+    std::vector<float> V1;
+    std::vector<float> Alpha;
+
+    /**
+     * @brief Append a sprite, ignoring its transform.
+     *
+     * @param command Texture command.
+     * @param textureWidth Width of the texture, to locate the region.
+     * @param textureHeight Height of the texture, to locate the region.
+     */
+    void Push(const TextureRenderCommand& command, float textureWidth, float textureHeight);
+
+    void Clear();
+
+    size_t Size() const;
+};
+
+/**
+ * @brief Generate quads of sprites into a vertex stream.
+ *
+ * Does the same math as GetTextureQuad, i.e. scale about the center,
+ * rotate about the anchor, flip and transform, for several sprites at
+ * once with the best instruction set chosen at build time, see Simd.h.
+ *
+ * @param stream Sprites to generate.
+ * @param transform Transform shared by all sprites, nullptr for identity.
+ * @param vertices Four vertices per sprite, clockwise from the top-left.
+ */
+void GenerateSpriteVertices(const SpriteStream& stream, const Transform* transform, SDL_Vertex* vertices);
+
+/**
+ * @brief Generate quads of sprites one by one, without SIMD.
+ *
+ * Reference of GenerateSpriteVertices, also used for the remainder.
+ *
+ * @param first Index of the first sprite to generate.
+ * @param last Index past the last sprite to generate.
+ */
+void GenerateSpriteVerticesScalar(const SpriteStream& stream, const Transform* transform, SDL_Vertex* vertices,
+                                  size_t first, size_t last);
+
+/**
+ * @brief Get the name of the instruction set used.
+ */
+const char* GetSpriteVertexPath();
+
+DGEX_END
@@ -0,0 +1,256 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : StaticSpriteWorld.cpp                     *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Spatial index of static sprites, drawing only the visible ones.            *
+ ******************************************************************************/
+
+#include "Renderer/StaticSpriteWorldImpl.h"
+
+#include "Renderer/RenderApiImpl.h"
+
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Utils/Assert.h"
+
+#include <algorithm>
+#include <cmath>
+
+DGEX_BEGIN
+
+StaticSpriteWorldImpl::StaticSpriteWorldImpl(int cellSize, bool groupByTexture)
+    : _cellSize(static_cast<float>(cellSize)), _groupByTexture(groupByTexture), _spriteCount(0), _stamp(0)
+{
+    DGEX_ASSERT(cellSize > 0, "Cell size must be positive");
+}
+
+uint32_t StaticSpriteWorldImpl::Add(const StaticSpriteDesc& desc)
+{
+    DGEX_ASSERT(desc.Texture, "Static sprite without texture");
+
+    TextureHandle texture = desc.Texture->GetHandle();
+    _textures.emplace(texture.Index, desc.Texture);
+
+    // Prepare the quad once, it never changes.
+    TextureRenderCommand command{ { RenderCommandType::Texture, desc.Z },
+                                  texture,
+                                  { 0.0f, 0.0f },
+                                  static_cast<float>(desc.X),
+                                  static_cast<float>(desc.Y),
+                                  desc.Scale,
+                                  desc.Degree,
+                                  desc.Alpha,
+                                  false,
+                                  false,
+                                  true,
+                                  { static_cast<float>(desc.Source.X), static_cast<float>(desc.Source.Y),
+                                    static_cast<float>(desc.Source.Width), static_cast<float>(desc.Source.Height) } };
+    SDL_FRect bounds;
+    GetRenderCommandBounds(command, bounds);
+    _builder.Add(command);
+
+    uint32_t id;
+    if (_freeIds.empty())
+    {
+        id = static_cast<uint32_t>(_sprites.size());
+        _sprites.push_back({});
+        _spriteVertices.resize(_spriteVertices.size() + 4);
+    }
+    else
+    {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+    }
+
+    _sprites[id] = { texture, bounds, desc.Z, _stamp, true };
+    std::copy(_builder.GetVertices().begin(), _builder.GetVertices().end(), _spriteVertices.begin() + id * 4);
+    _builder.Clear();
+
+    CellRange range = GetCellRange(bounds);
+    for (int y = range.MinY; y <= range.MaxY; y++)
+    {
+        for (int x = range.MinX; x <= range.MaxX; x++)
+        {
+            _cells[GetCellKey(x, y)].push_back(id);
+        }
+    }
+
+    _spriteCount++;
+
+    return id;
+}
+
+void StaticSpriteWorldImpl::Remove(uint32_t id)
+{
+    DGEX_ASSERT((id < _sprites.size()) && _sprites[id].Alive, "Static sprite does not exist");
+
+    Sprite& sprite = _sprites[id];
+    CellRange range = GetCellRange(sprite.Bounds);
+    for (int y = range.MinY; y <= range.MaxY; y++)
+    {
+        for (int x = range.MinX; x <= range.MaxX; x++)
+        {
+            std::vector<uint32_t>& cell = _cells[GetCellKey(x, y)];
+            cell.erase(std::remove(cell.begin(), cell.end(), id), cell.end());
+        }
+    }
+
+    // Texture is kept until Clear, other sprites may still use it.
+    sprite.Alive = false;
+    _freeIds.push_back(id);
+    _spriteCount--;
+}
+
+void StaticSpriteWorldImpl::Clear()
+{
+    _sprites.clear();
+    _spriteVertices.clear();
+    _freeIds.clear();
+    _cells.clear();
+    _textures.clear();
+    _spriteCount = 0;
+}
+
+void StaticSpriteWorldImpl::Query(const Rect& view, std::vector<uint32_t>& ids)
+{
+    SDL_FRect bounds{ static_cast<float>(view.X), static_cast<float>(view.Y), static_cast<float>(view.Width),
+                      static_cast<float>(view.Height) };
+
+    // A new stamp marks sprites met in this query.
+    if (++_stamp == 0)
+    {
+        for (Sprite& sprite : _sprites)
+        {
+            sprite.Stamp = 0;
+        }
+        _stamp = 1;
+    }
+
+    CellRange range = GetCellRange(bounds);
+    for (int y = range.MinY; y <= range.MaxY; y++)
+    {
+        for (int x = range.MinX; x <= range.MaxX; x++)
+        {
+            auto it = _cells.find(GetCellKey(x, y));
+            if (it == _cells.end())
+            {
+                continue;
+            }
+            for (uint32_t id : it->second)
+            {
+                Sprite& sprite = _sprites[id];
+                if (sprite.Stamp == _stamp)
+                {
+                    continue;
+                }
+                sprite.Stamp = _stamp;
+
+                const SDL_FRect& box = sprite.Bounds;
+                if ((box.x < bounds.x + bounds.w) && (box.x + box.w > bounds.x) && (box.y < bounds.y + bounds.h) &&
+                    (box.y + box.h > bounds.y))
+                {
+                    ids.push_back(id);
+                }
+            }
+        }
+    }
+}
+
+void StaticSpriteWorldImpl::Submit(const Rect& view)
+{
+    _visible.clear();
+    _keys.clear();
+    _vertices.clear();
+    _indices.clear();
+    _runs.clear();
+
+    Query(view, _visible);
+
+    // Sort by id first, so that the stable sort below keeps add order.
+    std::sort(_visible.begin(), _visible.end());
+    for (uint32_t id : _visible)
+    {
+        const Sprite& sprite = _sprites[id];
+        TextureRenderCommand key{};
+        key.Type = RenderCommandType::Texture;
+        key.Order = sprite.Z;
+        key.Texture = sprite.Texture;
+        _keys.push_back({ GetRenderSortKey(key, _groupByTexture), id });
+    }
+    _scratch.resize(_keys.size());
+    RadixSort(_keys.data(), _scratch.data(), _keys.size());
+
+    for (const SortKeyEntry& entry : _keys)
+    {
+        const Sprite& sprite = _sprites[entry.Index];
+        if (_runs.empty() || (_runs.back().Texture != sprite.Texture) || (_runs.back().Z != sprite.Z))
+        {
+            _runs.push_back({ sprite.Texture, sprite.Z, _vertices.size(), _indices.size(), 0 });
+        }
+
+        Run& run = _runs.back();
+        int base = static_cast<int>(run.Count * 4);
+        _vertices.insert(_vertices.end(), _spriteVertices.begin() + entry.Index * 4,
+                         _spriteVertices.begin() + entry.Index * 4 + 4);
+        _indices.insert(_indices.end(), { base, base + 1, base + 2, base + 2, base + 3, base });
+        run.Count++;
+    }
+
+    // Vertices no longer move, so we can point to them now.
+    for (const Run& run : _runs)
+    {
+        GeometryRenderCommand command{ { RenderCommandType::Geometry, run.Z },
+                                       run.Texture,
+                                       _vertices.data() + run.FirstVertex,
+                                       _indices.data() + run.FirstIndex,
+                                       static_cast<int>(run.Count * 4),
+                                       static_cast<int>(run.Count * 6),
+                                       run.Count };
+        SubmitRenderCommand(command);
+    }
+}
+
+size_t StaticSpriteWorldImpl::GetSpriteCount() const
+{
+    return _spriteCount;
+}
+
+size_t StaticSpriteWorldImpl::GetVisibleCount() const
+{
+    return _visible.size();
+}
+
+StaticSpriteWorldImpl::CellRange StaticSpriteWorldImpl::GetCellRange(const SDL_FRect& bounds) const
+{
+    // Floor, so that negative coordinates map to the right cells.
+    return { static_cast<int>(std::floor(bounds.x / _cellSize)), static_cast<int>(std::floor(bounds.y / _cellSize)),
+             static_cast<int>(std::floor((bounds.x + bounds.w) / _cellSize)),
+             static_cast<int>(std::floor((bounds.y + bounds.h) / _cellSize)) };
+}
+
+uint64_t StaticSpriteWorldImpl::GetCellKey(int x, int y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<StaticSpriteWorld> CreateStaticSpriteWorld(int cellSize, bool groupByTexture)
+{
+    return CreateRef<StaticSpriteWorldImpl>(cellSize, groupByTexture);
+}
+
+DGEX_END
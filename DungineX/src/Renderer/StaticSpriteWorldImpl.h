@@ -0,0 +1,109 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : StaticSpriteWorldImpl.h                   *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Spatial index of static sprites, drawing only the visible ones.            *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/SpriteBatch.h"
+#include "Utils/RadixSort.h"
+
+#include "DgeX/Renderer/StaticSpriteWorld.h"
+
+#include <unordered_map>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Static sprite world on a uniform grid.
+ *
+ * A sprite is listed in every cell its bounds touch, and a query stamp
+ * on each sprite skips duplicates, so no set is needed.
+ */
+class StaticSpriteWorldImpl final : public StaticSpriteWorld
+{
+public:
+    StaticSpriteWorldImpl(int cellSize, bool groupByTexture);
+    ~StaticSpriteWorldImpl() override = default;
+
+    uint32_t Add(const StaticSpriteDesc& desc) override;
+    void Remove(uint32_t id) override;
+    void Clear() override;
+    void Query(const Rect& view, std::vector<uint32_t>& ids) override;
+    void Submit(const Rect& view) override;
+    size_t GetSpriteCount() const override;
+    size_t GetVisibleCount() const override;
+
+private:
+    struct Sprite
+    {
+        TextureHandle Texture;
+        SDL_FRect Bounds;
+        int Z;
+        uint32_t Stamp; // last query that met the sprite
+        bool Alive;
+    };
+
+    // Range of cells covered by bounds, inclusive.
+    struct CellRange
+    {
+        int MinX, MinY;
+        int MaxX, MaxY;
+    };
+
+    // Sprites of the same texture and z index drawn together.
+    struct Run
+    {
+        TextureHandle Texture;
+        int Z;
+        size_t FirstVertex;
+        size_t FirstIndex;
+        uint32_t Count;
+    };
+
+    CellRange GetCellRange(const SDL_FRect& bounds) const;
+    static uint64_t GetCellKey(int x, int y);
+
+
+private:
+    float _cellSize;
+    bool _groupByTexture;
+
+    std::vector<Sprite> _sprites;
+    std::vector<SDL_Vertex> _spriteVertices; // 4 per sprite, prepared on Add
+    std::vector<uint32_t> _freeIds;
+    size_t _spriteCount;
+
+    std::unordered_map<uint64_t, std::vector<uint32_t>> _cells;
+    uint32_t _stamp;
+
+    // Keep textures alive as long as they are in the world.
+    std::unordered_map<uint32_t, Ref<Texture>> _textures; // by handle index
+
+    SpriteBatch _builder; // to prepare vertices the same way as sprites
+
+    // Per Submit, kept until the next one.
+    std::vector<uint32_t> _visible;
+    std::vector<SortKeyEntry> _keys;
+    std::vector<SortKeyEntry> _scratch;
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices; // relative to the first vertex of each run
+    std::vector<Run> _runs;
+};
+
+DGEX_END
@@ -9,7 +9,7 @@
  *                                                                            *
  *                     Start Date : June 2, 2025                              *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
@@ -19,62 +19,90 @@
 
 #include "DgeX/Renderer/Texture.h"
 
-#include "DgeX/Device/Graphics/Renderer.h"
-#include "DgeX/Utils/Log.h"
+#include "Renderer/TextureCacheImpl.h"
+#include "Renderer/TextureRegistry.h"
 
-#include <SDL3_image/SDL_image.h>
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Utils/Assert.h"
 
 DGEX_BEGIN
 
-Texture::Texture(SDL_Texture* texture) : _texture(texture)
+Texture::Texture(SDL_Texture* texture, const std::string& source)
+    : _handle(GetTextureRegistry().Register(texture, source)), _width(0), _height(0), _format(SDL_PIXELFORMAT_UNKNOWN)
+{
+    TextureInfo info;
+    if (GetTextureRegistry().Resolve(_handle, info))
+    {
+        _width = static_cast<int>(info.Width);
+        _height = static_cast<int>(info.Height);
+        _format = info.Format;
+    }
+}
+
+Texture::~Texture()
 {
+    Destroy();
 }
 
 int Texture::GetWidth() const
 {
-    SDL_PropertiesID props = SDL_GetTextureProperties(_texture);
-    return static_cast<int>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
+    return _width;
 }
 
 int Texture::GetHeight() const
 {
-    SDL_PropertiesID props = SDL_GetTextureProperties(_texture);
-    return static_cast<int>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
+    return _height;
+}
+
+SDL_PixelFormat Texture::GetFormat() const
+{
+    return _format;
+}
+
+bool Texture::IsResident() const
+{
+    return GetTextureRegistry().IsResident(_handle);
+}
+
+size_t Texture::GetMemorySize() const
+{
+    return TextureRegistry::EstimateBytes(static_cast<float>(_width), static_cast<float>(_height), _format);
+}
+
+int Texture::GetVariantCount() const
+{
+    return GetTextureRegistry().GetVariantCount(_handle);
+}
+
+TextureHandle Texture::GetHandle() const
+{
+    return _handle;
 }
 
 SDL_Texture* Texture::GetNativeTexture() const
 {
-    return _texture;
+    // May be evicted and reloaded since, so never cache it.
+    TextureInfo info;
+    return GetTextureRegistry().Resolve(_handle, info) ? info.Native : nullptr;
 }
 
 void Texture::Destroy()
 {
-    if (_texture)
-    {
-        SDL_DestroyTexture(_texture);
-        _texture = nullptr;
-    }
+    // Queued commands may still refer to it, so only release it here.
+    GetTextureRegistry().Release(_handle);
+    _handle = {};
 }
 
 Ref<Texture> LoadTexture(const std::string& path)
 {
-    SDL_Surface* surface = IMG_Load(path.c_str());
-    if (!surface)
-    {
-        DGEX_CORE_ERROR("Failed to load texture: {0}, {1}", path, SDL_GetError());
-        return nullptr;
-    }
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(GetNativeRenderer(), surface);
-    SDL_DestroySurface(surface);
-
-    DGEX_CORE_INFO("Loaded texture: {0}", path);
-
-    return CreateRef<Texture>(texture);
+    return GetTextureCache().Load(path);
 }
 
 // Reference: https://wiki.libsdl.org/SDL3/SDL_CreateTexture
 Ref<Texture> CreateTexture(int width, int height)
 {
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be created on the render thread");
+
     SDL_Texture* texture =
         SDL_CreateTexture(GetNativeRenderer(), SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_TARGET, width, height);
     return CreateRef<Texture>(texture);
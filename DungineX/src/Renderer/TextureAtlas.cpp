@@ -0,0 +1,191 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureAtlas.cpp                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Runtime texture atlas that packs images into large pages.                  *
+ ******************************************************************************/
+
+#include "Renderer/TextureAtlasImpl.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+#include "Renderer/TextureCacheImpl.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Renderer/Color.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Log.h"
+
+DGEX_BEGIN
+
+TextureAtlasImpl::TextureAtlasImpl(int pageWidth, int pageHeight, int padding)
+    : _pageWidth(pageWidth), _pageHeight(pageHeight), _padding(padding)
+{
+    DGEX_ASSERT((pageWidth > 0) && (pageHeight > 0), "Atlas page size must be positive");
+    DGEX_ASSERT(padding >= 0, "Atlas padding must not be negative");
+}
+
+SubTexture TextureAtlasImpl::Add(const Ref<Texture>& texture)
+{
+    DGEX_ASSERT(IsRenderThread(), "Texture atlas can only be packed on the render thread");
+
+    if (!texture || !texture->GetNativeTexture())
+    {
+        return {};
+    }
+
+    int width = texture->GetWidth();
+    int height = texture->GetHeight();
+    if ((width > _pageWidth) || (height > _pageHeight))
+    {
+        DGEX_CORE_ERROR("Image of {0}x{1} does not fit in atlas page of {2}x{3}", width, height, _pageWidth,
+                        _pageHeight);
+        return {};
+    }
+
+    // Padding is on the right and bottom, and not needed at the page edge.
+    int paddedWidth = width + _padding < _pageWidth ? width + _padding : _pageWidth;
+    int paddedHeight = height + _padding < _pageHeight ? height + _padding : _pageHeight;
+
+    Rect place;
+    Page* target = nullptr;
+    for (Page& page : _pages)
+    {
+        if (page.Packer.Insert(paddedWidth, paddedHeight, place))
+        {
+            target = &page;
+            break;
+        }
+    }
+    if (!target)
+    {
+        if (!AddPage())
+        {
+            return {};
+        }
+        target = &_pages.back();
+        target->Packer.Insert(paddedWidth, paddedHeight, place);
+    }
+
+    Rect region(place.X, place.Y, width, height);
+    Copy(texture, target->Texture, region);
+
+    return { target->Texture, region };
+}
+
+SubTexture TextureAtlasImpl::Add(const std::string& path)
+{
+    // Not shared, since it is destroyed right after.
+    Ref<Texture> texture = LoadTextureFromFile(path);
+    if (!texture)
+    {
+        return {};
+    }
+
+    SubTexture region = Add(texture);
+    texture->Destroy(); // only the copy in the page is needed
+
+    return region;
+}
+
+int TextureAtlasImpl::GetPageCount() const
+{
+    return static_cast<int>(_pages.size());
+}
+
+const Ref<Texture>& TextureAtlasImpl::GetPage(int index) const
+{
+    DGEX_ASSERT((index >= 0) && (index < GetPageCount()), "Atlas page index out of range");
+
+    return _pages[index].Texture;
+}
+
+TextureAtlasPageStatistics TextureAtlasImpl::GetPageStatistics(int index) const
+{
+    DGEX_ASSERT((index >= 0) && (index < GetPageCount()), "Atlas page index out of range");
+
+    const RectPacker& packer = _pages[index].Packer;
+    return { packer.GetWidth(), packer.GetHeight(), packer.GetRectCount(), packer.GetUsedArea(),
+             packer.GetOccupancy() };
+}
+
+float TextureAtlasImpl::GetOccupancy() const
+{
+    if (_pages.empty())
+    {
+        return 0.0f;
+    }
+
+    int64_t used = 0;
+    for (const Page& page : _pages)
+    {
+        used += page.Packer.GetUsedArea();
+    }
+    double area = static_cast<double>(_pageWidth) * _pageHeight * static_cast<double>(_pages.size());
+    return static_cast<float>(static_cast<double>(used) / area);
+}
+
+bool TextureAtlasImpl::AddPage()
+{
+    Ref<Texture> texture = CreateTexture(_pageWidth, _pageHeight);
+    if (!texture || !texture->GetNativeTexture())
+    {
+        DGEX_CORE_ERROR("Failed to create atlas page of {0}x{1}: {2}", _pageWidth, _pageHeight, SDL_GetError());
+        return false;
+    }
+
+    // Start from transparent, so that padding stays empty.
+    {
+        USE_RENDER_TARGET(texture);
+        GetRenderStateCache().SetDrawColor(0, 0, 0, 0);
+        SDL_RenderClear(GetNativeRenderer());
+    }
+
+    _pages.push_back({ texture, RectPacker(_pageWidth, _pageHeight) });
+
+    DGEX_CORE_DEBUG("Atlas page {0} of {1}x{2} created", _pages.size() - 1, _pageWidth, _pageHeight);
+
+    return true;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_RenderTexture
+void TextureAtlasImpl::Copy(const Ref<Texture>& source, const Ref<Texture>& page, const Rect& region)
+{
+    USE_RENDER_TARGET(page);
+
+    // Replace instead of blend, so that alpha is kept as is.
+    SDL_Texture* native = source->GetNativeTexture();
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(native, &blendMode);
+    SDL_SetTextureBlendMode(native, SDL_BLENDMODE_NONE);
+    GetRenderStateCache().SetTextureAlphaMod(native, DGEX_COLOR_OPAQUE);
+
+    SDL_FRect dest{ static_cast<float>(region.X), static_cast<float>(region.Y), static_cast<float>(region.Width),
+                    static_cast<float>(region.Height) };
+    SDL_RenderTexture(GetNativeRenderer(), native, nullptr, &dest);
+
+    SDL_SetTextureBlendMode(native, blendMode);
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<TextureAtlas> CreateTextureAtlas(int pageWidth, int pageHeight, int padding)
+{
+    return CreateRef<TextureAtlasImpl>(pageWidth, pageHeight, padding);
+}
+
+DGEX_END
@@ -0,0 +1,75 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureAtlasImpl.h                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Runtime texture atlas that packs images into large pages.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "Renderer/RectPacker.h"
+
+#include "DgeX/Renderer/TextureAtlas.h"
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Texture atlas with a MaxRects packer per page.
+ *
+ * Images are copied to their page on the GPU, so nothing is read back.
+ */
+class TextureAtlasImpl final : public TextureAtlas
+{
+public:
+    TextureAtlasImpl(int pageWidth, int pageHeight, int padding);
+    ~TextureAtlasImpl() override = default;
+
+    SubTexture Add(const Ref<Texture>& texture) override;
+    SubTexture Add(const std::string& path) override;
+    int GetPageCount() const override;
+    const Ref<Texture>& GetPage(int index) const override;
+    TextureAtlasPageStatistics GetPageStatistics(int index) const override;
+    float GetOccupancy() const override;
+
+private:
+    struct Page
+    {
+        Ref<DgeX::Texture> Texture;
+        RectPacker Packer;
+    };
+
+    /**
+     * @brief Create a new transparent page.
+     *
+     * @return Whether the page is created.
+     */
+    bool AddPage();
+
+    /**
+     * @brief Copy a texture into a page as is, alpha included.
+     */
+    static void Copy(const Ref<Texture>& source, const Ref<Texture>& page, const Rect& region);
+
+private:
+    int _pageWidth;
+    int _pageHeight;
+    int _padding;
+
+    std::vector<Page> _pages;
+};
+
+DGEX_END
@@ -0,0 +1,330 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureCache.cpp                          *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Share textures loaded from the same file.                                  *
+ ******************************************************************************/
+
+#include "Renderer/TextureCacheImpl.h"
+
+#include "Renderer/TextureFileImpl.h"
+#include "Renderer/TextureRegistry.h"
+#include "Renderer/TextureVariantImpl.h"
+#include "Utils/MappedFile.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Log.h"
+#include "DgeX/Utils/Strings.h"
+
+#include <SDL3_image/SDL_image.h>
+
+#include <filesystem>
+
+DGEX_BEGIN
+
+// FNV-1a, as for render commands, collisions are unlikely for images.
+static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+static constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+
+static uint64_t HashContent(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash != 0 ? hash : 1; // 0 is for not hashed
+}
+
+TextureCache::TextureCache() : _contentHashing(false), _hits(0), _misses(0), _contentHits(0), _purged(0)
+{
+    // Construct the registry first, so that it outlives cached textures.
+    GetTextureRegistry();
+}
+
+Ref<Texture> TextureCache::Load(const std::string& path)
+{
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be loaded on the render thread, see LoadTextureAsync");
+
+    std::string key = GetKey(path);
+
+    // Held while loading, so that the same file is never loaded twice.
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (Ref<Texture> texture = FindEntry(key))
+    {
+        _hits++;
+        return texture;
+    }
+    _misses++;
+
+    if (_contentHashing)
+    {
+        return LoadHashed(key, path);
+    }
+
+    Ref<Texture> texture = LoadTextureFromFile(path);
+    if (texture)
+    {
+        _entries.emplace(key, Entry{ texture, 0 });
+    }
+    return texture;
+}
+
+Ref<Texture> TextureCache::Find(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (Ref<Texture> texture = FindEntry(key))
+    {
+        _hits++;
+        return texture;
+    }
+    _misses++;
+    return nullptr;
+}
+
+Ref<Texture> TextureCache::Insert(const std::string& key, const Ref<Texture>& texture)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (Ref<Texture> cached = FindEntry(key))
+    {
+        return cached;
+    }
+    _entries.emplace(key, Entry{ texture, 0 });
+    return texture;
+}
+
+size_t TextureCache::Purge()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::unordered_map<const Texture*, long> counts = CountEntries();
+    size_t removed = 0;
+    for (auto it = _entries.begin(); it != _entries.end();)
+    {
+        const Ref<Texture>& texture = it->second.Texture;
+        if (texture.use_count() > counts[texture.get()])
+        {
+            ++it;
+            continue;
+        }
+        if (it->second.Hash != 0)
+        {
+            _contents.erase(it->second.Hash);
+        }
+        it = _entries.erase(it);
+        removed++;
+    }
+    _purged += removed;
+
+    if (removed > 0)
+    {
+        DGEX_CORE_DEBUG("Purged {0} cached textures", removed);
+    }
+
+    return removed;
+}
+
+void TextureCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _entries.clear();
+    _contents.clear();
+}
+
+void TextureCache::SetContentHashing(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _contentHashing = enabled;
+}
+
+bool TextureCache::IsContentHashing() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _contentHashing;
+}
+
+TextureCacheStatistics TextureCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::unordered_map<const Texture*, long> counts = CountEntries();
+    size_t unreferenced = 0;
+    for (const auto& [key, entry] : _entries)
+    {
+        if (entry.Texture.use_count() <= counts[entry.Texture.get()])
+        {
+            unreferenced++;
+        }
+    }
+
+    return { _entries.size(), unreferenced, _hits, _misses, _contentHits, _purged };
+}
+
+std::string TextureCache::GetKey(const std::string& path)
+{
+    std::error_code error;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+    if (error)
+    {
+        canonical = std::filesystem::path(path).lexically_normal();
+    }
+    return canonical.generic_string();
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_LoadFile
+Ref<Texture> TextureCache::LoadHashed(const std::string& key, const std::string& path)
+{
+    size_t size = 0;
+    void* data = SDL_LoadFile(path.c_str(), &size);
+    if (!data)
+    {
+        DGEX_CORE_ERROR("Failed to load texture: {0}, {1}", path, SDL_GetError());
+        return nullptr;
+    }
+
+    uint64_t hash = HashContent(data, size);
+    if (auto it = _contents.find(hash); it != _contents.end())
+    {
+        if (Ref<Texture> texture = it->second.lock(); texture && texture->GetHandle().IsValid())
+        {
+            SDL_free(data);
+            _contentHits++;
+            _entries.emplace(key, Entry{ texture, 0 }); // the first entry owns the hash
+            DGEX_CORE_DEBUG("Texture {0} has the same content as a cached one", path);
+            return texture;
+        }
+    }
+
+    Ref<Texture> texture = LoadTextureFromFile(path, data, size);
+    SDL_free(data);
+    if (texture)
+    {
+        _entries.emplace(key, Entry{ texture, hash });
+        _contents[hash] = texture;
+    }
+    return texture;
+}
+
+Ref<Texture> TextureCache::FindEntry(const std::string& key)
+{
+    auto it = _entries.find(key);
+    if (it == _entries.end())
+    {
+        return nullptr;
+    }
+    if (it->second.Texture->GetHandle().IsValid())
+    {
+        return it->second.Texture;
+    }
+
+    DGEX_CORE_DEBUG("Cached texture {0} was destroyed, reloading", key);
+    if (it->second.Hash != 0)
+    {
+        _contents.erase(it->second.Hash);
+    }
+    _entries.erase(it);
+    return nullptr;
+}
+
+std::unordered_map<const Texture*, long> TextureCache::CountEntries() const
+{
+    std::unordered_map<const Texture*, long> counts;
+    for (const auto& [key, entry] : _entries)
+    {
+        counts[entry.Texture.get()]++;
+    }
+    return counts;
+}
+
+TextureCache& GetTextureCache()
+{
+    static TextureCache sCache;
+    return sCache;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3_image/IMG_Load_IO
+Ref<Texture> LoadTextureFromFile(const std::string& path, const void* data, size_t size)
+{
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be created on the render thread");
+
+    // Texture files are uploaded straight from the file content.
+    MappedFile file;
+    if (!data && Strings::EndsWith(path, TEXTURE_FILE_EXTENSION) && file.Open(path))
+    {
+        data = file.GetData();
+        size = file.GetSize();
+    }
+
+    bool premultiplied = false;
+    SDL_Surface* surface;
+    if (IsTextureFile(data, size))
+    {
+        surface = DecodeTextureFile(data, size, false, premultiplied);
+    }
+    else
+    {
+        surface = data ? IMG_Load_IO(SDL_IOFromConstMem(data, size), true) : IMG_Load(path.c_str());
+    }
+    if (!surface)
+    {
+        DGEX_CORE_ERROR("Failed to load texture: {0}, {1}", path, SDL_GetError());
+        return nullptr;
+    }
+    SDL_Texture* native = CreateTextureFromImage(surface, premultiplied);
+    Ref<Texture> texture = CreateRef<Texture>(native, path);
+    if (native)
+    {
+        std::vector<SDL_Surface*> variants;
+        CreateTextureVariantSurfaces(surface, variants);
+        AttachTextureVariants(texture->GetHandle(), variants, premultiplied);
+    }
+    SDL_DestroySurface(surface);
+
+    DGEX_CORE_INFO("Loaded texture: {0}", path);
+
+    return texture;
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+size_t PurgeTextureCache()
+{
+    return GetTextureCache().Purge();
+}
+
+void SetTextureContentHashing(bool enabled)
+{
+    GetTextureCache().SetContentHashing(enabled);
+}
+
+bool IsTextureContentHashing()
+{
+    return GetTextureCache().IsContentHashing();
+}
+
+TextureCacheStatistics GetTextureCacheStatistics()
+{
+    return GetTextureCache().GetStatistics();
+}
+
+DGEX_END
@@ -0,0 +1,150 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureCacheImpl.h                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Share textures loaded from the same file.                                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/Texture.h"
+#include "DgeX/Renderer/TextureCache.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+DGEX_BEGIN
+
+/**
+ * @brief Textures by canonical path, so that each file is decoded once.
+ *
+ * The cache holds a reference to each texture, the count of other
+ * references tells whether it is still used. Textures are only dropped
+ * by Purge, or Clear before the renderer is gone, or once found destroyed
+ * by a holder, so that the file is loaded again.
+ */
+class TextureCache
+{
+public:
+    TextureCache();
+    TextureCache(const TextureCache& other) = delete;
+    TextureCache(TextureCache&& other) noexcept = delete;
+    TextureCache& operator=(const TextureCache& other) = delete;
+    TextureCache& operator=(TextureCache&& other) noexcept = delete;
+
+    ~TextureCache() = default;
+
+    /**
+     * @brief Get the texture of a file, loading it on miss.
+     *
+     * @return The shared texture, nullptr on failure.
+     */
+    Ref<Texture> Load(const std::string& path);
+
+    /**
+     * @brief Look up a texture without loading, counted as hit or miss.
+     *
+     * @param key Canonical path, see GetKey.
+     */
+    Ref<Texture> Find(const std::string& key);
+
+    /**
+     * @brief Add a texture loaded elsewhere, e.g. in the background.
+     *
+     * An existing entry is kept, so textures handed out stay shared.
+     *
+     * @return The cached texture.
+     */
+    Ref<Texture> Insert(const std::string& key, const Ref<Texture>& texture);
+
+    /**
+     * @brief Remove entries whose texture is only held by the cache.
+     *
+     * @return Number of entries removed.
+     */
+    size_t Purge();
+
+    /**
+     * @brief Remove all entries, referenced or not.
+     */
+    void Clear();
+
+    void SetContentHashing(bool enabled);
+    bool IsContentHashing() const;
+
+    TextureCacheStatistics GetStatistics() const;
+
+    /**
+     * @brief Get the cache key of a path.
+     *
+     * Resolves relative parts and links where the file exists, so that
+     * different spellings of a path share an entry.
+     */
+    static std::string GetKey(const std::string& path);
+
+private:
+    struct Entry
+    {
+        Ref<DgeX::Texture> Texture; // qualified, since the member hides the type
+        uint64_t Hash; // of the content, 0 if not hashed
+    };
+
+    Ref<Texture> LoadHashed(const std::string& key, const std::string& path);
+
+    /**
+     * @brief Get the texture of an entry, dropping the entry if destroyed.
+     *
+     * @return The texture, nullptr if none or destroyed.
+     */
+    Ref<Texture> FindEntry(const std::string& key);
+
+    /**
+     * @brief Count entries per texture, several paths may share one.
+     */
+    std::unordered_map<const Texture*, long> CountEntries() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    std::unordered_map<uint64_t, std::weak_ptr<Texture>> _contents;
+    bool _contentHashing;
+
+    uint64_t _hits;
+    uint64_t _misses;
+    uint64_t _contentHits;
+    uint64_t _purged;
+};
+
+/**
+ * @brief Get the texture cache.
+ */
+TextureCache& GetTextureCache();
+
+/**
+ * @brief Load a texture from a file, bypassing the cache.
+ *
+ * For textures that are not shared, e.g. copied into an atlas and
+ * destroyed right away.
+ *
+ * @param path Path to the image, kept as the source to reload from.
+ * @param data Content of the file if already read, or nullptr.
+ * @param size Size of the content.
+ * @return Loaded texture, nullptr on failure.
+ */
+Ref<Texture> LoadTextureFromFile(const std::string& path, const void* data = nullptr, size_t size = 0);
+
+DGEX_END
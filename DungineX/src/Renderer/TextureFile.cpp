@@ -0,0 +1,283 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureFile.cpp                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Engine texture files that load without decoding.                           *
+ ******************************************************************************/
+
+#include "Renderer/TextureFileImpl.h"
+
+#include "Utils/MappedFile.h"
+#include "Utils/Qoi.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Utils/Log.h"
+#include "DgeX/Utils/Strings.h"
+
+#include <SDL3_image/SDL_image.h>
+
+#include <cstring>
+
+DGEX_BEGIN
+
+static constexpr char TEXTURE_FILE_MAGIC[4] = { 'D', 'T', 'E', 'X' };
+static constexpr int TEXTURE_FILE_BYTES_PER_PIXEL = 4;
+
+static bool ReadHeader(const void* data, size_t size, TextureFileHeader& header)
+{
+    if (!data || (size < sizeof(TextureFileHeader)))
+    {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(TextureFileHeader));
+    return std::memcmp(header.Magic, TEXTURE_FILE_MAGIC, sizeof(TEXTURE_FILE_MAGIC)) == 0;
+}
+
+bool IsTextureFile(const void* data, size_t size)
+{
+    TextureFileHeader header;
+    return ReadHeader(data, size, header);
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_CreateSurfaceFrom
+SDL_Surface* DecodeTextureFile(const void* data, size_t size, bool copy, bool& premultiplied)
+{
+    TextureFileHeader header;
+    if (!ReadHeader(data, size, header))
+    {
+        return nullptr;
+    }
+
+    auto format = static_cast<SDL_PixelFormat>(header.Format);
+    uint64_t rowSize = static_cast<uint64_t>(header.Width) * TEXTURE_FILE_BYTES_PER_PIXEL;
+    if ((header.Version != TEXTURE_FILE_VERSION) || (header.Width == 0) || (header.Height == 0) ||
+        (SDL_BYTESPERPIXEL(format) != TEXTURE_FILE_BYTES_PER_PIXEL) || (header.Pitch < rowSize) ||
+        (header.PayloadSize > size - sizeof(TextureFileHeader)))
+    {
+        DGEX_CORE_ERROR("Invalid texture file header");
+        return nullptr;
+    }
+
+    premultiplied = (header.Flags & TEXTURE_FILE_PREMULTIPLIED) != 0;
+    const auto* payload = static_cast<const uint8_t*>(data) + sizeof(TextureFileHeader);
+    auto width = static_cast<int>(header.Width);
+    auto height = static_cast<int>(header.Height);
+
+    if (header.Compression == static_cast<uint8_t>(TextureCompression::None))
+    {
+        if (header.PayloadSize < static_cast<uint64_t>(header.Pitch) * header.Height)
+        {
+            DGEX_CORE_ERROR("Texture file is truncated");
+            return nullptr;
+        }
+
+        // SDL never writes to it, it is only read when uploading.
+        SDL_Surface* surface = SDL_CreateSurfaceFrom(width, height, format, const_cast<uint8_t*>(payload),
+                                                     static_cast<int>(header.Pitch));
+        if (surface && copy)
+        {
+            SDL_Surface* owned = SDL_DuplicateSurface(surface);
+            SDL_DestroySurface(surface);
+            surface = owned;
+        }
+        return surface;
+    }
+
+    if (header.Compression == static_cast<uint8_t>(TextureCompression::Qoi))
+    {
+        SDL_Surface* surface = SDL_CreateSurface(width, height, format);
+        if (!surface)
+        {
+            return nullptr;
+        }
+
+        // Rows of the surface may be padded, decode them one image anyway.
+        size_t count = static_cast<size_t>(width) * height;
+        auto* pixels = static_cast<uint8_t*>(surface->pixels);
+        bool decoded;
+        if (static_cast<uint64_t>(surface->pitch) == rowSize)
+        {
+            decoded = QoiDecode(payload, header.PayloadSize, pixels, count);
+        }
+        else
+        {
+            std::vector<uint8_t> buffer(count * TEXTURE_FILE_BYTES_PER_PIXEL);
+            decoded = QoiDecode(payload, header.PayloadSize, buffer.data(), count);
+            for (int y = 0; decoded && (y < height); y++)
+            {
+                std::memcpy(pixels + static_cast<size_t>(y) * surface->pitch, buffer.data() + y * rowSize, rowSize);
+            }
+        }
+        if (!decoded)
+        {
+            DGEX_CORE_ERROR("Texture file is truncated");
+            SDL_DestroySurface(surface);
+            return nullptr;
+        }
+        return surface;
+    }
+
+    DGEX_CORE_ERROR("Unknown texture file compression: {0}", header.Compression);
+    return nullptr;
+}
+
+bool EncodeTextureFile(SDL_Surface* surface, TextureCompression compression, bool premultiplied,
+                       std::vector<uint8_t>& output)
+{
+    if (SDL_BYTESPERPIXEL(surface->format) != TEXTURE_FILE_BYTES_PER_PIXEL)
+    {
+        return false;
+    }
+
+    size_t rowSize = static_cast<size_t>(surface->w) * TEXTURE_FILE_BYTES_PER_PIXEL;
+    const auto* pixels = static_cast<const uint8_t*>(surface->pixels);
+
+    // Rows are stored tightly packed.
+    std::vector<uint8_t> packed;
+    if (static_cast<size_t>(surface->pitch) != rowSize)
+    {
+        packed.resize(rowSize * surface->h);
+        for (int y = 0; y < surface->h; y++)
+        {
+            std::memcpy(packed.data() + y * rowSize, pixels + static_cast<size_t>(y) * surface->pitch, rowSize);
+        }
+        pixels = packed.data();
+    }
+
+    output.resize(sizeof(TextureFileHeader));
+    size_t imageSize = rowSize * surface->h;
+    if (compression == TextureCompression::Qoi)
+    {
+        QoiEncode(pixels, static_cast<size_t>(surface->w) * surface->h, output);
+    }
+    else
+    {
+        output.insert(output.end(), pixels, pixels + imageSize);
+    }
+
+    TextureFileHeader header{};
+    std::memcpy(header.Magic, TEXTURE_FILE_MAGIC, sizeof(TEXTURE_FILE_MAGIC));
+    header.Version = TEXTURE_FILE_VERSION;
+    header.Compression = static_cast<uint8_t>(compression);
+    header.Flags = premultiplied ? TEXTURE_FILE_PREMULTIPLIED : 0;
+    header.Width = static_cast<uint32_t>(surface->w);
+    header.Height = static_cast<uint32_t>(surface->h);
+    header.Format = static_cast<uint32_t>(surface->format);
+    header.Pitch = static_cast<uint32_t>(rowSize);
+    header.PayloadSize = output.size() - sizeof(TextureFileHeader);
+    std::memcpy(output.data(), &header, sizeof(TextureFileHeader));
+
+    return true;
+}
+
+SDL_Surface* LoadImageSurface(const std::string& path, bool& premultiplied)
+{
+    premultiplied = false;
+    if (!Strings::EndsWith(path, TEXTURE_FILE_EXTENSION))
+    {
+        return IMG_Load(path.c_str());
+    }
+
+    MappedFile file;
+    if (!file.Open(path))
+    {
+        SDL_SetError("Failed to map %s", path.c_str());
+        return nullptr;
+    }
+    return DecodeTextureFile(file.GetData(), file.GetSize(), true, premultiplied);
+}
+
+SDL_Texture* CreateTextureFromImage(SDL_Surface* surface, bool premultiplied)
+{
+    // Formats the renderer supports are uploaded without conversion.
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(GetNativeRenderer(), surface);
+    if (texture && premultiplied)
+    {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    }
+    return texture;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER
+static SDL_PixelFormat GetPreferredFormat()
+{
+    if (IsRenderThread())
+    {
+        SDL_PropertiesID props = SDL_GetRendererProperties(GetNativeRenderer());
+        const auto* formats = static_cast<const SDL_PixelFormat*>(
+            SDL_GetPointerProperty(props, SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+        for (; formats && (*formats != SDL_PIXELFORMAT_UNKNOWN); formats++)
+        {
+            if (!SDL_ISPIXELFORMAT_FOURCC(*formats) &&
+                (SDL_BYTESPERPIXEL(*formats) == TEXTURE_FILE_BYTES_PER_PIXEL) && SDL_ISPIXELFORMAT_ALPHA(*formats))
+            {
+                return *formats;
+            }
+        }
+    }
+    return SDL_PIXELFORMAT_ARGB8888;
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_PremultiplySurfaceAlpha
+dgex_error_t ConvertTexture(const std::string& source, const std::string& destination,
+                            const TextureConvertOptions& options)
+{
+    SDL_Surface* image = IMG_Load(source.c_str());
+    if (!image)
+    {
+        DGEX_CORE_ERROR("Failed to load image: {0}, {1}", source, SDL_GetError());
+        return DGEX_ERROR_RESOURCE_LOAD;
+    }
+
+    SDL_PixelFormat format = options.Format != SDL_PIXELFORMAT_UNKNOWN ? options.Format : GetPreferredFormat();
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || (SDL_BYTESPERPIXEL(format) != TEXTURE_FILE_BYTES_PER_PIXEL))
+    {
+        DGEX_CORE_ERROR("Texture files only support 32-bit formats, got {0}", SDL_GetPixelFormatName(format));
+        SDL_DestroySurface(image);
+        return DGEX_ERROR_RESOURCE_FORMAT;
+    }
+
+    SDL_Surface* surface = SDL_ConvertSurface(image, format);
+    SDL_DestroySurface(image);
+    if (!surface)
+    {
+        DGEX_CORE_ERROR("Failed to convert image: {0}, {1}", source, SDL_GetError());
+        return DGEX_ERROR_RESOURCE_FORMAT;
+    }
+    if (options.Premultiply)
+    {
+        SDL_PremultiplySurfaceAlpha(surface, false);
+    }
+
+    std::vector<uint8_t> content;
+    EncodeTextureFile(surface, options.Compression, options.Premultiply, content);
+    SDL_DestroySurface(surface);
+
+    if (!SDL_SaveFile(destination.c_str(), content.data(), content.size()))
+    {
+        DGEX_CORE_ERROR("Failed to save texture file: {0}, {1}", destination, SDL_GetError());
+        return DGEX_ERROR_RESOURCE_SAVE;
+    }
+
+    DGEX_CORE_INFO("Converted {0} to {1}, {2} bytes", source, destination, content.size());
+
+    return DGEX_SUCCESS;
+}
+
+DGEX_END
@@ -0,0 +1,100 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureFileImpl.h                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Engine texture files that load without decoding.                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/TextureFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+DGEX_BEGIN
+
+constexpr uint16_t TEXTURE_FILE_VERSION = 1;
+constexpr uint8_t TEXTURE_FILE_PREMULTIPLIED = 0x01;
+
+/**
+ * @brief Header of a texture file, followed by the payload.
+ *
+ * Stored as it is in memory, little endian. Pixels right after the
+ * header stay 16 bytes aligned in a mapped file.
+ */
+struct TextureFileHeader
+{
+    char Magic[4]; // DTEX
+    uint16_t Version;
+    uint8_t Compression; // TextureCompression
+    uint8_t Flags;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t Format; // SDL_PixelFormat
+    uint32_t Pitch;  // bytes per row once decoded
+    uint64_t PayloadSize;
+};
+
+static_assert(sizeof(TextureFileHeader) == 32, "Texture file header must be packed");
+
+/**
+ * @brief Check whether the content starts with a texture file header.
+ */
+bool IsTextureFile(const void* data, size_t size);
+
+/**
+ * @brief Decode a texture file into a surface.
+ *
+ * @param data Content of the file.
+ * @param size Size of the content.
+ * @param copy Whether to copy raw pixels, otherwise the surface refers to
+ *             data, which must outlive it.
+ * @param premultiplied Receives whether alpha is premultiplied.
+ * @return The surface, nullptr if the content is invalid.
+ */
+SDL_Surface* DecodeTextureFile(const void* data, size_t size, bool copy, bool& premultiplied);
+
+/**
+ * @brief Encode a 32-bit surface into a texture file.
+ *
+ * @param surface Surface to encode.
+ * @param compression How to store the pixels.
+ * @param premultiplied Whether its alpha is premultiplied.
+ * @param output Receives the content of the file.
+ * @return False if the surface is not 32-bit.
+ */
+bool EncodeTextureFile(SDL_Surface* surface, TextureCompression compression, bool premultiplied,
+                       std::vector<uint8_t>& output);
+
+/**
+ * @brief Load an image into a surface, either a texture file or any
+ *        format of SDL_image. Safe on any thread.
+ *
+ * @param path Path to the image.
+ * @param premultiplied Receives whether alpha is premultiplied.
+ * @return The surface, nullptr on failure.
+ */
+SDL_Surface* LoadImageSurface(const std::string& path, bool& premultiplied);
+
+/**
+ * @brief Upload a surface, with the blend mode its alpha needs.
+ *
+ * @return The texture, nullptr on failure.
+ */
+SDL_Texture* CreateTextureFromImage(SDL_Surface* surface, bool premultiplied);
+
+DGEX_END
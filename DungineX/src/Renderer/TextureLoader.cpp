@@ -0,0 +1,401 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureLoader.cpp                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Load textures in the background.                                           *
+ ******************************************************************************/
+
+#include "Renderer/TextureLoaderImpl.h"
+
+#include "Renderer/TextureCacheImpl.h"
+#include "Renderer/TextureFileImpl.h"
+#include "Renderer/TextureRegistry.h"
+#include "Renderer/TextureVariantImpl.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Utils/Assert.h"
+#include "DgeX/Utils/Log.h"
+
+DGEX_BEGIN
+
+static constexpr float DEFAULT_UPLOAD_BUDGET = 4.0f;
+static constexpr unsigned MAX_WORKER_COUNT = 4;
+
+// ============================================================================
+// Async Texture
+// ----------------------------------------------------------------------------
+
+AsyncTextureImpl::AsyncTextureImpl(const std::string& path, const Ref<Texture>& placeholder)
+    : _path(path), _placeholder(placeholder), _state(LoadState::Pending)
+{
+}
+
+bool AsyncTextureImpl::IsDone() const
+{
+    return _state.load(std::memory_order_acquire) != LoadState::Pending;
+}
+
+bool AsyncTextureImpl::IsLoaded() const
+{
+    return _state.load(std::memory_order_acquire) == LoadState::Loaded;
+}
+
+Ref<Texture> AsyncTextureImpl::GetTexture() const
+{
+    return IsLoaded() ? _texture : _placeholder;
+}
+
+const std::string& AsyncTextureImpl::GetPath() const
+{
+    return _path;
+}
+
+void AsyncTextureImpl::Finish(const Ref<Texture>& texture)
+{
+    DGEX_ASSERT(!IsDone(), "Async texture finished twice");
+
+    _texture = texture;
+    _state.store(texture ? LoadState::Loaded : LoadState::Failed, std::memory_order_release);
+}
+
+AsyncTextureBatchImpl::AsyncTextureBatchImpl(std::vector<Ref<AsyncTexture>> textures)
+    : _textures(std::move(textures))
+{
+}
+
+size_t AsyncTextureBatchImpl::GetCount() const
+{
+    return _textures.size();
+}
+
+const Ref<AsyncTexture>& AsyncTextureBatchImpl::Get(size_t index) const
+{
+    DGEX_ASSERT(index < _textures.size(), "Async texture index out of range");
+
+    return _textures[index];
+}
+
+TextureLoadProgress AsyncTextureBatchImpl::GetProgress() const
+{
+    TextureLoadProgress progress{ static_cast<int>(_textures.size()), 0, 0 };
+    for (const Ref<AsyncTexture>& texture : _textures)
+    {
+        if (texture->IsLoaded())
+        {
+            progress.Loaded++;
+        }
+        else if (texture->IsDone())
+        {
+            progress.Failed++;
+        }
+    }
+    return progress;
+}
+
+// ============================================================================
+// Texture Loader
+// ----------------------------------------------------------------------------
+
+TextureLoader::TextureLoader() : _stopping(false), _pendingCount(0), _budget(DEFAULT_UPLOAD_BUDGET)
+{
+    // Construct the registry first, so that it outlives the placeholder.
+    GetTextureRegistry();
+}
+
+TextureLoader::~TextureLoader()
+{
+    Shutdown();
+}
+
+Ref<AsyncTexture> TextureLoader::Load(const std::string& path)
+{
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be loaded on the render thread");
+
+    if (!_placeholder)
+    {
+        _placeholder = CreatePlaceholder();
+    }
+
+    std::string key = TextureCache::GetKey(path);
+    if (auto it = _loading.find(key); it != _loading.end())
+    {
+        return it->second;
+    }
+
+    auto texture = CreateRef<AsyncTextureImpl>(path, _placeholder);
+    if (Ref<Texture> cached = GetTextureCache().Find(key))
+    {
+        texture->Finish(cached);
+        return texture;
+    }
+
+    _loading.emplace(key, texture);
+    Enqueue({ path, key, texture });
+
+    return texture;
+}
+
+void TextureLoader::Reload(TextureHandle handle, const std::string& path)
+{
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be loaded on the render thread");
+
+    Enqueue({ path, std::string(), nullptr, handle });
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_GetPerformanceCounter
+int TextureLoader::Upload()
+{
+    DGEX_ASSERT(IsRenderThread(), "Textures can only be uploaded on the render thread");
+
+    if (_pendingCount.load(std::memory_order_relaxed) == 0)
+    {
+        return 0;
+    }
+
+    auto budget = static_cast<uint64_t>(static_cast<double>(_budget.load(std::memory_order_relaxed)) *
+                                        static_cast<double>(SDL_GetPerformanceFrequency()) / 1000.0);
+    uint64_t start = SDL_GetPerformanceCounter();
+
+    int uploaded = 0;
+    for (;;)
+    {
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_uploadQueue.empty())
+            {
+                break;
+            }
+            job = std::move(_uploadQueue.front());
+            _uploadQueue.pop_front();
+        }
+
+        SDL_Texture* native = nullptr;
+        if (job.Surface)
+        {
+            native = CreateTextureFromImage(job.Surface, job.Premultiplied);
+            if (native)
+            {
+                DGEX_CORE_INFO("Loaded texture: {0}", job.Path);
+            }
+            else
+            {
+                DGEX_CORE_ERROR("Failed to upload texture: {0}, {1}", job.Path, SDL_GetError());
+            }
+            SDL_DestroySurface(job.Surface);
+        }
+        Finish(job, native);
+        _pendingCount.fetch_sub(1, std::memory_order_relaxed);
+        uploaded++;
+
+        // At least one per frame, so that loading never starves.
+        if (SDL_GetPerformanceCounter() - start >= budget)
+        {
+            break;
+        }
+    }
+
+    return uploaded;
+}
+
+void TextureLoader::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeUp.notify_all();
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+    _workers.clear();
+
+    // Nothing can be uploaded anymore.
+    for (Job& job : _decodeQueue)
+    {
+        Finish(job, nullptr);
+    }
+    for (Job& job : _uploadQueue)
+    {
+        SDL_DestroySurface(job.Surface);
+        Finish(job, nullptr);
+    }
+    _decodeQueue.clear();
+    _uploadQueue.clear();
+    _loading.clear();
+    _pendingCount.store(0, std::memory_order_relaxed);
+    _placeholder.reset();
+    _stopping = false;
+}
+
+void TextureLoader::SetBudget(float milliseconds)
+{
+    _budget.store(milliseconds, std::memory_order_relaxed);
+}
+
+float TextureLoader::GetBudget() const
+{
+    return _budget.load(std::memory_order_relaxed);
+}
+
+int TextureLoader::GetPendingCount() const
+{
+    return _pendingCount.load(std::memory_order_relaxed);
+}
+
+void TextureLoader::Start()
+{
+    // Leave a core to the main thread, decoding is mostly bound by CPU.
+    unsigned count = std::thread::hardware_concurrency();
+    count = count > 1 ? count - 1 : 1;
+    count = count < MAX_WORKER_COUNT ? count : MAX_WORKER_COUNT;
+
+    for (unsigned i = 0; i < count; i++)
+    {
+        _workers.emplace_back(&TextureLoader::Work, this);
+    }
+
+    DGEX_CORE_DEBUG("Texture loader started with {0} workers", count);
+}
+
+void TextureLoader::Work()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeUp.wait(lock, [this] { return _stopping || !_decodeQueue.empty(); });
+            if (_stopping)
+            {
+                return;
+            }
+            job = std::move(_decodeQueue.front());
+            _decodeQueue.pop_front();
+        }
+
+        // Failures are still handed to Upload, since only the render
+        // thread may touch the cache and the registry.
+        job.Surface = LoadImageSurface(job.Path, job.Premultiplied);
+        if (!job.Surface)
+        {
+            DGEX_CORE_ERROR("Failed to load texture: {0}, {1}", job.Path, SDL_GetError());
+        }
+        else if (job.Texture)
+        {
+            // Reloaded textures still have theirs.
+            CreateTextureVariantSurfaces(job.Surface, job.Variants);
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _uploadQueue.push_back(std::move(job));
+    }
+}
+
+void TextureLoader::Enqueue(Job job)
+{
+    if (_workers.empty())
+    {
+        Start();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _decodeQueue.push_back(std::move(job));
+    }
+    _pendingCount.fetch_add(1, std::memory_order_relaxed);
+    _wakeUp.notify_one();
+}
+
+void TextureLoader::Finish(Job& job, SDL_Texture* native)
+{
+    if (job.Texture)
+    {
+        // If LoadTexture got there first, share that one instead.
+        Ref<Texture> texture;
+        TextureHandle handle;
+        if (native)
+        {
+            Ref<Texture> created = CreateRef<Texture>(native, job.Path);
+            texture = GetTextureCache().Insert(job.Key, created);
+            handle = texture == created ? created->GetHandle() : TextureHandle();
+        }
+        AttachTextureVariants(handle, job.Variants, job.Premultiplied);
+        job.Texture->Finish(texture);
+        _loading.erase(job.Key);
+    }
+    else
+    {
+        GetTextureRegistry().Restore(job.Target, native);
+    }
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_UpdateTexture
+Ref<Texture> TextureLoader::CreatePlaceholder()
+{
+    SDL_Texture* native =
+        SDL_CreateTexture(GetNativeRenderer(), SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    if (native)
+    {
+        const uint32_t pixel = 0; // transparent
+        SDL_UpdateTexture(native, nullptr, &pixel, sizeof(pixel));
+        SDL_SetTextureBlendMode(native, SDL_BLENDMODE_BLEND);
+    }
+    return CreateRef<Texture>(native);
+}
+
+TextureLoader& GetTextureLoader()
+{
+    static TextureLoader sLoader;
+    return sLoader;
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<AsyncTexture> LoadTextureAsync(const std::string& path)
+{
+    return GetTextureLoader().Load(path);
+}
+
+Ref<AsyncTextureBatch> LoadTexturesAsync(const std::vector<std::string>& paths)
+{
+    std::vector<Ref<AsyncTexture>> textures;
+    textures.reserve(paths.size());
+    for (const std::string& path : paths)
+    {
+        textures.push_back(GetTextureLoader().Load(path));
+    }
+    return CreateRef<AsyncTextureBatchImpl>(std::move(textures));
+}
+
+void SetTextureUploadBudget(float milliseconds)
+{
+    GetTextureLoader().SetBudget(milliseconds);
+}
+
+float GetTextureUploadBudget()
+{
+    return GetTextureLoader().GetBudget();
+}
+
+int GetPendingTextureCount()
+{
+    return GetTextureLoader().GetPendingCount();
+}
+
+DGEX_END
@@ -0,0 +1,187 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureLoaderImpl.h                       *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Load textures in the background.                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/TextureLoader.h"
+
+#include <SDL3/SDL.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+DGEX_BEGIN
+
+class AsyncTextureImpl final : public AsyncTexture
+{
+public:
+    AsyncTextureImpl(const std::string& path, const Ref<Texture>& placeholder);
+    ~AsyncTextureImpl() override = default;
+
+    bool IsDone() const override;
+    bool IsLoaded() const override;
+    Ref<Texture> GetTexture() const override;
+    const std::string& GetPath() const override;
+
+    /**
+     * @brief Finish loading, only once.
+     *
+     * @param texture Loaded texture, nullptr on failure.
+     */
+    void Finish(const Ref<Texture>& texture);
+
+private:
+    enum class LoadState : uint8_t
+    {
+        Pending,
+        Loaded,
+        Failed
+    };
+
+    std::string _path;
+    Ref<Texture> _placeholder;
+    Ref<Texture> _texture; // written once, before the state is published
+    std::atomic<LoadState> _state;
+};
+
+class AsyncTextureBatchImpl final : public AsyncTextureBatch
+{
+public:
+    explicit AsyncTextureBatchImpl(std::vector<Ref<AsyncTexture>> textures);
+    ~AsyncTextureBatchImpl() override = default;
+
+    size_t GetCount() const override;
+    const Ref<AsyncTexture>& Get(size_t index) const override;
+    TextureLoadProgress GetProgress() const override;
+
+private:
+    std::vector<Ref<AsyncTexture>> _textures;
+};
+
+/**
+ * @brief Decode images on worker threads, and upload them in budget.
+ *
+ * Decoding only needs the file and SDL_image, so it runs anywhere, but
+ * textures can only be created on the render thread. Decoded surfaces
+ * wait in a queue until Upload takes them.
+ *
+ * Loaded textures go to the texture cache, and a file already cached or
+ * being loaded is not loaded again.
+ */
+class TextureLoader
+{
+public:
+    TextureLoader();
+    TextureLoader(const TextureLoader& other) = delete;
+    TextureLoader(TextureLoader&& other) noexcept = delete;
+    TextureLoader& operator=(const TextureLoader& other) = delete;
+    TextureLoader& operator=(TextureLoader&& other) noexcept = delete;
+
+    ~TextureLoader();
+
+    /**
+     * @brief Queue an image to decode, workers start on first use.
+     *
+     * Returns the texture being loaded if the file already is.
+     */
+    Ref<AsyncTexture> Load(const std::string& path);
+
+    /**
+     * @brief Queue an evicted texture to load again into its slot.
+     *
+     * @param handle Handle of the evicted texture.
+     * @param path Path to the image it was loaded from.
+     */
+    void Reload(TextureHandle handle, const std::string& path);
+
+    /**
+     * @brief Upload decoded images until the budget runs out.
+     *
+     * Must be called on the render thread.
+     *
+     * @return Number of textures uploaded.
+     */
+    int Upload();
+
+    /**
+     * @brief Stop workers and fail whatever is not yet uploaded.
+     *
+     * Called before the native renderer is gone.
+     */
+    void Shutdown();
+
+    void SetBudget(float milliseconds);
+    float GetBudget() const;
+    int GetPendingCount() const;
+
+private:
+    struct Job
+    {
+        std::string Path;
+        std::string Key;                         // in the texture cache
+        Ref<AsyncTextureImpl> Texture;           // null for reloads
+        TextureHandle Target = {};               // evicted texture to reload
+        SDL_Surface* Surface = nullptr;          // until decoded
+        std::vector<SDL_Surface*> Variants = {}; // smaller ones, not for reloads
+        bool Premultiplied = false;
+    };
+
+    void Start();
+    void Work();
+    void Enqueue(Job job);
+
+    /**
+     * @brief Hand the uploaded texture, or nullptr on failure, to whoever
+     *        asked for it.
+     */
+    void Finish(Job& job, SDL_Texture* native);
+
+    /**
+     * @brief Create the transparent texture shown until loaded.
+     */
+    static Ref<Texture> CreatePlaceholder();
+
+private:
+    std::vector<std::thread> _workers;
+
+    std::mutex _mutex; // guards the queues and _stopping
+    std::condition_variable _wakeUp;
+    std::deque<Job> _decodeQueue;
+    std::deque<Job> _uploadQueue;
+    bool _stopping;
+
+    std::unordered_map<std::string, Ref<AsyncTextureImpl>> _loading; // by cache key, render thread only
+
+    std::atomic<int> _pendingCount;
+    std::atomic<float> _budget; // in milliseconds
+
+    Ref<Texture> _placeholder;
+};
+
+/**
+ * @brief Get the texture loader.
+ */
+TextureLoader& GetTextureLoader();
+
+DGEX_END
@@ -0,0 +1,585 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureRegistry.cpp                       *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Registry of live textures behind generational handles.                     *
+ ******************************************************************************/
+
+#include "Renderer/TextureRegistry.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+
+#include "DgeX/Utils/Log.h"
+
+#include <algorithm>
+
+DGEX_BEGIN
+
+TextureRegistry::TextureRegistry()
+    : _chunks(), _slotCount(0), _frame(0), _latency(0), _contentEpoch(0), _liveCount(0), _fallback(nullptr),
+      _residentBytes(0), _evictedCount(0), _evictionCount(0), _reloadCount(0)
+{
+}
+
+TextureRegistry::~TextureRegistry()
+{
+    // Native textures are gone with the renderer by now.
+    for (std::atomic<Slot*>& chunk : _chunks)
+    {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+static uint64_t PackHandle(TextureHandle handle)
+{
+    return static_cast<uint64_t>(handle.Generation) << 32 | handle.Index;
+}
+
+static TextureHandle UnpackHandle(uint64_t packed)
+{
+    return { static_cast<uint32_t>(packed), static_cast<uint32_t>(packed >> 32) };
+}
+
+static void QueryTexture(SDL_Texture* texture, float& width, float& height, SDL_PixelFormat& format)
+{
+    SDL_PropertiesID props = SDL_GetTextureProperties(texture);
+    width = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
+    height = static_cast<float>(SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_HEIGHT_NUMBER, 0));
+    format = static_cast<SDL_PixelFormat>(
+        SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_FORMAT_NUMBER, SDL_PIXELFORMAT_UNKNOWN));
+}
+
+TextureHandle TextureRegistry::Register(SDL_Texture* texture, const std::string& source)
+{
+    if (!texture)
+    {
+        return {};
+    }
+
+    // Query once, so that draws never ask SDL again.
+    float width;
+    float height;
+    SDL_PixelFormat format;
+    QueryTexture(texture, width, height, format);
+
+    return Allocate(texture, source, width, height, format, EstimateBytes(width, height, format), 1.0f, 1.0f);
+}
+
+TextureHandle TextureRegistry::RegisterVariant(TextureHandle handle, SDL_Texture* texture)
+{
+    TextureInfo info;
+    if (!texture || !Resolve(handle, info) || (info.Width <= 0.0f) || (info.Height <= 0.0f))
+    {
+        return {};
+    }
+
+    // Same size as the texture, so that draws need no change. Halving an
+    // odd size rounds, so each axis keeps its own ratio.
+    float width;
+    float height;
+    SDL_PixelFormat format;
+    QueryTexture(texture, width, height, format);
+    TextureHandle variant =
+        Allocate(texture, std::string(), info.Width, info.Height, format, EstimateBytes(width, height, format),
+                 width / info.Width, height / info.Height);
+    if (!variant.IsValid())
+    {
+        return variant;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const Slot* last = GetLiveSlot(handle);
+    if (!last || GetSlot(handle.Index)->Released)
+    {
+        // Released meanwhile, the variant would never be. Hand the
+        // texture back to the caller, as for other failures.
+        GetSlot(variant.Index)->Native.store(nullptr, std::memory_order_relaxed);
+        DestroySlot(variant.Index);
+        return {};
+    }
+    while (const Slot* next = GetLiveSlot(UnpackHandle(last->Variant.load(std::memory_order_relaxed))))
+    {
+        last = next;
+    }
+    const_cast<Slot*>(last)->Variant.store(PackHandle(variant), std::memory_order_release);
+
+    return variant;
+}
+
+TextureHandle TextureRegistry::SelectVariant(TextureHandle handle, float scale) const
+{
+    TextureHandle selected = handle;
+    const Slot* slot = GetLiveSlot(handle);
+    while (slot)
+    {
+        TextureHandle variant = UnpackHandle(slot->Variant.load(std::memory_order_acquire));
+        const Slot* next = GetLiveSlot(variant);
+        // Only as sharp as its coarser axis.
+        if (!next || (std::min(next->ResolutionX.load(std::memory_order_relaxed),
+                               next->ResolutionY.load(std::memory_order_relaxed)) < scale))
+        {
+            break;
+        }
+        selected = variant;
+        slot = next;
+    }
+    return selected;
+}
+
+int TextureRegistry::GetVariantCount(TextureHandle handle) const
+{
+    int count = 0;
+    const Slot* slot = GetLiveSlot(handle);
+    while (slot && (slot = GetLiveSlot(UnpackHandle(slot->Variant.load(std::memory_order_acquire)))))
+    {
+        count++;
+    }
+    return count;
+}
+
+TextureHandle TextureRegistry::Allocate(SDL_Texture* texture, const std::string& source, float width, float height,
+                                        SDL_PixelFormat format, size_t bytes, float resolutionX, float resolutionY)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    uint32_t index;
+    if (!_freeSlots.empty())
+    {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else
+    {
+        if (_slotCount == SLOTS_PER_CHUNK * MAX_CHUNKS)
+        {
+            DGEX_CORE_ERROR("Too many textures, at most {0} can be alive", SLOTS_PER_CHUNK * MAX_CHUNKS);
+            return {};
+        }
+        index = _slotCount++;
+        std::atomic<Slot*>& chunk = _chunks[index / SLOTS_PER_CHUNK];
+        if (!chunk.load(std::memory_order_relaxed))
+        {
+            Slot* slots = new Slot[SLOTS_PER_CHUNK];
+            for (uint32_t i = 0; i < SLOTS_PER_CHUNK; i++)
+            {
+                slots[i].Generation.store(0, std::memory_order_relaxed);
+                slots[i].LastUsedFrame.store(0, std::memory_order_relaxed);
+                slots[i].Native.store(nullptr, std::memory_order_relaxed);
+                slots[i].Evicted.store(false, std::memory_order_relaxed);
+                slots[i].Wanted.store(false, std::memory_order_relaxed);
+                slots[i].Variant.store(0, std::memory_order_relaxed);
+                slots[i].NextGeneration = 1;
+                slots[i].Released = false;
+                slots[i].Reloading = false;
+            }
+            chunk.store(slots, std::memory_order_release);
+        }
+    }
+
+    Slot& slot = *GetSlot(index);
+    uint32_t generation = slot.NextGeneration;
+    slot.NextGeneration = (generation == UINT32_MAX) ? 1 : generation + 1;
+    slot.Released = false;
+    slot.Reloading = false;
+    slot.Source = source;
+    slot.Native.store(texture, std::memory_order_relaxed);
+    slot.Evicted.store(false, std::memory_order_relaxed);
+    slot.Wanted.store(false, std::memory_order_relaxed);
+    slot.Variant.store(0, std::memory_order_relaxed);
+    slot.Width.store(width, std::memory_order_relaxed);
+    slot.Height.store(height, std::memory_order_relaxed);
+    slot.Format.store(format, std::memory_order_relaxed);
+    slot.ResolutionX.store(resolutionX, std::memory_order_relaxed);
+    slot.ResolutionY.store(resolutionY, std::memory_order_relaxed);
+    slot.Bytes = bytes;
+    slot.LastUsedFrame.store(_frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    slot.Generation.store(generation, std::memory_order_release);
+
+    _liveCount++;
+    _residentBytes += slot.Bytes;
+
+    return { index, generation };
+}
+
+bool TextureRegistry::Resolve(TextureHandle handle, TextureInfo& info) const
+{
+    if (!handle.IsValid())
+    {
+        return false;
+    }
+
+    const Slot* slot = GetSlot(handle.Index);
+    if (!slot || (slot->Generation.load(std::memory_order_acquire) != handle.Generation))
+    {
+        return false;
+    }
+
+    info.Native = slot->Native.load(std::memory_order_acquire);
+    info.Width = slot->Width.load(std::memory_order_relaxed);
+    info.Height = slot->Height.load(std::memory_order_relaxed);
+    info.Format = slot->Format.load(std::memory_order_relaxed);
+    info.ResolutionX = slot->ResolutionX.load(std::memory_order_relaxed);
+    info.ResolutionY = slot->ResolutionY.load(std::memory_order_relaxed);
+
+    // The slot may be recycled while we read it.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot->Generation.load(std::memory_order_relaxed) == handle.Generation;
+}
+
+void TextureRegistry::MarkUsed(TextureHandle handle)
+{
+    Slot* slot = handle.IsValid() ? GetSlot(handle.Index) : nullptr;
+    if (slot && (slot->Generation.load(std::memory_order_relaxed) == handle.Generation))
+    {
+        slot->LastUsedFrame.store(_frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        if (slot->Evicted.load(std::memory_order_relaxed))
+        {
+            slot->Wanted.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool TextureRegistry::IsResident(TextureHandle handle) const
+{
+    const Slot* slot = handle.IsValid() ? GetSlot(handle.Index) : nullptr;
+    return slot && (slot->Generation.load(std::memory_order_acquire) == handle.Generation) &&
+           !slot->Evicted.load(std::memory_order_relaxed);
+}
+
+void TextureRegistry::Release(TextureHandle handle)
+{
+    if (!handle.IsValid())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Variants go with the texture.
+    while (const Slot* live = GetLiveSlot(handle))
+    {
+        Slot* slot = GetSlot(handle.Index);
+        if (slot->Released)
+        {
+            return;
+        }
+        slot->Released = true;
+        _pending.push_back(handle.Index);
+        handle = UnpackHandle(live->Variant.load(std::memory_order_relaxed));
+    }
+}
+
+void TextureRegistry::EndFrame()
+{
+    uint64_t frame = _frame.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Textures used after this point belong to the next frame, and wait.
+    size_t kept = 0;
+    for (uint32_t index : _pending)
+    {
+        if (GetSlot(index)->LastUsedFrame.load(std::memory_order_relaxed) + _latency <= frame)
+        {
+            DestroySlot(index);
+        }
+        else
+        {
+            _pending[kept++] = index;
+        }
+    }
+    _pending.resize(kept);
+}
+
+void TextureRegistry::SetFrameLatency(uint32_t frames)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latency = frames;
+}
+
+void TextureRegistry::DestroyAll()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (uint32_t index = 0; index < _slotCount; index++)
+    {
+        if (GetSlot(index)->Generation.load(std::memory_order_relaxed) != 0)
+        {
+            DestroySlot(index);
+        }
+    }
+    _pending.clear();
+
+    if (_fallback)
+    {
+        ForgetTextureState(_fallback);
+        SDL_DestroyTexture(_fallback);
+        _fallback = nullptr;
+    }
+}
+
+int TextureRegistry::Evict(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_residentBytes <= budget)
+    {
+        return 0;
+    }
+
+    // Whatever the last frame drew is likely drawn again, keep it.
+    uint64_t frame = _frame.load(std::memory_order_relaxed);
+    _candidates.clear();
+    for (uint32_t index = 0; index < _slotCount; index++)
+    {
+        const Slot& slot = *GetSlot(index);
+        if ((slot.Generation.load(std::memory_order_relaxed) == 0) || slot.Released || slot.Source.empty() ||
+            slot.Evicted.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+        uint64_t lastUsed = slot.LastUsedFrame.load(std::memory_order_relaxed);
+        if (lastUsed + 1 < frame)
+        {
+            _candidates.emplace_back(lastUsed, index);
+        }
+    }
+    std::sort(_candidates.begin(), _candidates.end());
+
+    int evicted = 0;
+    for (const auto& [lastUsed, index] : _candidates)
+    {
+        if (_residentBytes <= budget)
+        {
+            break;
+        }
+
+        Slot& slot = *GetSlot(index);
+        SDL_Texture* native = slot.Native.load(std::memory_order_relaxed);
+        if (!_fallback && !CreateFallback(native))
+        {
+            break;
+        }
+
+        slot.Wanted.store(false, std::memory_order_relaxed);
+        slot.Native.store(_fallback, std::memory_order_release);
+        slot.Evicted.store(true, std::memory_order_relaxed);
+        _contentEpoch.fetch_add(1, std::memory_order_release);
+        ForgetTextureState(native);
+        SDL_DestroyTexture(native);
+
+        _residentBytes -= slot.Bytes;
+        _evictedCount++;
+        _evictionCount++;
+        evicted++;
+    }
+
+    if (evicted > 0)
+    {
+        DGEX_CORE_DEBUG("Evicted {0} textures, {1} bytes still resident", evicted, _residentBytes);
+    }
+
+    return evicted;
+}
+
+void TextureRegistry::CollectReloads(std::vector<TextureReload>& reloads)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_evictedCount == 0)
+    {
+        return;
+    }
+    for (uint32_t index = 0; index < _slotCount; index++)
+    {
+        Slot& slot = *GetSlot(index);
+        uint32_t generation = slot.Generation.load(std::memory_order_relaxed);
+        if ((generation == 0) || !slot.Evicted.load(std::memory_order_relaxed) || slot.Reloading ||
+            slot.Source.empty())
+        {
+            continue;
+        }
+        if (slot.Wanted.exchange(false, std::memory_order_relaxed))
+        {
+            slot.Reloading = true;
+            reloads.push_back({ { index, generation }, slot.Source });
+        }
+    }
+}
+
+void TextureRegistry::Restore(TextureHandle handle, SDL_Texture* texture)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Slot* slot = handle.IsValid() ? GetSlot(handle.Index) : nullptr;
+    if (!slot || (slot->Generation.load(std::memory_order_relaxed) != handle.Generation) ||
+        !slot->Evicted.load(std::memory_order_relaxed))
+    {
+        // Destroyed while loading, no one wants it anymore.
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+        }
+        return;
+    }
+
+    slot->Reloading = false;
+    if (!texture)
+    {
+        DGEX_CORE_WARN("Failed to reload texture: {0}, keep the fallback", slot->Source);
+        slot->Source.clear();
+        return;
+    }
+
+    slot->Native.store(texture, std::memory_order_release);
+    slot->Evicted.store(false, std::memory_order_relaxed);
+    _contentEpoch.fetch_add(1, std::memory_order_release);
+    _residentBytes += slot->Bytes;
+    _evictedCount--;
+    _reloadCount++;
+}
+
+uint64_t TextureRegistry::GetFrame() const
+{
+    return _frame.load(std::memory_order_relaxed);
+}
+
+size_t TextureRegistry::GetTextureCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _liveCount;
+}
+
+size_t TextureRegistry::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending.size();
+}
+
+size_t TextureRegistry::GetResidentBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _residentBytes;
+}
+
+size_t TextureRegistry::GetEvictedCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _evictedCount;
+}
+
+uint64_t TextureRegistry::GetEvictionCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _evictionCount;
+}
+
+uint64_t TextureRegistry::GetReloadCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _reloadCount;
+}
+
+uint64_t TextureRegistry::GetContentEpoch() const
+{
+    return _contentEpoch.load(std::memory_order_acquire);
+}
+
+size_t TextureRegistry::EstimateBytes(float width, float height, SDL_PixelFormat format)
+{
+    // Compressed or unknown formats are assumed to take 32 bits.
+    size_t bytesPerPixel = 4;
+    if ((format != SDL_PIXELFORMAT_UNKNOWN) && !SDL_ISPIXELFORMAT_FOURCC(format) && (SDL_BYTESPERPIXEL(format) > 0))
+    {
+        bytesPerPixel = SDL_BYTESPERPIXEL(format);
+    }
+    return static_cast<size_t>(width) * static_cast<size_t>(height) * bytesPerPixel;
+}
+
+const TextureRegistry::Slot* TextureRegistry::GetLiveSlot(TextureHandle handle) const
+{
+    const Slot* slot = handle.IsValid() ? GetSlot(handle.Index) : nullptr;
+    return slot && (slot->Generation.load(std::memory_order_acquire) == handle.Generation) ? slot : nullptr;
+}
+
+TextureRegistry::Slot* TextureRegistry::GetSlot(uint32_t index) const
+{
+    if (index >= SLOTS_PER_CHUNK * MAX_CHUNKS)
+    {
+        return nullptr;
+    }
+    Slot* chunk = _chunks[index / SLOTS_PER_CHUNK].load(std::memory_order_acquire);
+    return chunk ? chunk + index % SLOTS_PER_CHUNK : nullptr;
+}
+
+void TextureRegistry::DestroySlot(uint32_t index)
+{
+    Slot& slot = *GetSlot(index);
+
+    // Unpublish first, so that readers see the slot is gone. A release
+    // store only orders the writes before it, so the fence keeps those
+    // below from becoming visible while the old generation still is.
+    slot.Generation.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    SDL_Texture* native = slot.Native.exchange(nullptr, std::memory_order_relaxed);
+    if (slot.Evicted.load(std::memory_order_relaxed))
+    {
+        // Only the fallback is left, which is shared.
+        slot.Evicted.store(false, std::memory_order_relaxed);
+        _evictedCount--;
+    }
+    else
+    {
+        ForgetTextureState(native);
+        SDL_DestroyTexture(native);
+        _residentBytes -= slot.Bytes;
+    }
+    slot.Wanted.store(false, std::memory_order_relaxed);
+    slot.Variant.store(0, std::memory_order_relaxed);
+    slot.Released = false;
+    slot.Reloading = false;
+    slot.Source.clear();
+
+    _freeSlots.push_back(index);
+    _liveCount--;
+}
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_GetRendererFromTexture
+bool TextureRegistry::CreateFallback(SDL_Texture* texture)
+{
+    SDL_Renderer* renderer = SDL_GetRendererFromTexture(texture);
+    _fallback = renderer ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 1, 1)
+                         : nullptr;
+    if (!_fallback)
+    {
+        DGEX_CORE_ERROR("Failed to create fallback texture: {0}", SDL_GetError());
+        return false;
+    }
+
+    const uint32_t pixel = 0; // transparent
+    SDL_UpdateTexture(_fallback, nullptr, &pixel, sizeof(pixel));
+    SDL_SetTextureBlendMode(_fallback, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+TextureRegistry& GetTextureRegistry()
+{
+    static TextureRegistry sRegistry;
+    return sRegistry;
+}
+
+DGEX_END
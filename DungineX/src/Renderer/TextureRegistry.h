@@ -0,0 +1,312 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureRegistry.h                         *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Registry of live textures behind generational handles.                     *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/Texture.h"
+
+#include <SDL3/SDL.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief What a texture handle resolves to.
+ */
+struct TextureInfo
+{
+    SDL_Texture* Native; // the fallback while evicted
+    float Width;
+    float Height;
+    SDL_PixelFormat Format;
+    float ResolutionX;   // native pixels per texture pixel, horizontally
+    float ResolutionY;   // native pixels per texture pixel, vertically
+};
+
+/**
+ * @brief An evicted texture drawn again, to be loaded from its source.
+ */
+struct TextureReload
+{
+    TextureHandle Handle;
+    std::string Source;
+};
+
+/**
+ * @brief Own native textures on behalf of Texture.
+ *
+ * Slots never move, so Resolve and MarkUsed take no lock and can be
+ * called from any thread that records commands. A released texture stays
+ * resolvable until EndFrame sees that the last frame using it has been
+ * presented, then its native texture is destroyed and the slot moves on
+ * to the next generation.
+ *
+ * Textures registered with a source file can be evicted to keep memory
+ * in budget. An evicted texture keeps its handle and size, but resolves
+ * to a transparent fallback until it is loaded again, see Restore.
+ *
+ * A texture may have a chain of smaller variants, each registered with
+ * the size of the texture but a smaller native texture, so that a draw
+ * can switch to one without changing anything else, see SelectVariant.
+ */
+class TextureRegistry
+{
+public:
+    TextureRegistry();
+    TextureRegistry(const TextureRegistry& other) = delete;
+    TextureRegistry(TextureRegistry&& other) noexcept = delete;
+    TextureRegistry& operator=(const TextureRegistry& other) = delete;
+    TextureRegistry& operator=(TextureRegistry&& other) noexcept = delete;
+
+    ~TextureRegistry();
+
+    /**
+     * @brief Register a native texture, size and format are queried once.
+     *
+     * @param texture Native texture to own.
+     * @param source File the texture is loaded from, empty if it cannot be
+     *               loaded again, e.g. render targets, then it is never
+     *               evicted.
+     * @return Handle of the texture, invalid if texture is nullptr or the
+     *         registry is full.
+     */
+    TextureHandle Register(SDL_Texture* texture, const std::string& source = std::string());
+
+    /**
+     * @brief Register a smaller variant of a texture.
+     *
+     * Variants must be added from the largest to the smallest. They are
+     * released together with the texture, and never evicted.
+     *
+     * @param handle Handle of the texture.
+     * @param texture Native texture of the variant, owned only on success.
+     * @return Handle of the variant, invalid on failure.
+     */
+    TextureHandle RegisterVariant(TextureHandle handle, SDL_Texture* texture);
+
+    /**
+     * @brief Select the smallest variant still sharp at a scale.
+     *
+     * @param handle Handle of the texture.
+     * @param scale Scale the texture is drawn at.
+     * @return Handle of the variant, or the texture itself.
+     */
+    TextureHandle SelectVariant(TextureHandle handle, float scale) const;
+
+    /**
+     * @brief Get the number of variants of a texture.
+     */
+    int GetVariantCount(TextureHandle handle) const;
+
+    /**
+     * @brief Resolve a handle.
+     *
+     * @param handle Handle to resolve.
+     * @param info Receives the texture on success.
+     * @return Whether the handle is still alive.
+     */
+    bool Resolve(TextureHandle handle, TextureInfo& info) const;
+
+    /**
+     * @brief Record that the texture is used by the current frame.
+     *
+     * An evicted texture is queued for reload, see CollectReloads.
+     */
+    void MarkUsed(TextureHandle handle);
+
+    /**
+     * @brief Check whether the native texture is in memory.
+     */
+    bool IsResident(TextureHandle handle) const;
+
+    /**
+     * @brief Release a texture and its variants, destroyed later by
+     *        EndFrame.
+     */
+    void Release(TextureHandle handle);
+
+    /**
+     * @brief End the current frame after it is presented.
+     *
+     * Destroy released textures not used since the frame that just ended,
+     * or since earlier with a frame latency. Must be called on the render
+     * thread.
+     */
+    void EndFrame();
+
+    /**
+     * @brief Keep released textures for more frames after their last use.
+     *
+     * For frames recorded while an earlier one is rendered, whose use may
+     * be marked just before the earlier one ends.
+     *
+     * @param frames Frames recorded ahead of the one rendered.
+     */
+    void SetFrameLatency(uint32_t frames);
+
+    /**
+     * @brief Destroy all textures, released or not.
+     *
+     * Called before the native renderer is gone. Handles held elsewhere
+     * become stale.
+     */
+    void DestroyAll();
+
+    /**
+     * @brief Evict least recently used textures until within budget.
+     *
+     * Only textures with a source, and not used by the frame that just
+     * ended, are evicted, so the budget may still be exceeded. Must be
+     * called on the render thread, after EndFrame.
+     *
+     * @param budget Memory budget in bytes.
+     * @return Number of textures evicted.
+     */
+    int Evict(size_t budget);
+
+    /**
+     * @brief Take evicted textures drawn since last time.
+     *
+     * Each is handed out once, until Restore is called for it.
+     *
+     * @param reloads Receives textures to load again.
+     */
+    void CollectReloads(std::vector<TextureReload>& reloads);
+
+    /**
+     * @brief Put a reloaded native texture back into its slot.
+     *
+     * The texture is destroyed if the handle is stale by now. On failure,
+     * the texture keeps the fallback and is not reloaded anymore.
+     *
+     * @param handle Handle of the evicted texture.
+     * @param texture Reloaded texture, nullptr on failure.
+     */
+    void Restore(TextureHandle handle, SDL_Texture* texture);
+
+    /**
+     * @brief Get the number of frames ended so far.
+     */
+    uint64_t GetFrame() const;
+
+    /**
+     * @brief Get the number of live textures, including released ones.
+     */
+    size_t GetTextureCount() const;
+
+    /**
+     * @brief Get the number of textures waiting for destruction.
+     */
+    size_t GetPendingCount() const;
+
+    /**
+     * @brief Get the estimated memory of native textures in memory.
+     */
+    size_t GetResidentBytes() const;
+
+    size_t GetEvictedCount() const;
+
+    /**
+     * @brief Get the number of evictions and reloads so far.
+     */
+    uint64_t GetEvictionCount() const;
+    uint64_t GetReloadCount() const;
+
+    /**
+     * @brief Get the number of native textures swapped under a handle.
+     *
+     * Eviction and Restore change what a handle draws without changing
+     * the handle, so anything keeping drawn pixels across frames must
+     * redraw once this changes.
+     */
+    uint64_t GetContentEpoch() const;
+
+    /**
+     * @brief Estimate the memory of a texture from its size and format.
+     */
+    static size_t EstimateBytes(float width, float height, SDL_PixelFormat format);
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32_t> Generation; // 0 while the slot is free
+        std::atomic<uint64_t> LastUsedFrame;
+        std::atomic<SDL_Texture*> Native; // swapped with the fallback on eviction
+        std::atomic<bool> Evicted;
+        std::atomic<bool> Wanted;         // drawn while evicted
+        std::atomic<uint64_t> Variant;    // next smaller variant, packed handle
+        uint32_t NextGeneration;          // guarded by _mutex
+        bool Released;                    // guarded by _mutex
+        bool Reloading;                   // guarded by _mutex
+        std::string Source;               // guarded by _mutex
+
+        // Only written before the generation is published, readers check
+        // the generation before and after reading them. Atomic, since a
+        // reader may still read them while the slot is recycled.
+        std::atomic<float> Width;
+        std::atomic<float> Height;
+        std::atomic<SDL_PixelFormat> Format;
+        std::atomic<float> ResolutionX; // native over logical width, below 1 for variants
+        std::atomic<float> ResolutionY; // native over logical height, below 1 for variants
+        size_t Bytes;                   // guarded by _mutex
+    };
+
+    static constexpr uint32_t SLOTS_PER_CHUNK = 256;
+    static constexpr uint32_t MAX_CHUNKS = 256;
+
+    Slot* GetSlot(uint32_t index) const;
+    const Slot* GetLiveSlot(TextureHandle handle) const;
+    TextureHandle Allocate(SDL_Texture* texture, const std::string& source, float width, float height,
+                           SDL_PixelFormat format, size_t bytes, float resolutionX, float resolutionY);
+    void DestroySlot(uint32_t index);
+    bool CreateFallback(SDL_Texture* texture);
+
+private:
+    std::atomic<Slot*> _chunks[MAX_CHUNKS];
+    uint32_t _slotCount; // slots ever created, guarded by _mutex
+
+    std::atomic<uint64_t> _frame;
+    uint64_t _latency; // guarded by _mutex
+    std::atomic<uint64_t> _contentEpoch;
+
+    mutable std::mutex _mutex; // guards slot allocation and the lists below
+    std::vector<uint32_t> _freeSlots;
+    std::vector<uint32_t> _pending;
+    size_t _liveCount;
+
+    // Residency, guarded by _mutex.
+    SDL_Texture* _fallback; // shown while evicted
+    size_t _residentBytes;
+    size_t _evictedCount;
+    uint64_t _evictionCount;
+    uint64_t _reloadCount;
+    std::vector<std::pair<uint64_t, uint32_t>> _candidates; // scratch for Evict
+};
+
+/**
+ * @brief Get the texture registry.
+ */
+TextureRegistry& GetTextureRegistry();
+
+DGEX_END
@@ -0,0 +1,73 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureResidency.cpp                      *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Keep textures in memory within a budget.                                   *
+ ******************************************************************************/
+
+#include "Renderer/TextureResidencyImpl.h"
+
+#include "Renderer/TextureLoaderImpl.h"
+#include "Renderer/TextureRegistry.h"
+
+#include <atomic>
+#include <vector>
+
+DGEX_BEGIN
+
+static std::atomic<size_t> sBudget(0);
+static std::vector<TextureReload> sReloads;
+
+void UpdateTextureResidency()
+{
+    TextureRegistry& registry = GetTextureRegistry();
+
+    // Reload before evicting, so that textures drawn again come back first.
+    sReloads.clear();
+    registry.CollectReloads(sReloads);
+    for (const TextureReload& reload : sReloads)
+    {
+        GetTextureLoader().Reload(reload.Handle, reload.Source);
+    }
+
+    size_t budget = sBudget.load(std::memory_order_relaxed);
+    if (budget > 0)
+    {
+        registry.Evict(budget);
+    }
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+void SetTextureMemoryBudget(size_t bytes)
+{
+    sBudget.store(bytes, std::memory_order_relaxed);
+}
+
+size_t GetTextureMemoryBudget()
+{
+    return sBudget.load(std::memory_order_relaxed);
+}
+
+TextureResidencyStatistics GetTextureResidencyStatistics()
+{
+    const TextureRegistry& registry = GetTextureRegistry();
+    return { registry.GetResidentBytes(), sBudget.load(std::memory_order_relaxed), registry.GetEvictedCount(),
+             registry.GetEvictionCount(), registry.GetReloadCount() };
+}
+
+DGEX_END
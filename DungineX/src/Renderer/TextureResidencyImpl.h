@@ -3,31 +3,32 @@
  ******************************************************************************
  *                   Project Name : DungineX                                  *
  *                                                                            *
- *                      File Name : RenderCommand.h                           *
+ *                      File Name : TextureResidencyImpl.h                    *
  *                                                                            *
  *                     Programmer : Tony S.                                   *
  *                                                                            *
- *                     Start Date : June 2, 2025                              *
+ *                     Start Date : October 17, 2026                          *
  *                                                                            *
- *                    Last Update : June 2, 2025                              *
+ *                    Last Update : October 17, 2026                          *
  *                                                                            *
  * -------------------------------------------------------------------------- *
  * OVERVIEW:                                                                  *
  *                                                                            *
- * Render command is each single render action.                               *
+ * Keep textures in memory within a budget.                                   *
  ******************************************************************************/
 
-#include "Device/Graphics/RenderCommand.h"
+#pragma once
 
-DGEX_BEGIN
+#include "DgeX/Renderer/TextureResidency.h"
 
-RenderCommand::RenderCommand(int order) : _order(order)
-{
-}
+DGEX_BEGIN
 
-int RenderCommand::GetOrder() const
-{
-    return _order;
-}
+/**
+ * @brief Reload evicted textures drawn in the last frame, and evict
+ *        others if over budget.
+ *
+ * Called on the render thread after the texture registry ends the frame.
+ */
+void UpdateTextureResidency();
 
 DGEX_END
@@ -0,0 +1,255 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureVariant.cpp                        *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Pre-scaled variants of textures for drawing them small.                    *
+ ******************************************************************************/
+
+#include "Renderer/TextureVariantImpl.h"
+
+#include "Renderer/TextureFileImpl.h"
+#include "Utils/Simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+DGEX_BEGIN
+
+static std::mutex sMutex;
+static TextureVariantOptions sOptions;
+
+// ============================================================================
+// Downsampling
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Shrink a row pair, from the given output pixel to the end.
+ */
+static void DownsampleRowScalar(const uint8_t* row0, const uint8_t* row1, int width, uint8_t* out, int begin, int end)
+{
+    // A source one pixel wide is only shrunk vertically.
+    int next = width > 1 ? 4 : 0;
+    for (int x = begin; x < end; x++)
+    {
+        const uint8_t* a = row0 + static_cast<ptrdiff_t>(x) * 8;
+        const uint8_t* b = row1 + static_cast<ptrdiff_t>(x) * 8;
+        for (int c = 0; c < 4; c++)
+        {
+            out[x * 4 + c] = static_cast<uint8_t>((a[c] + a[c + next] + b[c] + b[c + next] + 2) >> 2);
+        }
+    }
+}
+
+/**
+ * @brief Shrink a row pair 4 output pixels at a time.
+ *
+ * @return Number of output pixels done, the rest is left to the scalar path.
+ */
+static int DownsampleRowSimd(const uint8_t* row0, const uint8_t* row1, uint8_t* out, int count)
+{
+    int x = 0;
+
+#if defined(DGEX_SIMD_AVX2) || defined(DGEX_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    for (; x + 4 <= count; x += 4)
+    {
+        const uint8_t* a = row0 + static_cast<ptrdiff_t>(x) * 8;
+        const uint8_t* b = row1 + static_cast<ptrdiff_t>(x) * 8;
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + 16));
+        __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + 16));
+
+        // Columns summed in 16 bits, two source pixels per register.
+        __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+        // Then even and odd columns, two output pixels per register.
+        __m128i t0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+        __m128i t1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+        t0 = _mm_srli_epi16(_mm_add_epi16(t0, two), 2);
+        t1 = _mm_srli_epi16(_mm_add_epi16(t1, two), 2);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + static_cast<ptrdiff_t>(x) * 4), _mm_packus_epi16(t0, t1));
+    }
+#elif defined(DGEX_SIMD_NEON)
+    for (; x + 4 <= count; x += 4)
+    {
+        // Even and odd source pixels come apart on load.
+        uint32x4x2_t a = vld2q_u32(reinterpret_cast<const uint32_t*>(row0 + static_cast<ptrdiff_t>(x) * 8));
+        uint32x4x2_t b = vld2q_u32(reinterpret_cast<const uint32_t*>(row1 + static_cast<ptrdiff_t>(x) * 8));
+        uint8x16_t a0 = vreinterpretq_u8_u32(a.val[0]);
+        uint8x16_t a1 = vreinterpretq_u8_u32(a.val[1]);
+        uint8x16_t b0 = vreinterpretq_u8_u32(b.val[0]);
+        uint8x16_t b1 = vreinterpretq_u8_u32(b.val[1]);
+
+        uint16x8_t low = vaddl_u8(vget_low_u8(a0), vget_low_u8(a1));
+        low = vaddw_u8(vaddw_u8(low, vget_low_u8(b0)), vget_low_u8(b1));
+        uint16x8_t high = vaddl_u8(vget_high_u8(a0), vget_high_u8(a1));
+        high = vaddw_u8(vaddw_u8(high, vget_high_u8(b0)), vget_high_u8(b1));
+
+        // Rounding shift, the same as adding 2 first.
+        vst1q_u8(out + static_cast<ptrdiff_t>(x) * 4, vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+    }
+#else
+    (void)row0;
+    (void)row1;
+    (void)out;
+    (void)count;
+#endif
+
+    return x;
+}
+
+void DownsampleBox(const void* source, int sourcePitch, int width, int height, void* destination,
+                   int destinationPitch)
+{
+    int outWidth = width > 1 ? width / 2 : 1;
+    int outHeight = height > 1 ? height / 2 : 1;
+    for (int y = 0; y < outHeight; y++)
+    {
+        const uint8_t* row0 = static_cast<const uint8_t*>(source) + static_cast<ptrdiff_t>(y) * 2 * sourcePitch;
+        const uint8_t* row1 = height > 1 ? row0 + sourcePitch : row0;
+        uint8_t* out = static_cast<uint8_t*>(destination) + static_cast<ptrdiff_t>(y) * destinationPitch;
+
+        int x = width > 1 ? DownsampleRowSimd(row0, row1, out, outWidth) : 0;
+        DownsampleRowScalar(row0, row1, width, out, x, outWidth);
+    }
+}
+
+const char* GetDownsamplePath()
+{
+    return DGEX_SIMD_NAME;
+}
+
+// ============================================================================
+// Variants
+// ----------------------------------------------------------------------------
+
+// Reference: https://wiki.libsdl.org/SDL3/SDL_ConvertSurface
+void CreateTextureVariantSurfaces(SDL_Surface* surface, std::vector<SDL_Surface*>& variants)
+{
+    TextureVariantOptions options = GetTextureVariantOptions();
+    if (!options.Enabled || !surface)
+    {
+        return;
+    }
+    int minSize = options.MinSize > 1 ? options.MinSize : 1;
+
+    // Skip the largest variants until the rest fit.
+    int levelCount = 0;
+    size_t total = 0;
+    for (int w = surface->w / 2, h = surface->h / 2; (w >= minSize) && (h >= minSize); w /= 2, h /= 2)
+    {
+        levelCount++;
+        total += static_cast<size_t>(w) * h * 4;
+    }
+    int skipped = 0;
+    for (int w = surface->w / 2, h = surface->h / 2; (options.MaxBytes > 0) && (total > options.MaxBytes);
+         w /= 2, h /= 2)
+    {
+        total -= static_cast<size_t>(w) * h * 4;
+        skipped++;
+    }
+    if (skipped == levelCount)
+    {
+        return;
+    }
+
+    // Any 32-bit format averages the same, others are converted.
+    SDL_Surface* converted = nullptr;
+    if (SDL_ISPIXELFORMAT_FOURCC(surface->format) || (SDL_BYTESPERPIXEL(surface->format) != 4))
+    {
+        converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+        if (!converted)
+        {
+            return;
+        }
+        surface = converted;
+    }
+
+    SDL_Surface* previous = surface;
+    bool owned = false; // previous is a skipped variant
+    for (int level = 0; level < levelCount; level++)
+    {
+        SDL_Surface* next = SDL_CreateSurface(previous->w / 2, previous->h / 2, previous->format);
+        if (next)
+        {
+            DownsampleBox(previous->pixels, previous->pitch, previous->w, previous->h, next->pixels, next->pitch);
+        }
+        if (owned)
+        {
+            SDL_DestroySurface(previous);
+        }
+        if (!next)
+        {
+            owned = false;
+            break;
+        }
+
+        // Skipped ones are only kept to make the next one.
+        owned = level < skipped;
+        if (!owned)
+        {
+            variants.push_back(next);
+        }
+        previous = next;
+    }
+    if (owned)
+    {
+        SDL_DestroySurface(previous);
+    }
+    SDL_DestroySurface(converted);
+}
+
+void AttachTextureVariants(TextureHandle handle, std::vector<SDL_Surface*>& variants, bool premultiplied)
+{
+    TextureRegistry& registry = GetTextureRegistry();
+    for (SDL_Surface* variant : variants)
+    {
+        if (handle.IsValid())
+        {
+            SDL_Texture* native = CreateTextureFromImage(variant, premultiplied);
+            if (native && !registry.RegisterVariant(handle, native).IsValid())
+            {
+                SDL_DestroyTexture(native);
+            }
+        }
+        SDL_DestroySurface(variant);
+    }
+    variants.clear();
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+void SetTextureVariantOptions(const TextureVariantOptions& options)
+{
+    std::lock_guard<std::mutex> lock(sMutex);
+    sOptions = options;
+}
+
+TextureVariantOptions GetTextureVariantOptions()
+{
+    std::lock_guard<std::mutex> lock(sMutex);
+    return sOptions;
+}
+
+DGEX_END
@@ -0,0 +1,75 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TextureVariantImpl.h                      *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Pre-scaled variants of textures for drawing them small.                    *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/TextureVariant.h"
+
+#include "Renderer/TextureRegistry.h"
+
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Average 2x2 blocks of 32-bit pixels into one.
+ *
+ * Channels are averaged separately with rounding, so any 32-bit format
+ * works. The result is half the size, rounded down but at least 1, and
+ * an odd last row or column is dropped.
+ *
+ * @param source Pixels to shrink.
+ * @param sourcePitch Bytes per row of the source.
+ * @param width Width of the source.
+ * @param height Height of the source.
+ * @param destination Receives the shrunk pixels.
+ * @param destinationPitch Bytes per row of the destination.
+ */
+void DownsampleBox(const void* source, int sourcePitch, int width, int height, void* destination,
+                   int destinationPitch);
+
+/**
+ * @brief Generate the variants of an image, see TextureVariantOptions.
+ *
+ * Thread safe, so that it can run on loader workers.
+ *
+ * @param surface Decoded image, left unchanged.
+ * @param variants Receives the variants, largest first, none if disabled.
+ */
+void CreateTextureVariantSurfaces(SDL_Surface* surface, std::vector<SDL_Surface*>& variants);
+
+/**
+ * @brief Upload variants and chain them to a texture.
+ *
+ * Must be called on the render thread. Surfaces are destroyed either way.
+ *
+ * @param handle Texture to attach to, invalid to only destroy them.
+ * @param variants Variants to upload, cleared.
+ * @param premultiplied Whether the pixels are premultiplied.
+ */
+void AttachTextureVariants(TextureHandle handle, std::vector<SDL_Surface*>& variants, bool premultiplied);
+
+/**
+ * @brief Get the name of the downsampling path, e.g. "SSE2".
+ */
+const char* GetDownsamplePath();
+
+DGEX_END
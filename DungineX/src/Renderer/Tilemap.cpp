@@ -0,0 +1,264 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Tilemap.cpp                               *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Grid of tiles in chunks, drawing only the visible chunks.                  *
+ ******************************************************************************/
+
+#include "Renderer/TilemapImpl.h"
+
+#include "Renderer/RenderApiImpl.h"
+#include "Renderer/RenderCommandImpl.h"
+
+#include "DgeX/Utils/Assert.h"
+
+#include <algorithm>
+#include <cmath>
+
+DGEX_BEGIN
+
+TilemapImpl::TilemapImpl(const TilemapDesc& desc)
+    : _desc(desc), _texture(), _chunkColumns(0), _chunkRows(0), _tilesetColumns(0), _tileCount(0), _u0(0.0f),
+      _v0(0.0f), _tileU(0.0f), _tileV(0.0f), _visibleCount(0), _rebuiltCount(0)
+{
+    DGEX_ASSERT(desc.Tileset.Texture, "Tilemap without tileset");
+    DGEX_ASSERT((desc.TileWidth > 0) && (desc.TileHeight > 0), "Tile size must be positive");
+    DGEX_ASSERT((desc.Width >= 0) && (desc.Height >= 0), "Tilemap size must not be negative");
+    DGEX_ASSERT(desc.ChunkSize > 0, "Chunk size must be positive");
+
+    const Ref<Texture>& texture = desc.Tileset.Texture;
+    _texture = texture->GetHandle();
+
+    Rect region = desc.Tileset.Region;
+    if ((region.Width <= 0) || (region.Height <= 0))
+    {
+        region = Rect(0, 0, texture->GetWidth(), texture->GetHeight());
+    }
+    _tilesetColumns = region.Width / desc.TileWidth;
+    _tileCount = _tilesetColumns * (region.Height / desc.TileHeight);
+
+    auto textureWidth = static_cast<float>(texture->GetWidth());
+    auto textureHeight = static_cast<float>(texture->GetHeight());
+    if ((textureWidth > 0.0f) && (textureHeight > 0.0f))
+    {
+        _u0 = static_cast<float>(region.X) / textureWidth;
+        _v0 = static_cast<float>(region.Y) / textureHeight;
+        _tileU = static_cast<float>(desc.TileWidth) / textureWidth;
+        _tileV = static_cast<float>(desc.TileHeight) / textureHeight;
+    }
+
+    _chunkColumns = (desc.Width + desc.ChunkSize - 1) / desc.ChunkSize;
+    _chunkRows = (desc.Height + desc.ChunkSize - 1) / desc.ChunkSize;
+}
+
+int TilemapImpl::AddLayer(int z)
+{
+    Layer& layer = _layers.emplace_back();
+    layer.Z = z;
+    layer.Chunks.resize(static_cast<size_t>(_chunkColumns) * _chunkRows);
+    for (Chunk& chunk : layer.Chunks)
+    {
+        chunk.Tiles.assign(static_cast<size_t>(_desc.ChunkSize) * _desc.ChunkSize, DGEX_EMPTY_TILE);
+    }
+
+    return static_cast<int>(_layers.size() - 1);
+}
+
+void TilemapImpl::SetTile(int layer, int x, int y, uint16_t tile)
+{
+    DGEX_ASSERT((layer >= 0) && (layer < static_cast<int>(_layers.size())), "Tilemap layer does not exist");
+    DGEX_ASSERT((x >= 0) && (x < _desc.Width) && (y >= 0) && (y < _desc.Height), "Tile outside the tilemap");
+    DGEX_ASSERT(tile <= _tileCount, "Tile outside the tileset");
+
+    Chunk& chunk = _layers[layer].Chunks[GetChunkIndex(x, y)];
+    uint16_t& slot = chunk.Tiles[GetTileIndex(x, y)];
+    if (slot != tile)
+    {
+        slot = tile;
+        chunk.Dirty = true;
+    }
+}
+
+uint16_t TilemapImpl::GetTile(int layer, int x, int y) const
+{
+    DGEX_ASSERT((layer >= 0) && (layer < static_cast<int>(_layers.size())), "Tilemap layer does not exist");
+
+    if ((x < 0) || (x >= _desc.Width) || (y < 0) || (y >= _desc.Height))
+    {
+        return DGEX_EMPTY_TILE;
+    }
+
+    const Chunk& chunk = _layers[layer].Chunks[GetChunkIndex(x, y)];
+    return chunk.Tiles[GetTileIndex(x, y)];
+}
+
+void TilemapImpl::Fill(int layer, const Rect& area, uint16_t tile)
+{
+    int minX = std::max(area.X, 0);
+    int minY = std::max(area.Y, 0);
+    int maxX = std::min(area.X + area.Width, _desc.Width);
+    int maxY = std::min(area.Y + area.Height, _desc.Height);
+    for (int y = minY; y < maxY; y++)
+    {
+        for (int x = minX; x < maxX; x++)
+        {
+            SetTile(layer, x, y, tile);
+        }
+    }
+}
+
+void TilemapImpl::Submit(const Rect& view)
+{
+    _visibleCount = 0;
+    _rebuiltCount = 0;
+
+    if ((view.Width <= 0) || (view.Height <= 0) || (_chunkColumns == 0) || (_chunkRows == 0))
+    {
+        return;
+    }
+
+    // Chunks touched by the view, clamped to the map.
+    auto chunkWidth = static_cast<float>(_desc.ChunkSize * _desc.TileWidth);
+    auto chunkHeight = static_cast<float>(_desc.ChunkSize * _desc.TileHeight);
+    auto left = static_cast<float>(view.X - _desc.X);
+    auto top = static_cast<float>(view.Y - _desc.Y);
+    int minX = std::max(static_cast<int>(std::floor(left / chunkWidth)), 0);
+    int minY = std::max(static_cast<int>(std::floor(top / chunkHeight)), 0);
+    int maxX = std::min(static_cast<int>(std::ceil((left + static_cast<float>(view.Width)) / chunkWidth)),
+                        _chunkColumns);
+    int maxY = std::min(static_cast<int>(std::ceil((top + static_cast<float>(view.Height)) / chunkHeight)),
+                        _chunkRows);
+
+    for (Layer& layer : _layers)
+    {
+        for (int y = minY; y < maxY; y++)
+        {
+            for (int x = minX; x < maxX; x++)
+            {
+                Chunk& chunk = layer.Chunks[static_cast<size_t>(y) * _chunkColumns + x];
+                if (chunk.Dirty)
+                {
+                    BuildChunk(chunk, x, y);
+                    _rebuiltCount++;
+                }
+                if (chunk.Vertices.empty())
+                {
+                    continue;
+                }
+
+                GeometryRenderCommand command{ { RenderCommandType::Geometry, layer.Z },
+                                               _texture,
+                                               chunk.Vertices.data(),
+                                               chunk.Indices.data(),
+                                               static_cast<int>(chunk.Vertices.size()),
+                                               static_cast<int>(chunk.Indices.size()),
+                                               static_cast<uint32_t>(chunk.Vertices.size() / 4) };
+                SubmitRenderCommand(command);
+                _visibleCount++;
+            }
+        }
+    }
+}
+
+int TilemapImpl::GetWidth() const
+{
+    return _desc.Width;
+}
+
+int TilemapImpl::GetHeight() const
+{
+    return _desc.Height;
+}
+
+int TilemapImpl::GetLayerCount() const
+{
+    return static_cast<int>(_layers.size());
+}
+
+size_t TilemapImpl::GetVisibleChunkCount() const
+{
+    return _visibleCount;
+}
+
+size_t TilemapImpl::GetRebuiltChunkCount() const
+{
+    return _rebuiltCount;
+}
+
+size_t TilemapImpl::GetChunkIndex(int x, int y) const
+{
+    int size = _desc.ChunkSize;
+    return static_cast<size_t>(y / size) * _chunkColumns + x / size;
+}
+
+size_t TilemapImpl::GetTileIndex(int x, int y) const
+{
+    int size = _desc.ChunkSize;
+    return static_cast<size_t>(y % size) * size + x % size;
+}
+
+void TilemapImpl::BuildChunk(Chunk& chunk, int chunkX, int chunkY) const
+{
+    chunk.Vertices.clear();
+    chunk.Indices.clear();
+    chunk.Dirty = false;
+
+    const SDL_FColor white{ 1.0f, 1.0f, 1.0f, 1.0f };
+    int size = _desc.ChunkSize;
+    auto tileWidth = static_cast<float>(_desc.TileWidth);
+    auto tileHeight = static_cast<float>(_desc.TileHeight);
+    float originX = static_cast<float>(_desc.X) + static_cast<float>(chunkX * size) * tileWidth;
+    float originY = static_cast<float>(_desc.Y) + static_cast<float>(chunkY * size) * tileHeight;
+
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            uint16_t tile = chunk.Tiles[static_cast<size_t>(y) * size + x];
+            if (tile == DGEX_EMPTY_TILE)
+            {
+                continue;
+            }
+
+            int index = tile - 1;
+            float u0 = _u0 + static_cast<float>(index % _tilesetColumns) * _tileU;
+            float v0 = _v0 + static_cast<float>(index / _tilesetColumns) * _tileV;
+            float u1 = u0 + _tileU;
+            float v1 = v0 + _tileV;
+            float x0 = originX + static_cast<float>(x) * tileWidth;
+            float y0 = originY + static_cast<float>(y) * tileHeight;
+            float x1 = x0 + tileWidth;
+            float y1 = y0 + tileHeight;
+
+            int first = static_cast<int>(chunk.Vertices.size());
+            chunk.Vertices.push_back({ { x0, y0 }, white, { u0, v0 } });
+            chunk.Vertices.push_back({ { x1, y0 }, white, { u1, v0 } });
+            chunk.Vertices.push_back({ { x1, y1 }, white, { u1, v1 } });
+            chunk.Vertices.push_back({ { x0, y1 }, white, { u0, v1 } });
+            chunk.Indices.insert(chunk.Indices.end(), { first, first + 1, first + 2, first + 2, first + 3, first });
+        }
+    }
+}
+
+// ============================================================================
+// API
+// ----------------------------------------------------------------------------
+
+Ref<Tilemap> CreateTilemap(const TilemapDesc& desc)
+{
+    return CreateRef<TilemapImpl>(desc);
+}
+
+DGEX_END
@@ -0,0 +1,96 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : TilemapImpl.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Grid of tiles in chunks, drawing only the visible chunks.                  *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Renderer/Tilemap.h"
+
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Tilemap with a chunk grid for each layer.
+ *
+ * Tiles of a layer are stored chunk by chunk, so that a chunk is one
+ * contiguous block, and so is its prepared geometry.
+ */
+class TilemapImpl final : public Tilemap
+{
+public:
+    explicit TilemapImpl(const TilemapDesc& desc);
+    ~TilemapImpl() override = default;
+
+    int AddLayer(int z) override;
+    void SetTile(int layer, int x, int y, uint16_t tile) override;
+    uint16_t GetTile(int layer, int x, int y) const override;
+    void Fill(int layer, const Rect& area, uint16_t tile) override;
+    void Submit(const Rect& view) override;
+    int GetWidth() const override;
+    int GetHeight() const override;
+    int GetLayerCount() const override;
+    size_t GetVisibleChunkCount() const override;
+    size_t GetRebuiltChunkCount() const override;
+
+private:
+    struct Chunk
+    {
+        std::vector<uint16_t> Tiles;      // ChunkSize * ChunkSize, row by row
+        std::vector<SDL_Vertex> Vertices; // 4 per non-empty tile
+        std::vector<int> Indices;         // 6 per non-empty tile
+        bool Dirty = false;               // tiles changed since last built
+    };
+
+    struct Layer
+    {
+        int Z;
+        std::vector<Chunk> Chunks; // row by row
+    };
+
+    // Index of the chunk of a tile, and of the tile in the chunk.
+    size_t GetChunkIndex(int x, int y) const;
+    size_t GetTileIndex(int x, int y) const;
+
+    /**
+     * @brief Prepare vertices of all non-empty tiles of a chunk.
+     */
+    void BuildChunk(Chunk& chunk, int chunkX, int chunkY) const;
+
+private:
+    TilemapDesc _desc;
+    TextureHandle _texture;
+
+    int _chunkColumns;   // number of chunks in a row of the map
+    int _chunkRows;      // number of chunks in a column of the map
+    int _tilesetColumns; // number of tiles in a row of the tileset
+    int _tileCount;      // number of tiles in the tileset
+
+    // Tileset region in texture coordinates.
+    float _u0, _v0;
+    float _tileU, _tileV; // size of a tile
+
+    std::vector<Layer> _layers;
+
+    size_t _visibleCount;
+    size_t _rebuiltCount;
+};
+
+DGEX_END
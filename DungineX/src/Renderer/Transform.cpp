@@ -0,0 +1,97 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Transform.cpp                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * 2D affine transform.                                                       *
+ ******************************************************************************/
+
+#include "DgeX/Renderer/Transform.h"
+
+#include "DgeX/Utils/Math.h"
+
+DGEX_BEGIN
+
+Transform::Transform() : A(1.0f), B(0.0f), C(0.0f), D(1.0f), X(0.0f), Y(0.0f)
+{
+}
+
+Transform::Transform(float a, float b, float c, float d, float x, float y) : A(a), B(b), C(c), D(d), X(x), Y(y)
+{
+}
+
+Transform Transform::Translation(float x, float y)
+{
+    return { 1.0f, 0.0f, 0.0f, 1.0f, x, y };
+}
+
+Transform Transform::Rotation(float degree)
+{
+    float radians = Math::ToRadians(degree);
+    float c = Math::Cos(radians);
+    float s = Math::Sin(radians);
+    return { c, s, -s, c, 0.0f, 0.0f };
+}
+
+Transform Transform::Scaling(float x, float y)
+{
+    return { x, 0.0f, 0.0f, y, 0.0f, 0.0f };
+}
+
+Transform Transform::Camera(float x, float y, float zoom, float degree, float viewWidth, float viewHeight)
+{
+    return Translation(viewWidth * 0.5f, viewHeight * 0.5f) * Rotation(degree) * Scaling(zoom, zoom) *
+           Translation(-x, -y);
+}
+
+bool Transform::IsIdentity() const
+{
+    return (A == 1.0f) && (B == 0.0f) && (C == 0.0f) && (D == 1.0f) && (X == 0.0f) && (Y == 0.0f);
+}
+
+bool Transform::IsAxisAligned() const
+{
+    return (B == 0.0f) && (C == 0.0f);
+}
+
+Transform Transform::Inverse() const
+{
+    float det = A * D - B * C;
+    if (det == 0.0f)
+    {
+        return {};
+    }
+
+    float inv = 1.0f / det;
+    float a = D * inv;
+    float b = -B * inv;
+    float c = -C * inv;
+    float d = A * inv;
+    return { a, b, c, d, -(a * X + c * Y), -(b * X + d * Y) };
+}
+
+Transform operator*(const Transform& lhs, const Transform& rhs)
+{
+    return { lhs.A * rhs.A + lhs.C * rhs.B,         lhs.B * rhs.A + lhs.D * rhs.B,
+             lhs.A * rhs.C + lhs.C * rhs.D,         lhs.B * rhs.C + lhs.D * rhs.D,
+             lhs.A * rhs.X + lhs.C * rhs.Y + lhs.X, lhs.B * rhs.X + lhs.D * rhs.Y + lhs.Y };
+}
+
+Transform& Transform::operator*=(const Transform& rhs)
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+DGEX_END
@@ -0,0 +1,105 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : LinearArena.cpp                           *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * A simple linear (bump) allocator. Memory is handed out sequentially from   *
+ * large blocks and released all at once with Reset, which keeps the blocks   *
+ * for reuse, so steady-state usage performs no heap allocation.              *
+ ******************************************************************************/
+
+#include "Utils/LinearArena.h"
+
+#include <cstdint>
+
+DGEX_BEGIN
+
+static size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+LinearArena::LinearArena(size_t blockSize) : _blockSize(blockSize), _current(0), _offset(0), _used(0)
+{
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+    // Try the current block and the following (already allocated) ones.
+    while (_current < _blocks.size())
+    {
+        Block& block = _blocks[_current];
+        auto base = reinterpret_cast<uintptr_t>(block.Data.get());
+        size_t offset = AlignUp(base + _offset, alignment) - base;
+        if (offset + size <= block.Size)
+        {
+            _offset = offset + size;
+            return block.Data.get() + offset;
+        }
+
+        _used += _offset;
+        _current++;
+        _offset = 0;
+    }
+
+    // Out of blocks, create a new one large enough for this request.
+    size_t blockSize = size + alignment > _blockSize ? size + alignment : _blockSize;
+    _blocks.push_back({ std::make_unique<unsigned char[]>(blockSize), blockSize });
+    _current = _blocks.size() - 1;
+
+    Block& block = _blocks[_current];
+    auto base = reinterpret_cast<uintptr_t>(block.Data.get());
+    size_t offset = AlignUp(base, alignment) - base;
+    _offset = offset + size;
+
+    return block.Data.get() + offset;
+}
+
+const char* LinearArena::CopyString(const char* str)
+{
+    if (!str)
+    {
+        return nullptr;
+    }
+
+    size_t length = std::strlen(str) + 1;
+    char* copy = static_cast<char*>(Allocate(length, 1));
+    std::memcpy(copy, str, length);
+
+    return copy;
+}
+
+void LinearArena::Reset()
+{
+    _current = 0;
+    _offset = 0;
+    _used = 0;
+}
+
+size_t LinearArena::GetUsedSize() const
+{
+    return _used + _offset;
+}
+
+size_t LinearArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (const Block& block : _blocks)
+    {
+        capacity += block.Size;
+    }
+    return capacity;
+}
+
+DGEX_END
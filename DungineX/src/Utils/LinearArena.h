@@ -0,0 +1,137 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : LinearArena.h                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * A simple linear (bump) allocator. Memory is handed out sequentially from   *
+ * large blocks and released all at once with Reset, which keeps the blocks   *
+ * for reuse, so steady-state usage performs no heap allocation.              *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Linear allocator for per-frame data.
+ *
+ * Only trivially copyable and trivially destructible objects should be
+ * placed in the arena, as no destructor will be called on Reset.
+ */
+class LinearArena
+{
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit LinearArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    LinearArena(const LinearArena& other) = delete;
+    LinearArena(LinearArena&& other) noexcept = default;
+    LinearArena& operator=(const LinearArena& other) = delete;
+    LinearArena& operator=(LinearArena&& other) noexcept = default;
+
+    ~LinearArena() = default;
+
+    /**
+     * @brief Allocate raw memory from the arena.
+     *
+     * @param size Size in bytes.
+     * @param alignment Alignment, must be a power of two.
+     * @return Pointer to the memory, valid until the next Reset.
+     */
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Copy an object into the arena.
+     *
+     * @param value The object to copy.
+     * @return Pointer to the copy, valid until the next Reset.
+     */
+    template <typename T> T* New(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        static_assert(std::is_trivially_destructible_v<T>, "T must be trivially destructible");
+
+        return new (Allocate(sizeof(T), alignof(T))) T(value);
+    }
+
+    /**
+     * @brief Copy an array of objects into the arena.
+     *
+     * @param values The objects to copy.
+     * @param count Number of objects.
+     * @return Pointer to the copy, valid until the next Reset.
+     */
+    template <typename T> T* NewArray(const T* values, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        static_assert(std::is_trivially_destructible_v<T>, "T must be trivially destructible");
+
+        T* data = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        if (count > 0)
+        {
+            std::memcpy(data, values, sizeof(T) * count);
+        }
+        return data;
+    }
+
+    /**
+     * @brief Copy a null-terminated string into the arena.
+     *
+     * @param str The string to copy, nullptr is kept as it is.
+     * @return The copied string, valid until the next Reset.
+     */
+    const char* CopyString(const char* str);
+
+    /**
+     * @brief Release all allocations at once.
+     *
+     * Blocks are kept, so that the next round of allocations of the same
+     * size will not touch the heap.
+     */
+    void Reset();
+
+    /**
+     * @brief Get bytes allocated since the last Reset.
+     */
+    size_t GetUsedSize() const;
+
+    /**
+     * @brief Get total bytes of all blocks owned by the arena.
+     */
+    size_t GetCapacity() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> Data;
+        size_t Size;
+    };
+
+    std::vector<Block> _blocks;
+    size_t _blockSize;
+    size_t _current; // index of the block in use
+    size_t _offset;  // offset in the current block
+    size_t _used;    // bytes used in previous blocks
+};
+
+DGEX_END
@@ -0,0 +1,66 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : MappedFile.h                              *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Read-only memory mapped files.                                             *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <string>
+
+DGEX_BEGIN
+
+/**
+ * @brief Map a whole file into memory for reading.
+ *
+ * Pages are read by the system on first touch, and shared with the file
+ * cache, so nothing is copied when the content is used as it is.
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) noexcept = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile& operator=(MappedFile&& other) noexcept = delete;
+
+    ~MappedFile();
+
+    /**
+     * @brief Map a file, closing the one mapped before.
+     *
+     * @param path Path to the file, in UTF-8.
+     * @return Whether the file is mapped, empty files cannot be.
+     */
+    bool Open(const std::string& path);
+
+    void Close();
+
+    const void* GetData() const;
+    size_t GetSize() const;
+
+private:
+    void* _file;    // HANDLE
+    void* _mapping; // HANDLE
+    const void* _data;
+    size_t _size;
+};
+
+DGEX_END
@@ -0,0 +1,205 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Qoi.cpp                                   *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * QOI compression of 32-bit pixels.                                          *
+ ******************************************************************************/
+
+#include "Utils/Qoi.h"
+
+#include <cstring>
+
+DGEX_BEGIN
+
+static constexpr uint8_t QOI_OP_INDEX = 0x00; // 00xxxxxx
+static constexpr uint8_t QOI_OP_DIFF = 0x40;  // 01xxxxxx
+static constexpr uint8_t QOI_OP_LUMA = 0x80;  // 10xxxxxx
+static constexpr uint8_t QOI_OP_RUN = 0xC0;   // 11xxxxxx
+static constexpr uint8_t QOI_OP_RGB = 0xFE;
+static constexpr uint8_t QOI_OP_RGBA = 0xFF;
+static constexpr uint8_t QOI_MASK = 0xC0;
+static constexpr int QOI_MAX_RUN = 62;
+
+namespace
+{
+
+struct QoiPixel
+{
+    uint8_t C[4]; // the last one is alpha for QOI, whatever it really is
+
+    bool operator==(const QoiPixel& other) const
+    {
+        return std::memcmp(C, other.C, 4) == 0;
+    }
+};
+
+int QoiHash(const QoiPixel& pixel)
+{
+    return (pixel.C[0] * 3 + pixel.C[1] * 5 + pixel.C[2] * 7 + pixel.C[3] * 11) % 64;
+}
+
+} // namespace
+
+void QoiEncode(const uint8_t* pixels, size_t count, std::vector<uint8_t>& output)
+{
+    QoiPixel index[64] = {};
+    QoiPixel previous{ { 0, 0, 0, 255 } };
+    int run = 0;
+
+    // Worst case is 5 bytes per pixel.
+    output.reserve(output.size() + count * 5);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        QoiPixel pixel;
+        std::memcpy(pixel.C, pixels + i * 4, 4);
+
+        if (pixel == previous)
+        {
+            run++;
+            if ((run == QOI_MAX_RUN) || (i == count - 1))
+            {
+                output.push_back(static_cast<uint8_t>(QOI_OP_RUN | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            output.push_back(static_cast<uint8_t>(QOI_OP_RUN | (run - 1)));
+            run = 0;
+        }
+
+        int hash = QoiHash(pixel);
+        if (index[hash] == pixel)
+        {
+            output.push_back(static_cast<uint8_t>(QOI_OP_INDEX | hash));
+        }
+        else
+        {
+            index[hash] = pixel;
+
+            if (pixel.C[3] == previous.C[3])
+            {
+                // Differences wrap around, as in the decoder.
+                auto dr = static_cast<int8_t>(pixel.C[0] - previous.C[0]);
+                auto dg = static_cast<int8_t>(pixel.C[1] - previous.C[1]);
+                auto db = static_cast<int8_t>(pixel.C[2] - previous.C[2]);
+                int drg = dr - dg;
+                int dbg = db - dg;
+
+                if ((dr > -3) && (dr < 2) && (dg > -3) && (dg < 2) && (db > -3) && (db < 2))
+                {
+                    output.push_back(static_cast<uint8_t>(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                }
+                else if ((drg > -9) && (drg < 8) && (dg > -33) && (dg < 32) && (dbg > -9) && (dbg < 8))
+                {
+                    output.push_back(static_cast<uint8_t>(QOI_OP_LUMA | (dg + 32)));
+                    output.push_back(static_cast<uint8_t>((drg + 8) << 4 | (dbg + 8)));
+                }
+                else
+                {
+                    output.push_back(QOI_OP_RGB);
+                    output.insert(output.end(), pixel.C, pixel.C + 3);
+                }
+            }
+            else
+            {
+                output.push_back(QOI_OP_RGBA);
+                output.insert(output.end(), pixel.C, pixel.C + 4);
+            }
+        }
+
+        previous = pixel;
+    }
+}
+
+bool QoiDecode(const uint8_t* data, size_t size, uint8_t* pixels, size_t count)
+{
+    QoiPixel index[64] = {};
+    QoiPixel pixel{ { 0, 0, 0, 255 } };
+    size_t offset = 0;
+    int run = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (run > 0)
+        {
+            run--;
+        }
+        else
+        {
+            if (offset >= size)
+            {
+                return false;
+            }
+
+            uint8_t op = data[offset++];
+            if (op == QOI_OP_RGB)
+            {
+                if (offset + 3 > size)
+                {
+                    return false;
+                }
+                std::memcpy(pixel.C, data + offset, 3);
+                offset += 3;
+            }
+            else if (op == QOI_OP_RGBA)
+            {
+                if (offset + 4 > size)
+                {
+                    return false;
+                }
+                std::memcpy(pixel.C, data + offset, 4);
+                offset += 4;
+            }
+            else if ((op & QOI_MASK) == QOI_OP_INDEX)
+            {
+                pixel = index[op];
+            }
+            else if ((op & QOI_MASK) == QOI_OP_DIFF)
+            {
+                pixel.C[0] = static_cast<uint8_t>(pixel.C[0] + ((op >> 4) & 0x03) - 2);
+                pixel.C[1] = static_cast<uint8_t>(pixel.C[1] + ((op >> 2) & 0x03) - 2);
+                pixel.C[2] = static_cast<uint8_t>(pixel.C[2] + (op & 0x03) - 2);
+            }
+            else if ((op & QOI_MASK) == QOI_OP_LUMA)
+            {
+                if (offset >= size)
+                {
+                    return false;
+                }
+                uint8_t next = data[offset++];
+                int dg = (op & 0x3F) - 32;
+                pixel.C[0] = static_cast<uint8_t>(pixel.C[0] + dg - 8 + ((next >> 4) & 0x0F));
+                pixel.C[1] = static_cast<uint8_t>(pixel.C[1] + dg);
+                pixel.C[2] = static_cast<uint8_t>(pixel.C[2] + dg - 8 + (next & 0x0F));
+            }
+            else // QOI_OP_RUN
+            {
+                run = op & 0x3F;
+            }
+
+            index[QoiHash(pixel)] = pixel;
+        }
+
+        std::memcpy(pixels + i * 4, pixel.C, 4);
+    }
+
+    return true;
+}
+
+DGEX_END
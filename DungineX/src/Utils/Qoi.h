@@ -0,0 +1,58 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Qoi.h                                     *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * QOI compression of 32-bit pixels.                                          *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+DGEX_BEGIN
+
+/**
+ * @brief Compress 32-bit pixels with the QOI operations.
+ *
+ * Only the chunk stream is produced, without the QOI header and end
+ * marker, since the texture file has its own header. The four bytes of a
+ * pixel are taken as they are, so any 32-bit format works as long as
+ * decoding uses the same one. It compresses about as well as PNG, but
+ * decodes several times faster.
+ *
+ * Reference: https://qoiformat.org/qoi-specification.pdf
+ *
+ * @param pixels Tightly packed pixels.
+ * @param count Number of pixels.
+ * @param output Receives the compressed stream, appended.
+ */
+void QoiEncode(const uint8_t* pixels, size_t count, std::vector<uint8_t>& output);
+
+/**
+ * @brief Decompress a stream made by QoiEncode.
+ *
+ * @param data The compressed stream.
+ * @param size Size of the stream.
+ * @param pixels Receives tightly packed pixels.
+ * @param count Number of pixels to decode.
+ * @return False if the stream is too short.
+ */
+bool QoiDecode(const uint8_t* data, size_t size, uint8_t* pixels, size_t count);
+
+DGEX_END
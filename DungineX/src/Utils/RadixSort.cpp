@@ -0,0 +1,106 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RadixSort.cpp                             *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Stable LSD radix sort for 64-bit keys.                                     *
+ ******************************************************************************/
+
+#include "Utils/RadixSort.h"
+
+#include <cstring>
+#include <utility>
+
+DGEX_BEGIN
+
+static constexpr int RADIX_BITS = 8;
+static constexpr int RADIX_SIZE = 1 << RADIX_BITS;
+static constexpr int RADIX_PASSES = 64 / RADIX_BITS;
+
+// Below this, insertion sort is faster than building histograms.
+static constexpr size_t INSERTION_SORT_THRESHOLD = 32;
+
+static void InsertionSort(SortKeyEntry* entries, size_t count)
+{
+    for (size_t i = 1; i < count; i++)
+    {
+        SortKeyEntry entry = entries[i];
+        size_t j = i;
+        // Strictly greater keeps it stable.
+        while (j > 0 && entries[j - 1].Key > entry.Key)
+        {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+    }
+}
+
+void RadixSort(SortKeyEntry* entries, SortKeyEntry* scratch, size_t count)
+{
+    if (count < INSERTION_SORT_THRESHOLD)
+    {
+        InsertionSort(entries, count);
+        return;
+    }
+
+    // Build histograms for all passes at once, to read the keys only once.
+    static thread_local size_t histograms[RADIX_PASSES][RADIX_SIZE];
+    std::memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t key = entries[i].Key;
+        for (int pass = 0; pass < RADIX_PASSES; pass++)
+        {
+            histograms[pass][(key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+        }
+    }
+
+    SortKeyEntry* src = entries;
+    SortKeyEntry* dst = scratch;
+    for (int pass = 0; pass < RADIX_PASSES; pass++)
+    {
+        int shift = pass * RADIX_BITS;
+        size_t* histogram = histograms[pass];
+
+        // All keys share this byte, nothing to do.
+        if (histogram[(src[0].Key >> shift) & (RADIX_SIZE - 1)] == count)
+        {
+            continue;
+        }
+
+        // Turn counts into starting offsets.
+        size_t offset = 0;
+        for (int i = 0; i < RADIX_SIZE; i++)
+        {
+            size_t bucket = histogram[i];
+            histogram[i] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            dst[histogram[(src[i].Key >> shift) & (RADIX_SIZE - 1)]++] = src[i];
+        }
+
+        std::swap(src, dst);
+    }
+
+    if (src != entries)
+    {
+        std::memcpy(entries, src, count * sizeof(SortKeyEntry));
+    }
+}
+
+DGEX_END
@@ -0,0 +1,53 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : RadixSort.h                               *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Stable LSD radix sort for 64-bit keys.                                     *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+DGEX_BEGIN
+
+/**
+ * @brief A 64-bit sort key with the index of the item it stands for.
+ *
+ * Items themselves are never moved, only these small entries.
+ */
+struct SortKeyEntry
+{
+    uint64_t Key;
+    uint32_t Index;
+};
+
+/**
+ * @brief Sort entries by key in ascending order.
+ *
+ * This is a stable least significant digit radix sort, one byte per pass.
+ * Passes on bytes that are the same for all keys are skipped, so unused
+ * high bits of the keys cost nothing.
+ *
+ * @param entries Entries to sort, sorted in place.
+ * @param scratch Scratch buffer with at least count entries.
+ * @param count Number of entries.
+ */
+void RadixSort(SortKeyEntry* entries, SortKeyEntry* scratch, size_t count);
+
+DGEX_END
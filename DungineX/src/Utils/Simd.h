@@ -0,0 +1,47 @@
+/******************************************************************************
+ ***                   N E W  D E S I R E  S T U D I O S                    ***
+ ******************************************************************************
+ *                   Project Name : DungineX                                  *
+ *                                                                            *
+ *                      File Name : Simd.h                                    *
+ *                                                                            *
+ *                     Programmer : Tony S.                                   *
+ *                                                                            *
+ *                     Start Date : October 17, 2026                          *
+ *                                                                            *
+ *                    Last Update : October 17, 2026                          *
+ *                                                                            *
+ * -------------------------------------------------------------------------- *
+ * OVERVIEW:                                                                  *
+ *                                                                            *
+ * Build time selection of SIMD instruction set.                              *
+ ******************************************************************************/
+
+#pragma once
+
+#include "DgeX/Defines.h"
+
+// ============================================================================
+// Instruction Set
+// ----------------------------------------------------------------------------
+// Exactly one of DGEX_SIMD_AVX2, DGEX_SIMD_SSE2, DGEX_SIMD_NEON and
+// DGEX_SIMD_SCALAR is defined. AVX2 is only used if the compiler is told
+// so, see DGEX_ENABLE_AVX2 in CMake. SSE2 is always there on x64.
+// ----------------------------------------------------------------------------
+
+#if defined(__AVX2__)
+#define DGEX_SIMD_AVX2
+#define DGEX_SIMD_NAME "AVX2"
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define DGEX_SIMD_SSE2
+#define DGEX_SIMD_NAME "SSE2"
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define DGEX_SIMD_NEON
+#define DGEX_SIMD_NAME "NEON"
+#include <arm_neon.h>
+#else
+#define DGEX_SIMD_SCALAR
+#define DGEX_SIMD_NAME "Scalar"
+#endif
@@ -0,0 +1,106 @@
+#include "doctest/doctest.h"
+
+#include "Device/Graphics/DamageTracker.h"
+
+using namespace DgeX;
+
+static bool IsSameRect(const SDL_Rect& a, const SDL_Rect& b)
+{
+    return (a.x == b.x) && (a.y == b.y) && (a.w == b.w) && (a.h == b.h);
+}
+
+TEST_CASE("DamageTracker Test")
+{
+    const SDL_Rect target{ 0, 0, 640, 480 };
+    DamageTracker tracker(4);
+
+    // Nothing to compare with on the first frame.
+    tracker.Add(1, { 10, 10, 20, 20 });
+    tracker.Add(2, { 100, 100, 20, 20 });
+    tracker.Resolve(target);
+    REQUIRE_EQ(tracker.GetRects().size(), 1);
+    CHECK(IsSameRect(tracker.GetRects()[0], target));
+
+    SUBCASE("Unchanged")
+    {
+        // Order does not matter.
+        tracker.Add(2, { 100, 100, 20, 20 });
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Resolve(target);
+        CHECK(tracker.GetRects().empty());
+    }
+
+    SUBCASE("Changed")
+    {
+        // Moved, both where it was and where it is now.
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(3, { 300, 100, 20, 20 });
+        tracker.Resolve(target);
+        CHECK_EQ(tracker.GetRects().size(), 2);
+
+        // Removed, and clipped to the target.
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(1, { -10, -10, 20, 20 });
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 2);
+
+        // Touching rects are merged.
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 1);
+        CHECK(IsSameRect(tracker.GetRects()[0], { 0, 0, 10, 10 }));
+
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(4, { 30, 10, 20, 20 });
+        tracker.Add(5, { 50, 10, 20, 20 });
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 1);
+        CHECK(IsSameRect(tracker.GetRects()[0], { 30, 10, 40, 20 }));
+    }
+
+    SUBCASE("Swapped")
+    {
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(2, { 100, 100, 20, 20 });
+        tracker.Add(3, { 200, 200, 20, 20 });
+        tracker.Add(4, { 210, 210, 20, 20 });
+        tracker.Resolve(target);
+
+        // Overlapping ones swapped, only one of them is damaged.
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(2, { 100, 100, 20, 20 });
+        tracker.Add(4, { 210, 210, 20, 20 });
+        tracker.Add(3, { 200, 200, 20, 20 });
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 1);
+        CHECK(IsSameRect(tracker.GetRects()[0], { 210, 210, 20, 20 }));
+
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(2, { 100, 100, 20, 20 });
+        tracker.Add(4, { 210, 210, 20, 20 });
+        tracker.Add(3, { 200, 200, 20, 20 });
+        tracker.Resolve(target);
+        CHECK(tracker.GetRects().empty());
+    }
+
+    SUBCASE("Too many")
+    {
+        for (int i = 0; i < 6; i++)
+        {
+            tracker.Add(10 + i, { i * 100, i * 50, 10, 10 });
+        }
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 1);
+        CHECK(IsSameRect(tracker.GetRects()[0], { 0, 0, 510, 260 }));
+    }
+
+    SUBCASE("Invalidate")
+    {
+        tracker.Invalidate();
+        tracker.Add(1, { 10, 10, 20, 20 });
+        tracker.Add(2, { 100, 100, 20, 20 });
+        tracker.Resolve(target);
+        REQUIRE_EQ(tracker.GetRects().size(), 1);
+        CHECK(IsSameRect(tracker.GetRects()[0], target));
+    }
+}
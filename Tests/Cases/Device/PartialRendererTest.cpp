@@ -0,0 +1,98 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
+
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+using namespace DgeX;
+
+// ABGR8888 keeps R in the low byte.
+static uint32_t Pack(uint8_t r, uint8_t g, uint8_t b)
+{
+    return 0xFF000000u | static_cast<uint32_t>(b) << 16 | static_cast<uint32_t>(g) << 8 | r;
+}
+
+static uint32_t ReadPixel(const SoftwareRenderer& software, int x, int y)
+{
+    SDL_FlushRenderer(software.Renderer);
+    const auto* row = static_cast<const uint8_t*>(software.Surface->pixels) + y * software.Surface->pitch;
+    return reinterpret_cast<const uint32_t*>(row)[x];
+}
+
+static void DrawFrame(const Ref<Renderer>& renderer, const Ref<Texture>& sprite, int x, int y)
+{
+    SetClearColor(255, 0, 0);
+    ClearDevice();
+    DrawTexture(sprite, x, y);
+    renderer->Render();
+}
+
+TEST_CASE("PartialRenderer Test")
+{
+    SoftwareRenderer software;
+    REQUIRE_EQ(InitRenderer(software.Renderer), DGEX_SUCCESS);
+
+    const uint32_t red = Pack(255, 0, 0);
+    const uint32_t green = Pack(0, 255, 0);
+
+    {
+        SDL_Texture* native =
+            SDL_CreateTexture(software.Renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        std::vector<uint32_t> pixels(8 * 8, green);
+        SDL_UpdateTexture(native, nullptr, pixels.data(), 8 * 4);
+        auto sprite = CreateRef<Texture>(native);
+
+        Ref<Renderer> renderer = CreateRenderer({ false, false, true });
+        SetCurrentRenderer(renderer);
+        SetViewCulling(false);
+
+        // Everything is drawn on the first frame.
+        DrawFrame(renderer, sprite, 8, 8);
+        CHECK_EQ(renderer->GetStatistics().DamagedPixelCount, 64 * 64);
+        CHECK_EQ(ReadPixel(software, 12, 12), green);
+        CHECK_EQ(ReadPixel(software, 40, 40), red);
+
+        SUBCASE("Moved sprite")
+        {
+            DrawFrame(renderer, sprite, 40, 40);
+            CHECK_EQ(ReadPixel(software, 12, 12), red);
+            CHECK_EQ(ReadPixel(software, 44, 44), green);
+            CHECK_EQ(ReadPixel(software, 0, 63), red);
+
+            // Only where it was and where it is, clipped to those rects.
+            const RendererStatistics& statistics = renderer->GetStatistics();
+            CHECK_EQ(statistics.DamagedRectCount, 2);
+            CHECK_EQ(statistics.DamagedPixelCount, 2 * 10 * 10);
+
+            DrawFrame(renderer, sprite, 40, 40);
+            CHECK_EQ(renderer->GetStatistics().DamagedRectCount, 0);
+            CHECK_EQ(ReadPixel(software, 44, 44), green);
+        }
+        SUBCASE("Resized target")
+        {
+            // The back buffer follows the target, and is drawn again.
+            Ref<Texture> target = CreateTexture(32, 32);
+            GetRenderStateCache().SetRenderTarget(target->GetNativeTexture());
+            DrawFrame(renderer, sprite, 8, 8);
+            CHECK_EQ(renderer->GetStatistics().DamagedPixelCount, 32 * 32);
+            GetRenderStateCache().SetRenderTarget(nullptr);
+
+            DrawFrame(renderer, sprite, 8, 8);
+            CHECK_EQ(renderer->GetStatistics().DamagedPixelCount, 64 * 64);
+            CHECK_EQ(ReadPixel(software, 12, 12), green);
+        }
+
+        SetCurrentRenderer(nullptr);
+    }
+
+    DestroyRenderer();
+    software.Renderer = nullptr; // destroyed with the renderer context
+}
@@ -0,0 +1,84 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Device/Graphics/RenderStateCache.h"
+
+#include <SDL3/SDL.h>
+
+TEST_CASE("RenderStateCache Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_TARGET, 8, 8);
+    REQUIRE(texture);
+
+    DgeX::RenderStateCache cache(renderer);
+
+    SUBCASE("Draw state")
+    {
+        cache.SetDrawColor(1, 2, 3, 4);
+        cache.SetDrawColor(1, 2, 3, 4);
+        cache.SetDrawBlendMode(SDL_BLENDMODE_BLEND);
+        cache.SetDrawBlendMode(SDL_BLENDMODE_BLEND);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 2);
+        CHECK_EQ(cache.GetStatistics().ElidedCount, 2);
+
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+        CHECK_EQ(b, 3);
+
+        cache.InvalidateDrawState();
+        cache.SetDrawColor(1, 2, 3, 4);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 3);
+    }
+
+    SUBCASE("Texture state")
+    {
+        cache.SetTextureAlphaMod(texture, 128);
+        cache.SetTextureAlphaMod(texture, 128);
+        // Color mod is tracked apart from alpha mod.
+        cache.SetTextureColorMod(texture, 255, 255, 255);
+        cache.SetTextureColorMod(texture, 255, 255, 255);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 2);
+        CHECK_EQ(cache.GetStatistics().ElidedCount, 2);
+
+        cache.ForgetTexture(texture);
+        cache.SetTextureAlphaMod(texture, 128);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 3);
+    }
+
+    SUBCASE("Target state")
+    {
+        SDL_Rect viewport{ 0, 0, 4, 4 };
+        cache.SetRenderTarget(texture);
+        cache.SetViewport(&viewport);
+        cache.SetViewport(&viewport);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 2);
+
+        // Viewport belongs to the target.
+        cache.SetRenderTarget(nullptr);
+        cache.SetViewport(&viewport);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 4);
+
+        cache.SetClipRect(nullptr);
+        cache.SetClipRect(nullptr);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 5);
+        CHECK_EQ(cache.GetStatistics().ElidedCount, 2);
+
+        // An empty rect is not the same as none.
+        SDL_Rect empty{ 0, 0, 0, 0 };
+        cache.SetClipRect(&empty);
+        cache.SetClipRect(&empty);
+        cache.SetClipRect(nullptr);
+        cache.SetViewport(nullptr);
+        cache.SetViewport(&empty);
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 9);
+        CHECK_EQ(cache.GetStatistics().ElidedCount, 3);
+
+        cache.ResetStatistics();
+        CHECK_EQ(cache.GetStatistics().IssuedCount, 0);
+    }
+
+    SDL_DestroyTexture(texture);
+}
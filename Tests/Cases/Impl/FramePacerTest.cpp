@@ -0,0 +1,87 @@
+#include "doctest/doctest.h"
+
+#include "Impl/FramePacer.h"
+
+using namespace DgeX;
+
+TEST_CASE("FramePacer Test")
+{
+    // Power of two ticks, so that times are exact.
+    const uint64_t frequency = 1024;
+
+    SUBCASE("Frame time")
+    {
+        FramePacer pacer(frequency, 0, 0.0, 5);
+        CHECK_EQ(pacer.BeginFrame(1000), 0);
+        CHECK_EQ(pacer.GetFrameTime(), 0.0);
+        CHECK_EQ(pacer.GetDeadline(), 0);
+
+        pacer.BeginFrame(1016);
+        pacer.BeginFrame(1032);
+        pacer.BeginFrame(1080);
+        CHECK_EQ(pacer.GetLastFrameTime(), 48.0 / 1024);
+        CHECK_EQ(pacer.GetFrameTime(), 80.0 / 3 / 1024);
+
+        // Only the last frames count.
+        uint64_t counter = 1080;
+        for (int i = 0; i < 16; i++)
+        {
+            counter += 32;
+            pacer.BeginFrame(counter);
+        }
+        CHECK_EQ(pacer.GetFrameTime(), 32.0 / 1024);
+
+        // Long frame is clamped.
+        pacer.BeginFrame(counter + 4096);
+        CHECK_EQ(pacer.GetLastFrameTime(), 0.25);
+    }
+
+    SUBCASE("Frame limit")
+    {
+        FramePacer pacer(frequency, 64, 0.0, 5);
+        pacer.BeginFrame(1000);
+        CHECK_EQ(pacer.GetDeadline(), 1016);
+
+        // A late frame is made up by the next.
+        pacer.BeginFrame(1020);
+        CHECK_EQ(pacer.GetDeadline(), 1032);
+
+        // Too late to catch up.
+        pacer.BeginFrame(1100);
+        CHECK_EQ(pacer.GetDeadline(), 1116);
+
+        // Changed from the next frame, e.g. on another display.
+        pacer.SetTargetFrameRate(32);
+        pacer.BeginFrame(1116);
+        CHECK_EQ(pacer.GetDeadline(), 1148);
+
+        pacer.SetTargetFrameRate(0);
+        CHECK_EQ(pacer.GetDeadline(), 0);
+        pacer.BeginFrame(1148);
+        CHECK_EQ(pacer.GetDeadline(), 0);
+    }
+
+    SUBCASE("Fixed timestep")
+    {
+        FramePacer pacer(frequency, 0, 1.0 / 64, 3);
+        CHECK_EQ(pacer.BeginFrame(0), 0);
+
+        CHECK_EQ(pacer.BeginFrame(40), 2);
+        CHECK_EQ(pacer.GetInterpolationAlpha(), 0.5);
+
+        CHECK_EQ(pacer.BeginFrame(48), 1);
+        CHECK_EQ(pacer.GetInterpolationAlpha(), 0.0);
+
+        CHECK_EQ(pacer.BeginFrame(52), 0);
+        CHECK_EQ(pacer.GetInterpolationAlpha(), 0.25);
+
+        // Too many to run, the rest is dropped.
+        CHECK_EQ(pacer.BeginFrame(252), 3);
+        CHECK_EQ(pacer.GetInterpolationAlpha(), 0.75);
+
+        FramePacer variable(frequency, 0, 0.0, 3);
+        variable.BeginFrame(0);
+        CHECK_EQ(variable.BeginFrame(40), 0);
+        CHECK_EQ(variable.GetInterpolationAlpha(), 1.0);
+    }
+}
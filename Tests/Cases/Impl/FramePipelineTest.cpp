@@ -0,0 +1,181 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Impl/FramePipeline.h"
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/RenderApiImpl.h"
+#include "Renderer/RenderCommandImpl.h"
+#include "Utils/LinearArena.h"
+
+#include "DgeX/MainLoop.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Tilemap.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace DgeX;
+
+/**
+ * Keeps commands like a deferred renderer, to be read after the hand-off.
+ */
+struct RecordedFrame : CommandSink
+{
+    LinearArena Arena;
+    std::vector<RenderCommand*> Commands;
+
+    void Record(const RenderCommand& command) override
+    {
+        Commands.push_back(CopyRenderCommand(Arena, command));
+    }
+};
+
+static int sFrame = 0;
+static int sFixedFrame = 0;
+static int sEventCount = 0;
+static std::atomic<bool> sUpdating{ false };
+static std::atomic<bool> sOverlapped{ false };
+static std::atomic<bool> sOnSimulationThread{ false };
+static std::atomic<bool> sRecordedCurrent{ false };
+
+static bool OnFixedUpdate()
+{
+    sFixedFrame++;
+    return false;
+}
+
+static bool OnUpdate()
+{
+    sUpdating = true;
+    sOnSimulationThread = IsSimulationThread();
+    sRecordedCurrent = GetCurrentRenderer() != nullptr;
+
+    // Render API settings are per thread.
+    SetViewCulling(false);
+
+    sFrame++;
+    PointRenderCommand point{ { RenderCommandType::Point, sFrame }, static_cast<float>(sFrame), 0.0f, Color::White };
+    SubmitRenderCommand(point);
+
+    sUpdating = false;
+    return sFrame == 3;
+}
+
+static Ref<Tilemap> sTilemap;
+
+// Changes tiles every frame, so chunk vertices are rebuilt and grow.
+static bool OnTilemapUpdate()
+{
+    SetViewCulling(false);
+
+    sFrame++;
+    for (int x = 0; x < sFrame; x++)
+    {
+        sTilemap->SetTile(0, x, 0, static_cast<uint16_t>(sFrame));
+    }
+    sTilemap->Submit(Rect(0, 0, 64, 64));
+
+    return false;
+}
+
+static void OnEvent()
+{
+    if (sUpdating)
+    {
+        sOverlapped = true;
+    }
+    sEventCount++;
+}
+
+TEST_CASE("FramePipeline Test")
+{
+    sFrame = 0;
+    sFixedFrame = 0;
+    sEventCount = 0;
+
+    RecordedFrame frames[2];
+    Ref<Renderer> first = CreateRef<CommandRecorder>(frames[0]);
+    Ref<Renderer> second = CreateRef<CommandRecorder>(frames[1]);
+
+    SUBCASE("Hand-off")
+    {
+        FramePipeline pipeline(first, second, OnUpdate, OnFixedUpdate);
+        CHECK_FALSE(IsSimulationThread());
+
+        pipeline.Start(2);
+        CHECK_FALSE(pipeline.HandOff(2, OnEvent));
+        CHECK_EQ(pipeline.GetRecorded().get(), first.get());
+        CHECK(sOnSimulationThread);
+        CHECK(sRecordedCurrent);
+        CHECK_EQ(sFixedFrame, 2);
+        CHECK_EQ(sEventCount, 2);
+
+        // Renderers take turns.
+        pipeline.Start(0);
+        CHECK_FALSE(pipeline.HandOff(1, OnEvent));
+        CHECK_EQ(pipeline.GetRecorded().get(), second.get());
+        CHECK_EQ(sFixedFrame, 2);
+        CHECK_EQ(sEventCount, 3);
+        CHECK_FALSE(sOverlapped);
+
+        REQUIRE_EQ(frames[0].Commands.size(), 1);
+        REQUIRE_EQ(frames[1].Commands.size(), 1);
+        CHECK_EQ(frames[0].Commands[0]->Order, 1);
+        CHECK_EQ(frames[1].Commands[0]->Order, 2);
+
+        // Quit asked by the update.
+        pipeline.Start(0);
+        CHECK(pipeline.HandOff(0, OnEvent));
+        CHECK_EQ(pipeline.GetRecorded().get(), first.get());
+        CHECK_EQ(frames[0].Commands.size(), 2);
+    }
+    SUBCASE("Geometry of the frame rendered")
+    {
+        SoftwareRenderer software;
+        SDL_Texture* native =
+            SDL_CreateTexture(software.Renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 32, 32);
+        auto texture = CreateRef<Texture>(native);
+
+        TilemapDesc desc;
+        desc.Tileset = { texture, Rect(0, 0, 32, 32) };
+        desc.TileWidth = 8;
+        desc.TileHeight = 8;
+        desc.Width = 4;
+        desc.Height = 4;
+        desc.ChunkSize = 4;
+        sTilemap = CreateTilemap(desc);
+        sTilemap->AddLayer(0);
+
+        FramePipeline pipeline(first, second, OnTilemapUpdate, nullptr);
+        pipeline.Start(0);
+        pipeline.HandOff(0, OnEvent);
+        REQUIRE_EQ(frames[0].Commands.size(), 1);
+        REQUIRE_EQ(frames[0].Commands[0]->Type, RenderCommandType::Geometry);
+        const auto* geometry = static_cast<const GeometryRenderCommand*>(frames[0].Commands[0]);
+        CHECK(geometry->Transient);
+        REQUIRE_EQ(geometry->VertexCount, 4);
+        std::vector<SDL_Vertex> expected(geometry->Vertices, geometry->Vertices + geometry->VertexCount);
+
+        // Frame 1 is read while frame 2 rewrites the chunk, which must not
+        // touch what was recorded.
+        pipeline.Start(0);
+        bool same = true;
+        for (int i = 0; i < 1000; i++)
+        {
+            same &= std::memcmp(geometry->Vertices, expected.data(), expected.size() * sizeof(SDL_Vertex)) == 0;
+        }
+        pipeline.HandOff(0, OnEvent);
+        CHECK(same);
+        CHECK_EQ(std::memcmp(geometry->Vertices, expected.data(), expected.size() * sizeof(SDL_Vertex)), 0);
+
+        REQUIRE_EQ(frames[1].Commands.size(), 1);
+        const auto* next = static_cast<const GeometryRenderCommand*>(frames[1].Commands[0]);
+        CHECK_EQ(next->VertexCount, 8);
+        CHECK_NE(next->Vertices[0].tex_coord.x, expected[0].tex_coord.x);
+
+        sTilemap = nullptr;
+        texture->Destroy(); // native texture goes with the renderer
+    }
+}
@@ -0,0 +1,153 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/RenderApiImpl.h"
+#include "Renderer/RenderCommandImpl.h"
+
+#include "DgeX/Renderer/CommandList.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
+
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+using namespace DgeX;
+
+struct CaptureSink : CommandSink
+{
+    void Record(const RenderCommand& command) override
+    {
+        Commands.push_back(&command);
+        Orders.push_back(command.Order);
+    }
+
+    std::vector<const RenderCommand*> Commands; // only alive until replayed with a transform
+    std::vector<int> Orders;
+};
+
+TEST_CASE("CommandList Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+    SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    REQUIRE(native);
+    auto texture = CreateRef<Texture>(native);
+
+    SUBCASE("Record order")
+    {
+        auto list = CreateCommandList({ false, false });
+        CHECK_FALSE(list->IsValid());
+        {
+            RECORD_COMMAND_LIST(list);
+            DrawTexture(texture, 0, 0);
+            DrawTexture(texture, 8, 0);
+            DrawPoint(1, 1);
+            DrawTexture(texture, 16, 0);
+            DrawTexture(texture, 24, 0, 1); // different z breaks the run
+        }
+        CHECK(list->IsValid());
+        CHECK_EQ(list->GetRecordedCount(), 5);
+        CHECK_EQ(list->GetBakedCount(), 4);
+
+        // Recording does not leak into the current renderer.
+        CHECK_EQ(GetCurrentRenderer(), nullptr);
+
+        list->Invalidate();
+        CHECK_FALSE(list->IsValid());
+        CHECK_EQ(list->GetBakedCount(), 0);
+    }
+
+    SUBCASE("Z order")
+    {
+        auto list = CreateCommandList({ true, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            DrawTexture(texture, 0, 0, 1);
+            DrawPoint(1, 1, 0);
+            DrawTexture(texture, 8, 0, 1);
+        }
+        // Point goes first, then both sprites in one geometry.
+        CHECK_EQ(list->GetBakedCount(), 2);
+    }
+
+    SUBCASE("Nine slice and tiled")
+    {
+        auto list = CreateCommandList({ false, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            DrawNineSlice(texture, Rect(0, 0, 40, 30), { 2, 2, 2, 2 });
+            DrawTiled(SubTexture{ texture, Rect(0, 0, 4, 4) }, Rect(0, 0, 64, 64));
+        }
+        // One geometry each, however many quads.
+        CHECK_EQ(list->GetRecordedCount(), 2);
+        CHECK_EQ(list->GetBakedCount(), 2);
+    }
+
+    SUBCASE("Geometry is copied")
+    {
+        std::vector<SDL_Vertex> vertices(3, SDL_Vertex{ { 1.0f, 2.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f } });
+        std::vector<int> indices = { 0, 1, 2 };
+
+        auto list = CreateCommandList({ false, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            GeometryRenderCommand command{
+                { RenderCommandType::Geometry, 0 }, texture->GetHandle(), vertices.data(), indices.data(), 3, 3, 0
+            };
+            SubmitRenderCommand(command);
+        }
+
+        // The submitter moves on, e.g. to the next particle frame.
+        vertices.assign(3, SDL_Vertex{});
+        indices.assign(3, 7);
+
+        CaptureSink sink;
+        SetCurrentRenderer(CreateRef<CommandRecorder>(sink));
+        SetViewCulling(false);
+        list->Submit();
+        SetViewCulling(true);
+        SetCurrentRenderer(nullptr);
+
+        REQUIRE_EQ(sink.Commands.size(), 1);
+        const auto& replayed = static_cast<const GeometryRenderCommand&>(*sink.Commands[0]);
+        CHECK_NE(replayed.Vertices, vertices.data());
+        CHECK_EQ(replayed.Vertices[2].position.y, 2.0f);
+        CHECK_EQ(replayed.Indices[2], 2);
+        CHECK_FALSE(replayed.Transient);
+    }
+
+    SUBCASE("Baked sprites are culled")
+    {
+        auto list = CreateCommandList({ false, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            DrawTexture(texture, 0, 0);
+            DrawTexture(texture, 200, 0, 1);
+        }
+        REQUIRE_EQ(list->GetBakedCount(), 2);
+
+        CaptureSink sink;
+        SetCurrentRenderer(CreateRef<CommandRecorder>(sink));
+        ViewCullingState lastView = GetViewCullingState();
+        SetViewCullingState({ true, true, { 0.0f, 0.0f, 64.0f, 64.0f } });
+
+        list->Submit();
+        CHECK_EQ(sink.Commands.size(), 1);
+
+        // The transform on Submit moves the second one into view.
+        sink.Orders.clear();
+        PushTransform(Transform::Translation(-180.0f, 0.0f));
+        list->Submit();
+        PopTransform();
+        REQUIRE_EQ(sink.Orders.size(), 1);
+        CHECK_EQ(sink.Orders[0], 1);
+
+        SetViewCullingState(lastView);
+        SetCurrentRenderer(nullptr);
+    }
+
+    texture->Destroy(); // native texture goes with the renderer
+}
@@ -0,0 +1,117 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/ParticleSystemImpl.h"
+
+#include "DgeX/Renderer/CommandList.h"
+#include "DgeX/Renderer/RenderApi.h"
+
+#include <SDL3/SDL.h>
+
+#include <random>
+
+using namespace DgeX;
+
+static ParticleStream MakeStream(size_t count)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> inverseLife(0.1f, 20.0f);
+
+    ParticleStream stream(count);
+    stream.Count = count;
+    for (size_t i = 0; i < count; i++)
+    {
+        stream.X[i] = value(random);
+        stream.Y[i] = value(random);
+        stream.VelocityX[i] = value(random);
+        stream.VelocityY[i] = value(random);
+        stream.Age[i] = 0.0f;
+        stream.InverseLife[i] = inverseLife(random);
+        stream.Rotation[i] = value(random);
+        stream.Spin[i] = value(random);
+    }
+    return stream;
+}
+
+TEST_CASE("ParticleSystem Test")
+{
+    SUBCASE("Update")
+    {
+        const ParticleMotion motion{ 3.0f, 98.0f, 1.0f, 0.5f, { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.5f, 0.0f, 0.0f } };
+
+        // Odd count, so that the scalar remainder is covered as well.
+        ParticleStream simd = MakeStream(37);
+        ParticleStream scalar = MakeStream(37);
+        for (int frame = 0; frame < 10; frame++)
+        {
+            UpdateParticles(simd, motion, 0.016f);
+            UpdateParticlesScalar(scalar, motion, 0.016f, 0, scalar.Count);
+        }
+
+        for (size_t i = 0; i < simd.Count; i++)
+        {
+            CHECK_EQ(simd.X[i], doctest::Approx(scalar.X[i]).epsilon(0.0001));
+            CHECK_EQ(simd.Y[i], doctest::Approx(scalar.Y[i]).epsilon(0.0001));
+            CHECK_EQ(simd.Rotation[i], doctest::Approx(scalar.Rotation[i]).epsilon(0.0001));
+            CHECK_EQ(simd.Scale[i], doctest::Approx(scalar.Scale[i]).epsilon(0.0001));
+            CHECK_EQ(simd.G[i], doctest::Approx(scalar.G[i]).epsilon(0.0001));
+            CHECK_EQ(simd.Age[i], scalar.Age[i]);
+        }
+
+        // Fully faded at the end of life.
+        RemoveDeadParticles(simd);
+        CHECK_LT(simd.Count, 37);
+        for (size_t i = 0; i < simd.Count; i++)
+        {
+            CHECK_LT(simd.Age[i] * simd.InverseLife[i], 1.0f);
+        }
+    }
+
+    SUBCASE("Emitter")
+    {
+        SoftwareRenderer software;
+        SDL_Renderer* renderer = software.Renderer;
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+        auto texture = CreateRef<Texture>(native);
+
+        auto system = CreateParticleSystem();
+        ParticleEmitterDesc desc;
+        desc.Texture = { texture, Rect(0, 0, 8, 8) };
+        desc.Capacity = 100;
+        desc.MinLife = 1.0f;
+        desc.MaxLife = 2.0f;
+        auto emitter = system->AddEmitter(desc);
+
+        // Never more than the capacity.
+        CHECK_EQ(emitter->Burst(60), 60);
+        CHECK_EQ(emitter->Burst(60), 40);
+        CHECK_EQ(system->GetParticleCount(), 100);
+
+        // All gone after the longest life.
+        system->Update(0.5f);
+        CHECK_EQ(emitter->GetParticleCount(), 100);
+        system->Update(2.0f);
+        CHECK_EQ(emitter->GetParticleCount(), 0);
+
+        // 10 per second, fractions carried over.
+        emitter->SetRate(10.0f);
+        system->Update(0.25f);
+        system->Update(0.25f);
+        CHECK_EQ(emitter->GetParticleCount(), 5);
+
+        // One geometry per emitter.
+        auto list = CreateCommandList({ false, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            system->Submit();
+        }
+        CHECK_EQ(list->GetRecordedCount(), 1);
+
+        system->RemoveEmitter(emitter);
+        CHECK_EQ(system->GetParticleCount(), 0);
+
+        texture->Destroy();
+    }
+}
@@ -0,0 +1,81 @@
+#include "doctest/doctest.h"
+
+#include "Renderer/RectPacker.h"
+
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+static bool Overlaps(const Rect& a, const Rect& b)
+{
+    return (a.X < b.X + b.Width) && (b.X < a.X + a.Width) && (a.Y < b.Y + b.Height) && (b.Y < a.Y + a.Height);
+}
+
+TEST_CASE("RectPacker Test")
+{
+    SUBCASE("Exact fit")
+    {
+        RectPacker packer(64, 64);
+        Rect rect;
+        for (int i = 0; i < 16; i++)
+        {
+            REQUIRE(packer.Insert(16, 16, rect));
+            CHECK_EQ(rect.X % 16, 0);
+            CHECK_EQ(rect.Y % 16, 0);
+        }
+        CHECK_FALSE(packer.Insert(1, 1, rect));
+        CHECK_EQ(packer.GetRectCount(), 16);
+        CHECK_EQ(packer.GetOccupancy(), 1.0f);
+    }
+
+    SUBCASE("Too large")
+    {
+        RectPacker packer(64, 32);
+        Rect rect;
+        CHECK_FALSE(packer.Insert(65, 1, rect));
+        CHECK_FALSE(packer.Insert(1, 33, rect));
+        CHECK_FALSE(packer.Insert(0, 8, rect));
+        CHECK(packer.Insert(64, 32, rect));
+    }
+
+    SUBCASE("Random")
+    {
+        std::mt19937 random(7);
+        std::uniform_int_distribution<int> size(4, 48);
+
+        RectPacker packer(256, 256);
+        std::vector<Rect> placed;
+        int failures = 0;
+        while (failures < 16)
+        {
+            Rect rect;
+            int width = size(random);
+            int height = size(random);
+            if (!packer.Insert(width, height, rect))
+            {
+                failures++;
+                continue;
+            }
+            CHECK_EQ(rect.Width, width);
+            CHECK_EQ(rect.Height, height);
+            CHECK(rect.X >= 0);
+            CHECK(rect.Y >= 0);
+            CHECK(rect.X + rect.Width <= 256);
+            CHECK(rect.Y + rect.Height <= 256);
+            placed.push_back(rect);
+        }
+
+        for (size_t i = 0; i < placed.size(); i++)
+        {
+            for (size_t j = i + 1; j < placed.size(); j++)
+            {
+                CHECK_FALSE(Overlaps(placed[i], placed[j]));
+            }
+        }
+
+        // MaxRects should pack random sizes reasonably tight.
+        CHECK_EQ(packer.GetRectCount(), static_cast<int>(placed.size()));
+        CHECK(packer.GetOccupancy() > 0.75f);
+    }
+}
@@ -0,0 +1,138 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/RenderCommandImpl.h"
+
+#include "DgeX/Device/Graphics/Renderer.h"
+#include "DgeX/Renderer/CachedLayer.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Texture.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace DgeX;
+
+struct NullSink : CommandSink
+{
+    void Record(const RenderCommand& command) override
+    {
+    }
+};
+
+struct SpriteCountSink : CommandSink
+{
+    void Record(const RenderCommand& command) override
+    {
+        if (command.Type == RenderCommandType::Geometry)
+        {
+            SpriteCounts.push_back(static_cast<const GeometryRenderCommand&>(command).SpriteCount);
+        }
+    }
+
+    std::vector<uint32_t> SpriteCounts;
+};
+
+TEST_CASE("RenderApi Test")
+{
+    SUBCASE("Destroy resets other threads")
+    {
+        NullSink sink;
+        Ref<Renderer> renderer = CreateRef<CommandRecorder>(sink);
+        std::weak_ptr<Renderer> weak = renderer;
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool set = false;
+        bool destroyed = false;
+        Ref<Renderer> seen;
+
+        std::thread worker([&] {
+            SetCurrentRenderer(renderer);
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                set = true;
+                condition.notify_all();
+                condition.wait(lock, [&] { return destroyed; });
+            }
+            seen = GetCurrentRenderer();
+        });
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&] { return set; });
+        }
+
+        // Only the worker holds it now, while still alive.
+        renderer = nullptr;
+        CHECK_FALSE(weak.expired());
+        DestroyRenderApi();
+        CHECK(weak.expired());
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            destroyed = true;
+        }
+        condition.notify_all();
+        worker.join();
+        CHECK_EQ(seen.get(), nullptr);
+    }
+
+    SUBCASE("Tiled in view")
+    {
+        SoftwareRenderer software;
+        SDL_Texture* native =
+            SDL_CreateTexture(software.Renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+        auto texture = CreateRef<Texture>(native);
+
+        SpriteCountSink sink;
+        SetCurrentRenderer(CreateRef<CommandRecorder>(sink));
+        SetViewRect(Rect(0, 0, 64, 64));
+
+        // Tiles out of view are never made, however large the area.
+        DrawTiled(texture, Rect(0, 0, 100000, 100000));
+        PushTransform(Transform::Translation(-2.0f, 0.0f));
+        DrawTiled(texture, Rect(0, 0, 100000, 100000));
+        PopTransform();
+        REQUIRE_EQ(sink.SpriteCounts.size(), 2);
+        CHECK_EQ(sink.SpriteCounts[0], 16 * 16);
+        CHECK_EQ(sink.SpriteCounts[1], 17 * 16);
+
+        // Not culled, so too many.
+        SetViewCulling(false);
+        DrawTiled(texture, Rect(0, 0, 100000, 100000));
+        CHECK_EQ(sink.SpriteCounts.size(), 2);
+
+        SetViewCulling(true);
+        ResetViewRect();
+        SetCurrentRenderer(nullptr);
+        texture->Destroy(); // native texture goes with the renderer
+    }
+
+    SUBCASE("Cached layer is counted once")
+    {
+        SoftwareRenderer software;
+        REQUIRE_EQ(InitRenderer(software.Renderer), DGEX_SUCCESS);
+        {
+            FlushDevice(); // not to count earlier draws
+            Ref<CachedLayer> layer = CreateCachedLayer(32, 32);
+            {
+                RECORD_CACHED_LAYER(layer);
+                DrawPoint(1, 1);
+                DrawPoint(100, 100);
+            }
+            FlushDevice();
+
+            // Not again when the layer is redrawn from what it recorded.
+            CullingStatistics statistics = GetCullingStatistics();
+            CHECK_EQ(statistics.KeptCount, 1);
+            CHECK_EQ(statistics.CulledCount, 1);
+        }
+        DestroyRenderer();
+        software.Renderer = nullptr; // destroyed with the renderer context
+    }
+}
@@ -0,0 +1,139 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/RenderCommandImpl.h"
+#include "Utils/LinearArena.h"
+
+#include <SDL3/SDL.h>
+
+using namespace DgeX;
+
+TEST_CASE("RenderCommand Bounds Test")
+{
+    SDL_FRect bounds;
+
+    LineRenderCommand line{ { RenderCommandType::Line, 0 }, 10.0f, 20.0f, 0.0f, 5.0f, Color::White };
+    REQUIRE(GetRenderCommandBounds(line, bounds));
+    CHECK_EQ(bounds.x, 0.0f);
+    CHECK_EQ(bounds.y, 5.0f);
+    CHECK_EQ(bounds.w, 11.0f);
+    CHECK_EQ(bounds.h, 16.0f);
+
+    ClearRenderCommand clear{ { RenderCommandType::Clear, 0 }, Color::Black };
+    CHECK_FALSE(GetRenderCommandBounds(clear, bounds));
+
+    SUBCASE("Transform")
+    {
+        // Bounds are in screen space.
+        Transform zoom = Transform::Translation(100.0f, 0.0f) * Transform::Scaling(-2.0f, 2.0f);
+        RectRenderCommand rect{ { RenderCommandType::FilledRect, 0, &zoom }, { 0.0f, 0.0f, 10.0f, 5.0f }, Color::Red };
+        REQUIRE(GetRenderCommandBounds(rect, bounds));
+        CHECK_EQ(bounds.x, 80.0f);
+        CHECK_EQ(bounds.w, 20.0f);
+        CHECK_EQ(bounds.h, 10.0f);
+
+        Transform rotation = Transform::Rotation(90.0f);
+        rect.Transform = &rotation;
+        REQUIRE(GetRenderCommandBounds(rect, bounds));
+        CHECK_EQ(bounds.x, doctest::Approx(-5.0f));
+        CHECK_EQ(bounds.w, doctest::Approx(5.0f));
+        CHECK_EQ(bounds.h, doctest::Approx(10.0f));
+    }
+
+    SUBCASE("Texture")
+    {
+        SoftwareRenderer software(8, 8);
+        SDL_Renderer* renderer = software.Renderer;
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        REQUIRE(native);
+        Texture texture(native);
+
+        TextureRenderCommand sprite{ { RenderCommandType::Texture, 0 },
+                                     texture.GetHandle(),
+                                     { 0.0f, 0.0f },
+                                     100.0f,
+                                     100.0f,
+                                     2.0f,
+                                     0.0f,
+                                     255,
+                                     false,
+                                     false,
+                                     true };
+        REQUIRE(GetRenderCommandBounds(sprite, bounds));
+        CHECK_EQ(bounds.x, doctest::Approx(96.0f));
+        CHECK_EQ(bounds.w, doctest::Approx(16.0f));
+
+        // Rotated around the center, the box grows by sqrt(2).
+        sprite.Degree = 45.0f;
+        REQUIRE(GetRenderCommandBounds(sprite, bounds));
+        CHECK_EQ(bounds.w, doctest::Approx(16.0f * 1.41421356f).epsilon(0.001));
+        CHECK_EQ(bounds.x + bounds.w * 0.5f, doctest::Approx(104.0f));
+
+        // Rotated around the top-left corner, it swings to the left.
+        sprite.Degree = 90.0f;
+        sprite.DefaultAnchor = false;
+        REQUIRE(GetRenderCommandBounds(sprite, bounds));
+        CHECK_EQ(bounds.x, doctest::Approx(96.0f - 16.0f));
+        CHECK_EQ(bounds.y, doctest::Approx(96.0f));
+
+        // Only the region counts, as if it were the whole texture.
+        sprite.Degree = 0.0f;
+        sprite.DefaultAnchor = true;
+        sprite.Source = { 2.0f, 2.0f, 4.0f, 2.0f };
+        REQUIRE(GetRenderCommandBounds(sprite, bounds));
+        CHECK_EQ(bounds.x, doctest::Approx(98.0f));
+        CHECK_EQ(bounds.w, doctest::Approx(8.0f));
+        CHECK_EQ(bounds.h, doctest::Approx(4.0f));
+
+        texture.Destroy(); // native texture goes with the renderer
+    }
+}
+
+TEST_CASE("RenderCommand Hash Test")
+{
+    RectRenderCommand rect{ { RenderCommandType::Rect, 0 }, { 1.0f, 2.0f, 3.0f, 4.0f }, Color::Red };
+    RectRenderCommand same = rect;
+    RectRenderCommand moved = rect;
+    moved.Rect.x = 2.0f;
+
+    uint64_t hash = HashRenderCommand(rect, RENDER_COMMAND_HASH_SEED);
+    CHECK_EQ(hash, HashRenderCommand(same, RENDER_COMMAND_HASH_SEED));
+    CHECK_NE(hash, HashRenderCommand(moved, RENDER_COMMAND_HASH_SEED));
+
+    Transform transform = Transform::Translation(1.0f, 0.0f);
+    same.Transform = &transform;
+    CHECK_NE(hash, HashRenderCommand(same, RENDER_COMMAND_HASH_SEED));
+
+    // Order of commands matters.
+    uint64_t forward = HashRenderCommand(moved, hash);
+    uint64_t backward = HashRenderCommand(rect, HashRenderCommand(moved, RENDER_COMMAND_HASH_SEED));
+    CHECK_NE(forward, backward);
+
+    // Text may be null, and hashes as empty.
+    TextRenderCommand text{ { RenderCommandType::Text, 0 }, nullptr, nullptr, { 0, 0, 0, 0 }, Color::Red, 1.0f, {} };
+    uint64_t empty = HashRenderCommand(text, RENDER_COMMAND_HASH_SEED);
+    text.Text = "";
+    CHECK_EQ(empty, HashRenderCommand(text, RENDER_COMMAND_HASH_SEED));
+}
+
+TEST_CASE("RenderCommand Copy Test")
+{
+    LinearArena arena;
+    SDL_Vertex vertices[3] = {};
+    int indices[3] = { 0, 1, 2 };
+    GeometryRenderCommand geometry{ { RenderCommandType::Geometry, 0 }, {}, vertices, indices, 3, 3, 0 };
+
+    // Prepared geometry is shared.
+    auto* copy = static_cast<GeometryRenderCommand*>(CopyRenderCommand(arena, geometry));
+    CHECK_EQ(copy->Vertices, vertices);
+    CHECK_EQ(copy->Indices, indices);
+
+    // Transient geometry is copied.
+    geometry.Transient = true;
+    copy = static_cast<GeometryRenderCommand*>(CopyRenderCommand(arena, geometry));
+    CHECK_NE(copy->Vertices, vertices);
+    CHECK_NE(copy->Indices, indices);
+    indices[2] = 0;
+    CHECK_EQ(copy->Indices[2], 2);
+}
@@ -0,0 +1,88 @@
+#include "doctest/doctest.h"
+
+#include "Renderer/SpriteVertex.h"
+
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+static void CheckSameQuads(const std::vector<TextureRenderCommand>& commands, const Transform* transform)
+{
+    const float width = 24.0f;
+    const float height = 16.0f;
+
+    SpriteStream stream;
+    for (const TextureRenderCommand& command : commands)
+    {
+        stream.Push(command, width, height);
+    }
+
+    std::vector<SDL_Vertex> vertices(commands.size() * 4);
+    GenerateSpriteVertices(stream, transform, vertices.data());
+
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        TextureRenderCommand command = commands[i];
+        command.Transform = transform;
+        SDL_Vertex expected[4];
+        GetTextureQuad(command, width, height, expected);
+
+        for (int j = 0; j < 4; j++)
+        {
+            const SDL_Vertex& actual = vertices[i * 4 + j];
+            CHECK_EQ(actual.position.x, doctest::Approx(expected[j].position.x).epsilon(0.0001));
+            CHECK_EQ(actual.position.y, doctest::Approx(expected[j].position.y).epsilon(0.0001));
+            CHECK_EQ(actual.color.a, expected[j].color.a);
+            CHECK_EQ(actual.color.r, 1.0f);
+            CHECK_EQ(actual.color.b, 1.0f);
+            CHECK_EQ(actual.tex_coord.x, expected[j].tex_coord.x);
+            CHECK_EQ(actual.tex_coord.y, expected[j].tex_coord.y);
+        }
+    }
+}
+
+TEST_CASE("SpriteVertex Test")
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 3.0f);
+    std::uniform_real_distribution<float> degree(-360.0f, 360.0f);
+
+    // Odd count, so that the scalar remainder is covered as well.
+    std::vector<TextureRenderCommand> commands;
+    for (int i = 0; i < 37; i++)
+    {
+        bool flipX = (i % 3) == 0;
+        bool flipY = (i % 5) == 0;
+        bool defaultAnchor = (i % 2) == 0;
+        commands.push_back({ { RenderCommandType::Texture, 0 },
+                             {},
+                             { 4.0f, 6.0f },
+                             position(random),
+                             position(random),
+                             scale(random),
+                             degree(random),
+                             static_cast<uint8_t>(i * 7),
+                             flipX,
+                             flipY,
+                             defaultAnchor });
+        if ((i % 4) == 0)
+        {
+            commands.back().Source = { 8.0f, 4.0f, 12.0f, 10.0f }; // atlas region
+        }
+    }
+
+    SUBCASE("Identity")
+    {
+        CheckSameQuads(commands, nullptr);
+    }
+
+    SUBCASE("Transform")
+    {
+        Transform camera = Transform::Camera(100.0f, -50.0f, 1.5f, 30.0f, 640.0f, 480.0f);
+        CheckSameQuads(commands, &camera);
+    }
+
+    CHECK(GetSpriteVertexPath());
+}
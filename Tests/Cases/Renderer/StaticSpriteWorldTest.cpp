@@ -0,0 +1,74 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "DgeX/Renderer/StaticSpriteWorld.h"
+#include "DgeX/Renderer/Texture.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace DgeX;
+
+TEST_CASE("StaticSpriteWorld Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+    SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    REQUIRE(native);
+    auto texture = CreateRef<Texture>(native);
+
+    auto world = CreateStaticSpriteWorld(32, false);
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> position(-500, 500);
+    std::vector<StaticSpriteDesc> descs;
+    for (int i = 0; i < 1000; i++)
+    {
+        StaticSpriteDesc desc;
+        desc.Texture = texture;
+        desc.X = position(random);
+        desc.Y = position(random);
+        descs.push_back(desc);
+        CHECK_EQ(world->Add(desc), static_cast<uint32_t>(i));
+    }
+    CHECK_EQ(world->GetSpriteCount(), 1000);
+
+    // Same result as testing every sprite, 8x8 each.
+    Rect view{ -100, -50, 200, 120 };
+    auto expect = [&](uint32_t id) {
+        const StaticSpriteDesc& desc = descs[id];
+        return (desc.X < view.X + view.Width) && (desc.X + 8 > view.X) && (desc.Y < view.Y + view.Height) &&
+               (desc.Y + 8 > view.Y);
+    };
+
+    std::vector<uint32_t> ids;
+    world->Query(view, ids);
+    std::sort(ids.begin(), ids.end());
+    CHECK(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+
+    std::vector<uint32_t> expected;
+    for (uint32_t id = 0; id < descs.size(); id++)
+    {
+        if (expect(id))
+        {
+            expected.push_back(id);
+        }
+    }
+    CHECK_EQ(ids, expected);
+    REQUIRE_FALSE(expected.empty());
+
+    // Removed sprites are gone, and their ids are reused.
+    world->Remove(expected.front());
+    ids.clear();
+    world->Query(view, ids);
+    CHECK_EQ(ids.size(), expected.size() - 1);
+    CHECK_EQ(world->Add(descs[expected.front()]), expected.front());
+
+    world->Clear();
+    CHECK_EQ(world->GetSpriteCount(), 0);
+
+    texture->Destroy(); // native texture goes with the renderer
+}
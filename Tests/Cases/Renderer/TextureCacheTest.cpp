@@ -0,0 +1,84 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/TextureCacheImpl.h"
+#include "Renderer/TextureRegistry.h"
+
+#include <SDL3/SDL.h>
+
+using namespace DgeX;
+
+TEST_CASE("TextureCache Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+
+    auto createTexture = [renderer]() {
+        return CreateRef<Texture>(
+            SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8));
+    };
+
+    TextureCache cache;
+
+    SUBCASE("Key")
+    {
+        CHECK_EQ(TextureCache::GetKey("assets/./sprites/../hero.png"), TextureCache::GetKey("assets/hero.png"));
+        CHECK_NE(TextureCache::GetKey("assets/hero.png"), TextureCache::GetKey("assets/enemy.png"));
+    }
+
+    SUBCASE("Shared")
+    {
+        std::string key = TextureCache::GetKey("hero.png");
+        CHECK_FALSE(cache.Find(key));
+
+        Ref<Texture> texture = cache.Insert(key, createTexture());
+        CHECK_EQ(cache.Find(key), texture);
+
+        // Existing entry wins.
+        CHECK_EQ(cache.Insert(key, createTexture()), texture);
+
+        TextureCacheStatistics statistics = cache.GetStatistics();
+        CHECK_EQ(statistics.EntryCount, 1);
+        CHECK_EQ(statistics.UnreferencedCount, 0);
+        CHECK_EQ(statistics.Hits, 1);
+        CHECK_EQ(statistics.Misses, 1);
+        CHECK_EQ(statistics.GetHitRate(), 0.5f);
+    }
+
+    SUBCASE("Destroyed")
+    {
+        Ref<Texture> texture = cache.Insert("hero.png", createTexture());
+        texture->Destroy();
+
+        // Dropped once found dead, so that it is loaded again.
+        CHECK_FALSE(cache.Find("hero.png"));
+        CHECK_EQ(cache.GetStatistics().EntryCount, 0);
+
+        Ref<Texture> reloaded = cache.Insert("hero.png", createTexture());
+        CHECK_NE(reloaded.get(), texture.get());
+        CHECK_EQ(cache.Find("hero.png").get(), reloaded.get());
+    }
+
+    SUBCASE("Purge")
+    {
+        Ref<Texture> kept = cache.Insert("kept.png", createTexture());
+        cache.Insert("dropped.png", createTexture());
+
+        CHECK_EQ(cache.GetStatistics().UnreferencedCount, 1);
+        CHECK_EQ(cache.Purge(), 1);
+        CHECK(cache.Find("kept.png"));
+        CHECK_FALSE(cache.Find("dropped.png"));
+
+        // Referenced by the cache only, even under two paths.
+        cache.Insert("alias.png", kept);
+        kept.reset();
+        CHECK_EQ(cache.GetStatistics().UnreferencedCount, 2);
+        CHECK_EQ(cache.Purge(), 2);
+        CHECK_EQ(cache.GetStatistics().EntryCount, 0);
+        CHECK_EQ(cache.GetStatistics().Purged, 3);
+    }
+
+    cache.Clear();
+    GetTextureRegistry().DestroyAll();
+}
@@ -0,0 +1,109 @@
+#include "doctest/doctest.h"
+
+#include "Renderer/TextureFileImpl.h"
+#include "Utils/Qoi.h"
+
+#include <SDL3/SDL.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+static std::vector<uint8_t> MakePixels(int width, int height)
+{
+    // Gradients, flat runs and noise, to hit every QOI operation.
+    std::mt19937 random(42);
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            uint8_t* pixel = pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+            if (y < height / 3)
+            {
+                pixel[0] = static_cast<uint8_t>(x);
+                pixel[1] = static_cast<uint8_t>(y * 2);
+                pixel[2] = static_cast<uint8_t>(x + y);
+                pixel[3] = 255;
+            }
+            else if (y < height * 2 / 3)
+            {
+                std::memset(pixel, x < width / 2 ? 0 : 128, 4);
+            }
+            else
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    pixel[i] = static_cast<uint8_t>(random());
+                }
+            }
+        }
+    }
+    return pixels;
+}
+
+TEST_CASE("Qoi Test")
+{
+    const int width = 97;
+    const int height = 61;
+    const size_t count = static_cast<size_t>(width) * height;
+    std::vector<uint8_t> pixels = MakePixels(width, height);
+
+    std::vector<uint8_t> encoded;
+    QoiEncode(pixels.data(), count, encoded);
+    CHECK_LT(encoded.size(), count * 5);
+
+    std::vector<uint8_t> decoded(count * 4);
+    REQUIRE(QoiDecode(encoded.data(), encoded.size(), decoded.data(), count));
+    CHECK_EQ(std::memcmp(decoded.data(), pixels.data(), pixels.size()), 0);
+
+    // Truncated streams are rejected instead of read past.
+    CHECK_FALSE(QoiDecode(encoded.data(), encoded.size() / 2, decoded.data(), count));
+}
+
+TEST_CASE("TextureFile Test")
+{
+    const int width = 40;
+    const int height = 30;
+    std::vector<uint8_t> pixels = MakePixels(width, height);
+
+    SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ABGR8888);
+    REQUIRE(surface);
+    for (int y = 0; y < height; y++)
+    {
+        std::memcpy(static_cast<uint8_t*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch,
+                    pixels.data() + static_cast<size_t>(y) * width * 4, static_cast<size_t>(width) * 4);
+    }
+
+    for (TextureCompression compression : { TextureCompression::None, TextureCompression::Qoi })
+    {
+        std::vector<uint8_t> content;
+        REQUIRE(EncodeTextureFile(surface, compression, compression == TextureCompression::Qoi, content));
+        CHECK(IsTextureFile(content.data(), content.size()));
+
+        bool premultiplied = false;
+        SDL_Surface* decoded = DecodeTextureFile(content.data(), content.size(), true, premultiplied);
+        REQUIRE(decoded);
+        CHECK_EQ(premultiplied, compression == TextureCompression::Qoi);
+        CHECK_EQ(decoded->w, width);
+        CHECK_EQ(decoded->h, height);
+        CHECK_EQ(decoded->format, SDL_PIXELFORMAT_ABGR8888);
+        for (int y = 0; y < height; y++)
+        {
+            CHECK_EQ(std::memcmp(static_cast<uint8_t*>(decoded->pixels) + static_cast<size_t>(y) * decoded->pitch,
+                                 pixels.data() + static_cast<size_t>(y) * width * 4, static_cast<size_t>(width) * 4),
+                     0);
+        }
+        SDL_DestroySurface(decoded);
+
+        // Truncated files are rejected.
+        CHECK_FALSE(DecodeTextureFile(content.data(), content.size() - 1, false, premultiplied));
+    }
+
+    const char png[] = "\x89PNG\r\n\x1a\n";
+    CHECK_FALSE(IsTextureFile(png, sizeof(png)));
+
+    SDL_DestroySurface(surface);
+}
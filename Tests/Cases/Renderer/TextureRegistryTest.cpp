@@ -0,0 +1,216 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "Renderer/TextureRegistry.h"
+
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+using namespace DgeX;
+
+TEST_CASE("TextureRegistry Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+
+    TextureRegistry registry;
+    TextureInfo info{};
+
+    SUBCASE("Register")
+    {
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 8);
+        REQUIRE(native);
+
+        TextureHandle handle = registry.Register(native);
+        REQUIRE(handle.IsValid());
+        REQUIRE(registry.Resolve(handle, info));
+        CHECK_EQ(info.Native, native);
+        CHECK_EQ(info.Width, 16.0f);
+        CHECK_EQ(info.Height, 8.0f);
+        CHECK_EQ(info.Format, SDL_PIXELFORMAT_ABGR8888);
+        CHECK_EQ(registry.GetTextureCount(), 1);
+
+        CHECK_FALSE(registry.Resolve({}, info));
+        CHECK_FALSE(registry.Register(nullptr).IsValid());
+    }
+
+    SUBCASE("Deferred destruction")
+    {
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        TextureHandle handle = registry.Register(native);
+
+        // Used by the next frame, then released before it is rendered.
+        registry.EndFrame();
+        registry.MarkUsed(handle);
+        registry.Release(handle);
+        registry.Release(handle); // twice is fine
+        CHECK_EQ(registry.GetPendingCount(), 1);
+        CHECK(registry.Resolve(handle, info));
+
+        registry.EndFrame();
+        CHECK_EQ(registry.GetPendingCount(), 0);
+        CHECK_EQ(registry.GetTextureCount(), 0);
+        CHECK_FALSE(registry.Resolve(handle, info));
+
+        // Slot is reused, but the old handle stays stale.
+        native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        TextureHandle reused = registry.Register(native);
+        CHECK_EQ(reused.Index, handle.Index);
+        CHECK_NE(reused, handle);
+        CHECK(registry.Resolve(reused, info));
+        CHECK_FALSE(registry.Resolve(handle, info));
+    }
+
+    SUBCASE("Frame latency")
+    {
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        TextureHandle handle = registry.Register(native);
+
+        // Marked just before the frame ends, but drawn by the next one.
+        registry.SetFrameLatency(1);
+        registry.MarkUsed(handle);
+        registry.Release(handle);
+        registry.EndFrame();
+        CHECK_EQ(registry.GetPendingCount(), 1);
+        CHECK(registry.Resolve(handle, info));
+
+        registry.EndFrame();
+        CHECK_EQ(registry.GetPendingCount(), 0);
+        CHECK_FALSE(registry.Resolve(handle, info));
+        registry.SetFrameLatency(0);
+    }
+
+    SUBCASE("Eviction")
+    {
+        SDL_Texture* pinned = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_TARGET, 8, 8);
+        SDL_Texture* old = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 8);
+        SDL_Texture* recent = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        TextureHandle pinnedHandle = registry.Register(pinned);
+        TextureHandle oldHandle = registry.Register(old, "old.png");
+        TextureHandle recentHandle = registry.Register(recent, "recent.png");
+        CHECK_EQ(registry.GetResidentBytes(), (64 + 128 + 64) * 4);
+
+        registry.EndFrame();
+        registry.EndFrame();
+        registry.MarkUsed(recentHandle);
+        registry.EndFrame();
+        registry.EndFrame();
+
+        // Least recently used goes first, then stops once within budget.
+        uint64_t epoch = registry.GetContentEpoch();
+        CHECK_EQ(registry.Evict(200 * 4), 1);
+        CHECK_EQ(registry.GetContentEpoch(), epoch + 1);
+        CHECK_FALSE(registry.IsResident(oldHandle));
+        CHECK(registry.IsResident(recentHandle));
+        CHECK_EQ(registry.GetResidentBytes(), 128 * 4);
+        CHECK_EQ(registry.GetEvictedCount(), 1);
+
+        // Still resolves, to the fallback with its own size.
+        REQUIRE(registry.Resolve(oldHandle, info));
+        CHECK_NE(info.Native, nullptr);
+        CHECK_EQ(info.Width, 16.0f);
+        CHECK_EQ(info.Height, 8.0f);
+
+        // Render targets are never evicted.
+        CHECK_EQ(registry.Evict(0), 1);
+        CHECK(registry.IsResident(pinnedHandle));
+
+        // Drawn again, reloaded once.
+        std::vector<TextureReload> reloads;
+        registry.CollectReloads(reloads);
+        CHECK(reloads.empty());
+        registry.MarkUsed(oldHandle);
+        registry.CollectReloads(reloads);
+        registry.CollectReloads(reloads);
+        REQUIRE_EQ(reloads.size(), 1);
+        CHECK_EQ(reloads[0].Handle, oldHandle);
+        CHECK_EQ(reloads[0].Source, "old.png");
+
+        SDL_Texture* reloaded = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 8);
+        registry.Restore(oldHandle, reloaded);
+        CHECK(registry.IsResident(oldHandle));
+        CHECK_EQ(registry.GetContentEpoch(), epoch + 3); // swapped under the same handle
+        REQUIRE(registry.Resolve(oldHandle, info));
+        CHECK_EQ(info.Native, reloaded);
+        CHECK_EQ(registry.GetReloadCount(), 1);
+
+        // Released while evicted, the fallback is kept.
+        registry.Release(recentHandle);
+        registry.EndFrame();
+        CHECK_EQ(registry.GetEvictedCount(), 0);
+        CHECK_EQ(registry.GetResidentBytes(), (64 + 128) * 4);
+    }
+
+    SUBCASE("Variants")
+    {
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 64, 32);
+        SDL_Texture* half = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 32, 16);
+        SDL_Texture* quarter = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 8);
+        TextureHandle handle = registry.Register(native, "base.png");
+        TextureHandle halfHandle = registry.RegisterVariant(handle, half);
+        TextureHandle quarterHandle = registry.RegisterVariant(handle, quarter);
+        REQUIRE(halfHandle.IsValid());
+        REQUIRE(quarterHandle.IsValid());
+        CHECK_EQ(registry.GetVariantCount(handle), 2);
+
+        // Variants keep the size of the texture.
+        REQUIRE(registry.Resolve(quarterHandle, info));
+        CHECK_EQ(info.Native, quarter);
+        CHECK_EQ(info.Width, 64.0f);
+        CHECK_EQ(info.Height, 32.0f);
+        CHECK_EQ(info.ResolutionX, 0.25f);
+        CHECK_EQ(info.ResolutionY, 0.25f);
+
+        CHECK_EQ(registry.SelectVariant(handle, 1.0f), handle);
+        CHECK_EQ(registry.SelectVariant(handle, 0.6f), handle);
+        CHECK_EQ(registry.SelectVariant(handle, 0.5f), halfHandle);
+        CHECK_EQ(registry.SelectVariant(handle, 0.3f), halfHandle);
+        CHECK_EQ(registry.SelectVariant(handle, 0.1f), quarterHandle);
+        CHECK_EQ(registry.SelectVariant({}, 0.1f), TextureHandle());
+
+        // Released together.
+        registry.Release(handle);
+        CHECK_EQ(registry.GetPendingCount(), 3);
+        registry.EndFrame();
+        CHECK_EQ(registry.GetTextureCount(), 0);
+        CHECK_FALSE(registry.Resolve(quarterHandle, info));
+
+        // Not attached to a released texture.
+        SDL_Texture* orphan = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        CHECK_FALSE(registry.RegisterVariant(handle, orphan).IsValid());
+        CHECK_EQ(registry.GetTextureCount(), 0);
+        SDL_DestroyTexture(orphan);
+
+        // Each axis has its own ratio, the coarser one selects.
+        SDL_Texture* wide = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 64, 32);
+        SDL_Texture* odd = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 32, 8);
+        TextureHandle wideHandle = registry.Register(wide);
+        TextureHandle oddHandle = registry.RegisterVariant(wideHandle, odd);
+        REQUIRE(registry.Resolve(oddHandle, info));
+        CHECK_EQ(info.ResolutionX, 0.5f);
+        CHECK_EQ(info.ResolutionY, 0.25f);
+        CHECK_EQ(registry.SelectVariant(wideHandle, 0.3f), wideHandle);
+        CHECK_EQ(registry.SelectVariant(wideHandle, 0.25f), oddHandle);
+    }
+
+    SUBCASE("Texture")
+    {
+        SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 16, 8);
+        Texture texture(native);
+        CHECK_EQ(texture.GetWidth(), 16);
+        CHECK_EQ(texture.GetHeight(), 8);
+        CHECK_EQ(texture.GetFormat(), SDL_PIXELFORMAT_ABGR8888);
+
+        TextureHandle handle = texture.GetHandle();
+        texture.Destroy();
+        CHECK_FALSE(texture.GetHandle().IsValid());
+        CHECK(GetTextureRegistry().Resolve(handle, info));
+
+        GetTextureRegistry().EndFrame();
+        CHECK_FALSE(GetTextureRegistry().Resolve(handle, info));
+    }
+
+    registry.DestroyAll();
+}
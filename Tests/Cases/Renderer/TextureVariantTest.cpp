@@ -0,0 +1,97 @@
+#include "doctest/doctest.h"
+
+#include "Renderer/TextureVariantImpl.h"
+
+#include <SDL3/SDL.h>
+
+#include <random>
+#include <vector>
+
+using namespace DgeX;
+
+static uint8_t Average(const std::vector<uint8_t>& pixels, int pitch, int x0, int x1, int y0, int y1, int channel)
+{
+    int sum = pixels[y0 * pitch + x0 * 4 + channel] + pixels[y0 * pitch + x1 * 4 + channel] +
+              pixels[y1 * pitch + x0 * 4 + channel] + pixels[y1 * pitch + x1 * 4 + channel];
+    return static_cast<uint8_t>((sum + 2) / 4);
+}
+
+TEST_CASE("TextureVariant Test")
+{
+    SUBCASE("Downsample")
+    {
+        // Odd sizes and widths not a multiple of the vector width.
+        std::mt19937 random(7);
+        for (int width : { 1, 2, 3, 8, 13, 37 })
+        {
+            for (int height : { 1, 2, 5 })
+            {
+                int pitch = width * 4 + 4; // rows are padded
+                std::vector<uint8_t> source(static_cast<size_t>(pitch) * height);
+                for (uint8_t& value : source)
+                {
+                    value = static_cast<uint8_t>(random());
+                }
+
+                int outWidth = width > 1 ? width / 2 : 1;
+                int outHeight = height > 1 ? height / 2 : 1;
+                std::vector<uint8_t> destination(static_cast<size_t>(outWidth) * outHeight * 4);
+                DownsampleBox(source.data(), pitch, width, height, destination.data(), outWidth * 4);
+
+                bool same = true;
+                for (int y = 0; y < outHeight; y++)
+                {
+                    for (int x = 0; x < outWidth; x++)
+                    {
+                        int x0 = x * 2;
+                        int x1 = width > 1 ? x0 + 1 : x0;
+                        int y0 = y * 2;
+                        int y1 = height > 1 ? y0 + 1 : y0;
+                        for (int c = 0; c < 4; c++)
+                        {
+                            same &= destination[(y * outWidth + x) * 4 + c] ==
+                                    Average(source, pitch, x0, x1, y0, y1, c);
+                        }
+                    }
+                }
+                CHECK_MESSAGE(same, "width: ", width, ", height: ", height, ", path: ", GetDownsamplePath());
+            }
+        }
+    }
+
+    SUBCASE("Surfaces")
+    {
+        SDL_Surface* surface = SDL_CreateSurface(64, 32, SDL_PIXELFORMAT_ABGR8888);
+        REQUIRE(surface);
+        std::vector<SDL_Surface*> variants;
+
+        // Disabled by default.
+        CreateTextureVariantSurfaces(surface, variants);
+        CHECK(variants.empty());
+
+        TextureVariantOptions options;
+        options.Enabled = true;
+        options.MinSize = 4;
+        SetTextureVariantOptions(options);
+        CreateTextureVariantSurfaces(surface, variants);
+        REQUIRE_EQ(variants.size(), 3);
+        CHECK_EQ(variants[0]->w, 32);
+        CHECK_EQ(variants[0]->h, 16);
+        CHECK_EQ(variants[2]->w, 8);
+        CHECK_EQ(variants[2]->h, 4);
+        AttachTextureVariants({}, variants, false);
+        CHECK(variants.empty());
+
+        // Largest skipped first, to fit.
+        options.MaxBytes = (16 * 8 + 8 * 4) * 4;
+        SetTextureVariantOptions(options);
+        CreateTextureVariantSurfaces(surface, variants);
+        REQUIRE_EQ(variants.size(), 2);
+        CHECK_EQ(variants[0]->w, 16);
+        CHECK_EQ(variants[1]->w, 8);
+        AttachTextureVariants({}, variants, false);
+
+        SetTextureVariantOptions(TextureVariantOptions());
+        SDL_DestroySurface(surface);
+    }
+}
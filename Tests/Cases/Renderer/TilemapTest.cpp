@@ -0,0 +1,102 @@
+#include "doctest/doctest.h"
+
+#include "Common/SoftwareRenderer.h"
+
+#include "DgeX/Renderer/CommandList.h"
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Tilemap.h"
+
+#include <SDL3/SDL.h>
+
+using namespace DgeX;
+
+TEST_CASE("Tilemap Test")
+{
+    SoftwareRenderer software;
+    SDL_Renderer* renderer = software.Renderer;
+    SDL_Texture* native = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, 64, 64);
+    REQUIRE(native);
+    auto texture = CreateRef<Texture>(native);
+
+    // 4 x 2 tiles of 8 x 8 in the lower half of the texture.
+    TilemapDesc desc;
+    desc.Tileset = { texture, Rect(0, 32, 32, 16) };
+    desc.TileWidth = 8;
+    desc.TileHeight = 8;
+    desc.Width = 40;
+    desc.Height = 20;
+    desc.ChunkSize = 10;
+    auto tilemap = CreateTilemap(desc);
+
+    int ground = tilemap->AddLayer(0);
+    int wall = tilemap->AddLayer(1);
+    CHECK_EQ(tilemap->GetLayerCount(), 2);
+
+    SUBCASE("Tiles")
+    {
+        tilemap->SetTile(ground, 3, 4, 8);
+        CHECK_EQ(tilemap->GetTile(ground, 3, 4), 8);
+        CHECK_EQ(tilemap->GetTile(wall, 3, 4), DGEX_EMPTY_TILE);
+        CHECK_EQ(tilemap->GetTile(ground, -1, 4), DGEX_EMPTY_TILE);
+        CHECK_EQ(tilemap->GetTile(ground, 40, 4), DGEX_EMPTY_TILE);
+
+        // Part outside the map is ignored.
+        tilemap->Fill(wall, Rect(35, 15, 10, 10), 1);
+        CHECK_EQ(tilemap->GetTile(wall, 39, 19), 1);
+        CHECK_EQ(tilemap->GetTile(wall, 34, 19), DGEX_EMPTY_TILE);
+    }
+
+    SUBCASE("Chunks")
+    {
+        // 4 x 2 chunks of 80 x 80 pixels.
+        tilemap->Fill(ground, Rect(0, 0, 40, 20), 1);
+        tilemap->Fill(wall, Rect(0, 0, 5, 5), 2);
+
+        auto list = CreateCommandList({ true, false });
+        {
+            RECORD_COMMAND_LIST(list);
+            tilemap->Submit(Rect(0, 0, 100, 50));
+        }
+        // Chunk (0, 0) and (1, 0) of the ground, and (0, 0) of the walls.
+        CHECK_EQ(tilemap->GetVisibleChunkCount(), 3);
+        CHECK_EQ(tilemap->GetRebuiltChunkCount(), 3);
+        CHECK_EQ(list->GetRecordedCount(), 3);
+
+        // Built chunks are kept, only the changed one is built again.
+        list->Invalidate();
+        tilemap->SetTile(ground, 15, 5, 3);
+        {
+            RECORD_COMMAND_LIST(list);
+            tilemap->Submit(Rect(0, 0, 100, 50));
+        }
+        CHECK_EQ(tilemap->GetVisibleChunkCount(), 3);
+        CHECK_EQ(tilemap->GetRebuiltChunkCount(), 1);
+
+        // Setting the same tile changes nothing.
+        tilemap->SetTile(ground, 15, 5, 3);
+        list->Invalidate();
+        {
+            RECORD_COMMAND_LIST(list);
+            tilemap->Submit(Rect(0, 0, 100, 50));
+        }
+        CHECK_EQ(tilemap->GetRebuiltChunkCount(), 0);
+
+        // Chunks never seen are built when they come into view.
+        list->Invalidate();
+        {
+            RECORD_COMMAND_LIST(list);
+            tilemap->Submit(Rect(-100, -100, 1000, 1000));
+        }
+        CHECK_EQ(tilemap->GetVisibleChunkCount(), 9);
+        CHECK_EQ(tilemap->GetRebuiltChunkCount(), 6);
+
+        list->Invalidate();
+        {
+            RECORD_COMMAND_LIST(list);
+            tilemap->Submit(Rect(400, 0, 100, 100));
+        }
+        CHECK_EQ(tilemap->GetVisibleChunkCount(), 0);
+    }
+
+    texture->Destroy();
+}
@@ -0,0 +1,72 @@
+#include "doctest/doctest.h"
+
+#include "DgeX/Renderer/RenderApi.h"
+#include "DgeX/Renderer/Transform.h"
+
+using namespace DgeX;
+
+TEST_CASE("Transform Test")
+{
+    float x = 10.0f;
+    float y = 0.0f;
+
+    SUBCASE("Compose")
+    {
+        // Scale first, then translate.
+        Transform transform = Transform::Translation(5.0f, 5.0f) * Transform::Scaling(2.0f, 3.0f);
+        transform.Apply(x, y);
+        CHECK_EQ(x, doctest::Approx(25.0f));
+        CHECK_EQ(y, doctest::Approx(5.0f));
+        CHECK(transform.IsAxisAligned());
+        CHECK_FALSE(transform.IsIdentity());
+    }
+
+    SUBCASE("Rotation")
+    {
+        // Clockwise on the screen.
+        Transform transform = Transform::Rotation(90.0f);
+        transform.Apply(x, y);
+        CHECK_EQ(x, doctest::Approx(0.0f));
+        CHECK_EQ(y, doctest::Approx(10.0f));
+        CHECK_FALSE(transform.IsAxisAligned());
+    }
+
+    SUBCASE("Inverse")
+    {
+        Transform transform = Transform::Camera(100.0f, 50.0f, 2.0f, 30.0f, 640.0f, 480.0f);
+        Transform inverse = transform.Inverse();
+        transform.Apply(x, y);
+        inverse.Apply(x, y);
+        CHECK_EQ(x, doctest::Approx(10.0f));
+        CHECK_EQ(y, doctest::Approx(0.0f).epsilon(0.001));
+    }
+
+    SUBCASE("Camera")
+    {
+        // Target is at the center of the view.
+        x = 100.0f;
+        y = 50.0f;
+        Transform::Camera(100.0f, 50.0f, 4.0f, 45.0f, 640.0f, 480.0f).Apply(x, y);
+        CHECK_EQ(x, doctest::Approx(320.0f));
+        CHECK_EQ(y, doctest::Approx(240.0f));
+    }
+}
+
+TEST_CASE("Transform Stack Test")
+{
+    CHECK(GetTransform().IsIdentity());
+
+    PushTransform(Transform::Translation(10.0f, 20.0f));
+    {
+        USE_TRANSFORM(Transform::Scaling(2.0f, 2.0f));
+        Transform current = GetTransform();
+        CHECK_EQ(current.A, 2.0f);
+        CHECK_EQ(current.X, 10.0f);
+        CHECK_EQ(current.Y, 20.0f);
+    }
+    CHECK_EQ(GetTransform().A, 1.0f);
+    CHECK_EQ(GetTransform().X, 10.0f);
+
+    PopTransform();
+    CHECK(GetTransform().IsIdentity());
+}
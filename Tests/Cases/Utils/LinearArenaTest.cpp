@@ -0,0 +1,38 @@
+#include "doctest/doctest.h"
+
+#include "Utils/LinearArena.h"
+
+#include <cstdint>
+#include <cstring>
+
+struct Payload
+{
+    int Value;
+    double Weight;
+};
+
+TEST_CASE("LinearArena Test")
+{
+    DgeX::LinearArena arena(256);
+
+    Payload* payload = arena.New(Payload{ 1, 2.0 });
+    CHECK_EQ(payload->Value, 1);
+    CHECK_EQ(reinterpret_cast<uintptr_t>(payload) % alignof(Payload), 0);
+
+    const char* text = arena.CopyString("DungineX");
+    CHECK_EQ(std::strcmp(text, "DungineX"), 0);
+    CHECK_EQ(arena.CopyString(nullptr), nullptr);
+
+    // Oversized allocation gets its own block.
+    arena.Allocate(1024);
+    size_t capacity = arena.GetCapacity();
+    CHECK_GE(capacity, 1024 + 256);
+
+    // Reset keeps the blocks, so the same workload does not grow the arena.
+    arena.Reset();
+    CHECK_EQ(arena.GetUsedSize(), 0);
+    arena.New(Payload{ 2, 3.0 });
+    arena.CopyString("DungineX");
+    arena.Allocate(1024);
+    CHECK_EQ(arena.GetCapacity(), capacity);
+}
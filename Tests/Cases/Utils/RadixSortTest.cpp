@@ -0,0 +1,37 @@
+#include "doctest/doctest.h"
+
+#include "Utils/RadixSort.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using DgeX::SortKeyEntry;
+
+TEST_CASE("RadixSort Test")
+{
+    for (size_t count : { 0, 1, 16, 1000 })
+    {
+        std::mt19937_64 random(42);
+        std::vector<SortKeyEntry> entries(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            // Few distinct keys across high and low bits to check stability.
+            uint64_t key = ((random() % 5) << 40) | (random() % 3);
+            entries[i] = { key, static_cast<uint32_t>(i) };
+        }
+
+        std::vector<SortKeyEntry> expected = entries;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const SortKeyEntry& lhs, const SortKeyEntry& rhs) { return lhs.Key < rhs.Key; });
+
+        std::vector<SortKeyEntry> scratch(count);
+        DgeX::RadixSort(entries.data(), scratch.data(), count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            CHECK_EQ(entries[i].Key, expected[i].Key);
+            CHECK_EQ(entries[i].Index, expected[i].Index);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "doctest/doctest.h"
+
+#include <SDL3/SDL.h>
+
+/**
+ * @brief Software renderer drawing into a surface, so it needs no window.
+ *
+ * Destroyed at the end of the scope, after everything declared later.
+ */
+struct SoftwareRenderer
+{
+    SDL_Surface* Surface = nullptr;
+    SDL_Renderer* Renderer = nullptr;
+
+    explicit SoftwareRenderer(int width = 64, int height = 64)
+    {
+        Surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ABGR8888);
+        REQUIRE(Surface);
+        Renderer = SDL_CreateSoftwareRenderer(Surface);
+        REQUIRE(Renderer);
+    }
+
+    SoftwareRenderer(const SoftwareRenderer& other) = delete;
+    SoftwareRenderer& operator=(const SoftwareRenderer& other) = delete;
+
+    ~SoftwareRenderer()
+    {
+        if (Renderer)
+        {
+            SDL_DestroyRenderer(Renderer);
+        }
+        if (Surface)
+        {
+            SDL_DestroySurface(Surface);
+        }
+    }
+};